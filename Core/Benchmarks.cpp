@@ -0,0 +1,1580 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+/// @file
+
+#include "config.h"
+#include "Benchmarks.h"
+#include "C64.h"
+#include "Emulator.h"
+#include "utl/chrono.h"
+#include <fstream>
+
+namespace vc64 {
+
+namespace {
+
+//
+// Rewind benchmark
+//
+
+// Returns the CPU time consumed by the calling thread in seconds
+double threadTime()
+{
+#ifdef _WIN32
+
+    // Fall back to the wall-clock time (thread clocks are a POSIX feature)
+    return 1e-9 * double(utl::Time::now().asNanoseconds());
+
+#else
+
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return double(ts.tv_sec) + 1e-9 * double(ts.tv_nsec);
+
+#endif
+}
+
+
+//
+// CPU benchmark
+//
+
+// A test program exercising various addressing modes (located at $0300)
+const u8 cpuProgram[] = {
+
+    0xA2, 0x00,             // $0300  LDX #$00
+    0xBD, 0x00, 0x04,       // $0302  LDA $0400,X
+    0x18,                   // $0305  CLC
+    0x7D, 0x00, 0x05,       // $0306  ADC $0500,X
+    0x9D, 0x00, 0x06,       // $0309  STA $0600,X
+    0x51, 0x10,             // $030C  EOR ($10),Y
+    0x2A,                   // $030E  ROL A
+    0x48,                   // $030F  PHA
+    0x20, 0x1C, 0x03,       // $0310  JSR $031C
+    0x68,                   // $0313  PLA
+    0xE8,                   // $0314  INX
+    0xD0, 0xEB,             // $0315  BNE $0302
+    0xE6, 0xF0,             // $0317  INC $F0
+    0x4C, 0x00, 0x03,       // $0319  JMP $0300
+    0xA4, 0xF0,             // $031C  LDY $F0
+    0xC8,                   // $031E  INY
+    0x84, 0xF1,             // $031F  STY $F1
+    0xF8,                   // $0321  SED
+    0xE9, 0x07,             // $0322  SBC #$07
+    0xD8,                   // $0324  CLD
+    0x24, 0xF1,             // $0325  BIT $F1
+    0x60                    // $0327  RTS
+};
+
+// Runs the test program with the switch or the threaded dispatcher
+template <CPURevision C, bool threaded> double
+runProgram(peddle::Peddle &cpu, u8 *ram, i64 cycles)
+{
+    // Setup RAM
+    std::memset(ram, 0, 0x400);
+    u32 seed = 1;
+    for (isize i = 0x400; i < 0x800; i++) {
+
+        seed = seed * 1103515245 + 12345;
+        ram[i] = u8(seed >> 16);
+    }
+    std::memcpy(ram + 0x300, cpuProgram, sizeof(cpuProgram));
+    ram[0x10] = 0x00;
+    ram[0x11] = 0x07;
+
+    // Setup the CPU
+    cpu.reset<C>();
+    cpu.reg.pc = cpu.reg.pc0 = 0x300;
+
+    utl::Clock clock;
+
+    for (i64 i = 0; i < cycles; i++) {
+
+        cpu.clock++;
+        if constexpr (threaded) {
+            cpu.executeThreaded<C, false>();
+        } else {
+            cpu.executeSwitched<C>();
+        }
+    }
+
+    return clock.stop().asSeconds();
+}
+
+
+//
+// Heatmap benchmark
+//
+
+// Creates the memory accesses of a frame (a loop over some hot pages and a block copy)
+std::vector<u16>
+heatmapTrace(isize frame)
+{
+    static constexpr u8 hot[] = { 0x00, 0x01, 0x03, 0x04, 0xC0, 0xD0, 0xD4, 0xDC, 0xE5, 0xEA };
+
+    std::vector<u16> trace;
+    u32 seed = u32(frame) + 1;
+
+    for (isize i = 0; i < 14000; i++) {
+
+        seed = seed * 1103515245 + 12345;
+        trace.push_back(u16(hot[(seed >> 16) % sizeof(hot)] << 8 | (seed >> 8 & 0xFF)));
+    }
+    for (isize i = 0; i < 3000; i++) {
+
+        auto offset = u16((frame % 40) * 0x100 + i);
+        trace.push_back(u16(0x2000 + offset));
+        trace.push_back(u16(0x8000 + offset));
+    }
+    return trace;
+}
+
+}
+
+std::map<string, string> Benchmarks::baseline;
+std::map<string, string> Benchmarks::results;
+
+void
+Benchmarks::run(const fs::path &path)
+{
+    // Record the baseline if it does not exist yet
+    bool recording = !path.empty() && !utl::fileExists(path);
+
+    if (!path.empty() && !recording) {
+
+        std::ifstream stream(path);
+        if (!stream.is_open()) throw IOError(IOError::FILE_NOT_FOUND, path);
+
+        string key, value;
+        while (stream >> key >> value) baseline[key] = value;
+        printf("Baseline: %s\n\n", path.string().c_str());
+    }
+
+    scheduler();
+    rewind();
+    mixer();
+    cpu();
+    drive();
+    video();
+    canvas();
+    monitor();
+    turbo();
+    heatmap();
+    snapshots();
+    autoSnapshots();
+    compressors();
+    checksums();
+    mediaFiles();
+
+    if (recording) {
+
+        std::ofstream stream(path);
+        if (!stream.is_open()) throw IOError(IOError::FILE_CANT_WRITE, path);
+
+        for (auto &[key, value] : results) stream << key << " " << value << std::endl;
+        printf("Recorded the baseline in %s\n\n", path.string().c_str());
+    }
+}
+
+void
+Benchmarks::report(const string &key, const char *name, double value, const char *unit, const char *state)
+{
+    char previous[32] = "-", current[32], speedup[32] = "-";
+    snprintf(current, sizeof(current), "%.2f %s", value, unit);
+
+    if (auto it = baseline.find(key); it != baseline.end()) {
+
+        auto old = std::stod(it->second);
+        snprintf(previous, sizeof(previous), "%.2f %s", old, unit);
+        snprintf(speedup, sizeof(speedup), "%.2fx", value > 0.0 ? old / value : 0.0);
+    }
+    results[key] = std::to_string(value);
+
+    printf("%20s %12s %12s %9s %12s\n", name, previous, current, speedup, state);
+}
+
+const char *
+Benchmarks::compare(const string &key, const string &digest)
+{
+    results[key] = digest;
+
+    auto it = baseline.find(key);
+    return it == baseline.end() ? "-" : it->second == digest ? "Identical" : "MISMATCH";
+}
+
+const char *
+Benchmarks::compare(const string &key, double value, double tolerance)
+{
+    results[key] = std::to_string(value);
+
+    auto it = baseline.find(key);
+    if (it == baseline.end()) return "-";
+
+    auto old = std::stod(it->second);
+    return std::abs(value - old) <= tolerance * std::abs(old) ? "Identical" : "MISMATCH";
+}
+
+void
+Benchmarks::scheduler()
+{
+    static constexpr Cycle cycles = 20 * PAL::CYCLES_PER_SECOND;
+
+    // Describes an event source by its slot and the period of its events
+    using Schedule = void (C64::*)(Cycle, EventID, i64);
+    struct Source { Schedule schedule; EventSlot slot; EventID id; i64 data; Cycle period; Cycle jitter; };
+
+    // Sources with a cheap handler, so that the scheduler dominates the time
+    Source txd = { &C64::scheduleAbs<SLOT_TXD>, SLOT_TXD, TXD_BIT, 1, PAL::CYCLES_PER_SECOND / 38400, 0 };
+    Source ser = { &C64::scheduleAbs<SLOT_SER>, SLOT_SER, SER_UPDATE, 0, 64, 64 };
+    Source exp = { &C64::scheduleAbs<SLOT_EXP>, SLOT_EXP, EXP_REU_INITIATE, 0, 1000, 0 };
+    Source ala = { &C64::scheduleAbs<SLOT_ALA>, SLOT_ALA, ALA_TRIGGER, 0, 5000, 500 };
+    Source srv = { &C64::scheduleAbs<SLOT_SRV>, SLOT_SRV, SRV_LAUNCH_DAEMON, 0, PAL::CYCLES_PER_SECOND / 2, 0 };
+
+    struct Workload { const char *key; const char *name; std::vector<Source> sources; };
+    std::vector<Workload> workloads = {
+
+        { "scheduler.rs232", "RS232 (38400 baud)", { txd, srv } },
+        { "scheduler.iec", "Serial bus", { ser, srv } },
+        { "scheduler.mixed", "Mixed", { txd, ser, exp, ala, srv } }
+    };
+
+    // Runs a workload and returns the number of serviced events and the elapsed time
+    auto run = [&](const Workload &workload) {
+
+        auto emulator = std::make_unique<Emulator>();
+        emulator->launch(nullptr, nullptr);
+        auto &c64 = emulator->main;
+
+        // Start with an empty scheduler and let inspection events run in the background
+        c64.cancel<SLOT_CIA1>();
+        c64.cancel<SLOT_CIA2>();
+        c64.cancel<SLOT_SRV>();
+        c64.cancel<SLOT_SNP>();
+        c64.scheduleAbs<SLOT_INS>(0, INS_INSPECT, 0);
+
+        u32 seed = 1;
+        auto schedule = [&](const Source &source, Cycle now) {
+
+            auto period = source.period;
+            if (source.jitter) {
+
+                seed = seed * 1103515245 + 12345;
+                period += (seed >> 16) % source.jitter;
+            }
+            (c64.*source.schedule)(now + period, source.id, source.data);
+        };
+        for (auto &source : workload.sources) schedule(source, 0);
+
+        i64 events = 0;
+        utl::Clock clock;
+
+        // Skip idle cycles to measure the scheduler only
+        for (Cycle cycle = 0; cycle < cycles; cycle = c64.nextTrigger) {
+
+            c64.cpu.clock = cycle;
+            c64.processEvents(cycle);
+
+            // Reschedule all sources whose event has been serviced
+            for (auto &source : workload.sources) {
+
+                auto trigger = c64.trigger[source.slot];
+                if (trigger <= cycle || trigger == NEVER) { schedule(source, cycle); events++; }
+            }
+        }
+        auto elapsed = clock.stop().asSeconds();
+
+        emulator->put(Cmd::HALT);
+        emulator->join();
+
+        return std::pair { events, double(elapsed) };
+    };
+
+    printf("Event scheduler (%lld cycles per run)\n\n", (long long)cycles);
+    printf("%20s %12s %12s %9s %12s\n", "", "Baseline", "Current", "Speedup", "Events");
+
+    for (auto &workload : workloads) {
+
+        i64 events = 0;
+        double time = INFINITY;
+
+        // Keep the best of three runs to filter out scheduling noise
+        for (isize i = 0; i < 3; i++) {
+
+            auto [count, elapsed] = run(workload);
+            events = count;
+            time = std::min(time, elapsed);
+        }
+
+        auto state = compare(string(workload.key) + ".events", std::to_string(events));
+        report(workload.key, workload.name, 1e9 * time / double(events), "ns", state);
+    }
+    printf("\n");
+}
+
+void
+Benchmarks::rewind()
+{
+    static constexpr isize frames = 200;
+
+    auto emulator = std::make_unique<Emulator>();
+    emulator->launch(nullptr, nullptr);
+    auto &c64 = emulator->main;
+    c64.installOpenRoms();
+
+    // Boot and insert a disk to have some variety in the machine state
+    emulator->powerOn();
+    for (isize f = 0; f < 150; f++) c64.computeFrame();
+    c64.drive8.insertNewDisk(FSFormat::CBM, "BENCHMARK");
+    for (isize f = 0; f < 50; f++) c64.computeFrame();
+
+    printf("Rewind buffer (%ld frames per run, emulator thread only)\n\n", frames);
+    printf("%20s %12s %12s %9s %12s\n", "", "Baseline", "Current", "Speedup", "Restore");
+
+    double elapsed = INFINITY;
+    bool match = true;
+
+    // Keep the best of three runs to filter out scheduling noise
+    for (isize run = 0; run < 3; run++) {
+
+        double sum = 0.0;
+        u64 expected = 0;
+
+        emulator->rewinder.setBudget(64 * 1024 * 1024);
+
+        for (isize f = 0; f < frames; f++) {
+
+            c64.computeFrame();
+            if (f == frames - 20) expected = c64.checksum(true);
+
+            // Measure the CPU time spent on the emulator thread
+            auto t0 = threadTime();
+            emulator->rewinder.record(c64);
+            sum += threadTime() - t0;
+
+            // In real time, the encoder thread finishes long before the next frame
+            emulator->rewinder.flush();
+        }
+
+        // Rewinding must restore the recorded state
+        emulator->rewinder.restore(c64, 19);
+        match &= c64.checksum(true) == expected;
+
+        emulator->rewinder.setBudget(0);
+
+        elapsed = std::min(elapsed, sum / double(frames));
+    }
+
+    report("rewind.record", "Record (per frame)", 1e6 * elapsed, "us", match ? "Identical" : "MISMATCH");
+    printf("\n");
+
+    // Terminate the emulator thread
+    emulator->put(Cmd::HALT);
+    emulator->join();
+}
+
+void
+Benchmarks::mixer()
+{
+    static constexpr isize frames = 20000;
+    static constexpr isize samples = 882;
+
+    auto emulator = std::make_unique<Emulator>();
+    emulator->launch(nullptr, nullptr);
+    auto &c64 = emulator->main;
+    auto &port = c64.audioPort;
+
+    // Mix four SIDs with different volumes and pannings
+    emulator->set(Opt::SID_ENABLE, true, { 1, 2, 3 });
+    emulator->set(Opt::AUD_VOL1, 80);
+    emulator->set(Opt::AUD_VOL2, 80);
+    emulator->set(Opt::AUD_VOL3, 60);
+    emulator->set(Opt::AUD_PAN1, -60);
+    emulator->set(Opt::AUD_PAN2, 60);
+    port.unmute();
+
+    u32 seed = 1;
+    double time = INFINITY, level = 0.0;
+    std::vector<SamplePair> out;
+
+    // Writes a frame of pseudo-random samples into the SID streams
+    auto fill = [&]() {
+
+        for (auto &sid : c64.sidBridge.sid) {
+
+            for (isize i = 0; i < samples; i++) {
+
+                seed = seed * 1103515245 + 12345;
+                sid.stream.write(short(seed >> 16));
+            }
+        }
+    };
+
+    printf("Audio mixer (4 SIDs, %ld frames with %ld samples per run)\n\n", frames, samples);
+    printf("%20s %12s %12s %9s %12s\n", "", "Baseline", "Current", "Speedup", "Output");
+
+    // Keep the best of three runs to filter out scheduling noise
+    for (isize run = 0; run < 3; run++) {
+
+        utl::Clock clock;
+        clock.stop();
+        seed = 1;
+
+        for (isize f = 0; f < frames; f++) {
+
+            fill();
+            clock.go();
+            port.generateSamples();
+            clock.stop();
+
+            // Sum up the amplitudes of the first frame
+            if (f == 0) {
+
+                port.copyLatest(out);
+                level = 0.0;
+                for (auto &s : out) level += std::abs(s.l) + std::abs(s.r);
+            }
+            port.stream.clear();
+        }
+
+        time = std::min(time, double(clock.getElapsedTime().asSeconds()));
+    }
+
+    report("mixer.mixing", "Mixing (per sample)",
+           1e9 * time / double(frames * samples), "ns", compare("mixer.level", level, 1e-5));
+    printf("\n");
+
+    // Terminate the emulator thread
+    emulator->put(Cmd::HALT);
+    emulator->join();
+}
+
+void
+Benchmarks::cpu()
+{
+    static constexpr i64 cycles = 50 * PAL::CYCLES_PER_SECOND;
+
+    auto emulator = std::make_unique<Emulator>();
+    emulator->launch(nullptr, nullptr);
+    auto &c64 = emulator->main;
+
+    printf("CPU dispatcher (%lld cycles per run)\n\n", cycles);
+    printf("%20s %12s %12s %9s %12s\n", "", "Switch", "Threaded", "Speedup", "State");
+
+    auto measure = [&]<CPURevision C>(const char *name, peddle::Peddle &cpu, u8 *ram) {
+
+        double time1 = INFINITY, time2 = INFINITY;
+        bool match = true;
+
+        // Keep the best of three runs to filter out scheduling noise
+        for (isize run = 0; run < 3; run++) {
+
+            // Records the CPU state and the used RAM area
+            auto state = [&]() {
+
+                std::vector<u8> result(ram, ram + 0x800);
+                for (auto r : { cpu.reg.a, cpu.reg.x, cpu.reg.y, cpu.reg.sp, cpu.getP() }) {
+                    result.push_back(r);
+                }
+                result.push_back(LO_BYTE(cpu.reg.pc));
+                result.push_back(HI_BYTE(cpu.reg.pc));
+                result.push_back(cpu.inFetchPhase());
+                return result;
+            };
+
+            time1 = std::min(time1, runProgram<C, false>(cpu, ram, cycles));
+            auto state1 = state();
+            time2 = std::min(time2, runProgram<C, true>(cpu, ram, cycles));
+            auto state2 = state();
+
+            match &= state1 == state2;
+        }
+
+        printf("%20s %8.2f MHz %8.2f MHz %8.2fx %12s\n",
+               name,
+               1e-6 * double(cycles) / time1,
+               1e-6 * double(cycles) / time2,
+               time2 > 0.0 ? time1 / time2 : 0.0,
+               match ? "Identical" : "MISMATCH");
+    };
+
+    measure.operator()<CPURevision::MOS_6510>("MOS 6510 (C64)", c64.cpu, c64.mem.ram);
+    measure.operator()<CPURevision::MOS_6502>("MOS 6502 (VC1541)", c64.drive8.cpu, c64.drive8.mem.ram);
+    printf("\n");
+
+    // Terminate the emulator thread
+    emulator->put(Cmd::HALT);
+    emulator->join();
+}
+
+void
+Benchmarks::drive()
+{
+    static constexpr isize cycles = 2000000;
+
+    // Reads GCR bytes after each SYNC mark and folds them into $0300 - $03FF
+    static constexpr u8 firmware[] = {
+
+        0x78,                   // C000  SEI
+        0xA9, 0xEE,             // C001  LDA #$EE
+        0x8D, 0x0C, 0x1C,       // C003  STA $1C0C     Read mode, SOE enabled
+        0xA9, 0x00,             // C006  LDA #$00
+        0x8D, 0x03, 0x1C,       // C008  STA $1C03
+        0xA9, 0x6F,             // C00B  LDA #$6F
+        0x8D, 0x02, 0x1C,       // C00D  STA $1C02
+        0xA9, 0x4C,             // C010  LDA #$4C
+        0x8D, 0x00, 0x1C,       // C012  STA $1C00     Motor on, zone 2
+        0x2C, 0x00, 0x1C,       // C015  BIT $1C00
+        0x30, 0xFB,             // C018  BMI $C015     Wait for SYNC
+        0xAD, 0x01, 0x1C,       // C01A  LDA $1C01
+        0xB8,                   // C01D  CLV
+        0xA0, 0x00,             // C01E  LDY #$00
+        0x50, 0xFE,             // C020  BVC $C020     Wait for byte ready
+        0xB8,                   // C022  CLV
+        0xAD, 0x01, 0x1C,       // C023  LDA $1C01
+        0x59, 0x00, 0x03,       // C026  EOR $0300,Y
+        0x99, 0x00, 0x03,       // C029  STA $0300,Y
+        0xC8,                   // C02C  INY
+        0xD0, 0xF1,             // C02D  BNE $C020
+        0x4C, 0x15, 0xC0        // C02F  JMP $C015
+    };
+
+    auto emulator = std::make_unique<Emulator>();
+    emulator->launch(nullptr, nullptr);
+    auto &c64 = emulator->main;
+    auto &drive = c64.drive8;
+    c64.installOpenRoms();
+
+    // Install the firmware in both drives and connect the first one
+    std::vector<u8> rom(0x4000, 0xEA);
+    std::copy(std::begin(firmware), std::end(firmware), rom.begin());
+
+    // The drive starts at $EAA0 after a reset (see Drive::_didReset)
+    rom[0x2AA0] = 0x4C;
+    rom[0x2AA1] = 0x00;
+    rom[0x2AA2] = 0xC0;
+    c64.drive8.mem.loadRom(rom.data(), isize(rom.size()));
+    c64.drive9.mem.loadRom(rom.data(), isize(rom.size()));
+    c64.drive8.setOption(Opt::DRV_CONNECT, true);
+
+    // Boot, insert a disk, and take a snapshot all runs start from
+    emulator->powerOn();
+    c64.drive8.insertNewDisk(FSFormat::CBM, "BENCHMARK");
+    for (isize f = 0; f < 150; f++) c64.computeFrame();
+    Snapshot snapshot(c64, Compressor::NONE);
+
+    printf("Drive read logic (%ld cycles per run)\n\n", cycles);
+    printf("%20s %12s %12s %9s %12s\n", "", "Per pulse", "Postponed", "Speedup", "State");
+
+    // Runs the drive in the same steps as the C64 does
+    auto measure = [&]<bool lazy>(std::vector<u8> &state) {
+
+        c64.loadSnapshot(snapshot);
+
+        utl::Clock clock;
+        for (isize i = 0; i < cycles; i++) {
+
+            drive.elapsedTime += u64(c64.durationOfOneCycle);
+            drive.catchUp<lazy>();
+        }
+        drive.flushCarries();
+        auto elapsed = double(clock.stop().asSeconds());
+
+        // Record the drive RAM, the CPU state, and the read logic
+        state.assign(drive.mem.ram, drive.mem.ram + 0x800);
+        for (auto r : { drive.cpu.reg.a, drive.cpu.reg.x, drive.cpu.reg.y, drive.cpu.getP() }) {
+            state.push_back(r);
+        }
+        for (auto v : { drive.carryCounter, i64(drive.offset), i64(drive.readShiftreg),
+            i64(drive.counterUF4), i64(drive.byteReadyCounter), i64(drive.sync) }) {
+            state.push_back(u8(v));
+            state.push_back(u8(v >> 8));
+        }
+        return elapsed;
+    };
+
+    double elapsed[2] = { INFINITY, INFINITY };
+    std::vector<u8> state1, state2;
+    bool match = true;
+
+    // Keep the best of three runs to filter out scheduling noise
+    for (isize run = 0; run < 3; run++) {
+
+        elapsed[0] = std::min(elapsed[0], measure.operator()<false>(state1));
+        elapsed[1] = std::min(elapsed[1], measure.operator()<true>(state2));
+        match &= state1 == state2;
+    }
+
+    printf("%20s %8.2f MHz %8.2f MHz %8.2fx %12s\n",
+           "Reading GCR data",
+           1e-6 * double(cycles) / elapsed[0],
+           1e-6 * double(cycles) / elapsed[1],
+           elapsed[1] > 0.0 ? elapsed[0] / elapsed[1] : 0.0,
+           match ? "Identical" : "MISMATCH");
+    printf("\n");
+
+    // Terminate the emulator thread
+    emulator->put(Cmd::HALT);
+    emulator->join();
+}
+
+void
+Benchmarks::video()
+{
+    static constexpr isize frames = 500;
+
+    auto emulator = std::make_unique<Emulator>();
+    emulator->launch(nullptr, nullptr);
+    auto &c64 = emulator->main;
+    c64.installOpenRoms();
+
+    printf("Video (%ld frames per run)\n\n", frames);
+    printf("%20s %12s %12s %9s %12s\n", "", "RGBA", "Paletted", "Speedup", "Texture");
+
+    // Powers on the emulator and waits until the boot screen shows up
+    auto boot = [&](bool paletted) {
+
+        c64.videoPort.setOption(Opt::VID_PALETTED, paletted);
+        emulator->powerOff();
+        emulator->powerOn();
+
+        for (isize f = 0; f < 150; f++) c64.computeFrame(false);
+
+        // Enable all sprites
+        c64.mem.poke(0xD015, 0xFF);
+        for (isize s = 0; s < 8; s++) {
+
+            c64.mem.poke(u16(0xD000 + 2 * s), u8(40 + 24 * s));
+            c64.mem.poke(u16(0xD001 + 2 * s), u8(60 + 16 * s));
+            c64.mem.poke(u16(0xD027 + s), u8(s + 1));
+        }
+    };
+
+    // Runs the emulator and returns the time spent per frame
+    auto measure = [&](bool paletted, std::vector<Texel> &texture) {
+
+        boot(paletted);
+
+        utl::Clock clock;
+        for (isize f = 0; f < frames; f++) c64.computeFrame(false);
+        auto elapsed = clock.stop().asSeconds();
+
+        // Record the visible area of the most recent frame
+        auto *pixels = c64.videoPort.getTexture().pixels.ptr;
+        texture.clear();
+        for (isize y = 16; y < 300; y++) {
+
+            auto *row = pixels + y * Texture::width + PAL::FIRST_VISIBLE_PIXEL;
+            texture.insert(texture.end(), row, row + PAL::VISIBLE_PIXELS);
+        }
+
+        return elapsed / double(frames);
+    };
+
+    // Moves a sprite and returns the average number of changed rows per frame
+    auto track = [&](bool paletted, bool &consistent) {
+
+        boot(paletted);
+
+        std::vector<Texel> previous(Texture::texels);
+        isize total = 0;
+
+        for (isize f = 0; f < frames; f++) {
+
+            auto &texture1 = c64.videoPort.getTexture();
+            std::copy(texture1.pixels.ptr, texture1.pixels.ptr + Texture::texels, previous.begin());
+            auto nr = texture1.nr;
+
+            c64.mem.poke(0xD000, u8(f));
+            c64.computeFrame(false);
+
+            // All rows that are not reported must be unchanged
+            auto &texture2 = c64.videoPort.getTexture();
+            auto rows = c64.videoPort.getChangedRows(nr);
+
+            for (isize y = 0; y < Texture::height; y++) {
+
+                if (rows[y]) continue;
+                auto *row = texture2.pixels.ptr + y * Texture::width;
+                consistent &= std::equal(row, row + Texture::width, previous.begin() + y * Texture::width);
+            }
+            total += isize(rows.count());
+        }
+
+        return double(total) / double(frames);
+    };
+
+    double time1 = INFINITY, time2 = INFINITY;
+    bool match = true, consistent = true;
+
+    // Keep the best of three runs to filter out scheduling noise
+    for (isize run = 0; run < 3; run++) {
+
+        std::vector<Texel> texture1, texture2;
+
+        time1 = std::min(time1, measure(false, texture1));
+        time2 = std::min(time2, measure(true, texture2));
+
+        match &= texture1 == texture2;
+    }
+
+    auto rows1 = track(false, consistent);
+    auto rows2 = track(true, consistent);
+
+    printf("%20s %9.2f us %9.2f us %8.2fx %12s\n",
+           "Frame",
+           1e6 * time1,
+           1e6 * time2,
+           time2 > 0.0 ? time1 / time2 : 0.0,
+           match ? "Identical" : "MISMATCH");
+    printf("%20s %12.1f %12.1f %9s %12s\n\n",
+           "Changed rows",
+           rows1,
+           rows2,
+           "",
+           consistent ? "Consistent" : "MISMATCH");
+
+    // Terminate the emulator thread
+    emulator->put(Cmd::HALT);
+    emulator->join();
+}
+
+void
+Benchmarks::canvas()
+{
+    static constexpr isize rounds = 2000000;
+
+    auto emulator = std::make_unique<Emulator>();
+    emulator->launch(nullptr, nullptr);
+    auto &vic = emulator->main.vic;
+
+    // Let the sequencer draw color indices into a local line
+    u8 line[Texture::width];
+    vic.indexLine = line;
+    vic.bufferoffset = 0;
+
+    // Puts the graphics sequencer into a pseudo-random state
+    auto setup = [&](u32 seed) {
+
+        auto next = [&]() { seed = seed * 1103515245 + 12345; return u8(seed >> 16); };
+
+        auto mode = next() % 5;
+        auto &reg = vic.reg.delayed;
+
+        reg.xscroll = next() & 7;
+        reg.mode = DisplayMode(mode);
+        reg.ctrl1 = (mode & 4 ? 0x40 : 0) | (mode & 2 ? 0x20 : 0);
+        reg.ctrl2 = (mode & 1 ? 0x10 : 0) | reg.xscroll;
+        for (isize i = 0; i < 4; i++) reg.colors[VICIIColorReg::BG_0 + i] = next() & 0xF;
+        vic.reg.current = reg;
+
+        vic.sr.data = next();
+        vic.sr.latchedChr = next();
+        vic.sr.latchedCol = next() & 0xF;
+        vic.sr.colorbits = next() & 3;
+        vic.sr.mcFlop = next() & 1;
+        vic.sr.canLoad = next() & 3;
+        vic.flipflops.delayed.vertical = (next() & 7) == 0;
+        vic.gAccessResult.reset(u32(next()) | u32(next() & 0xF) << 8 | u32(next()) << 16);
+    };
+
+    // Records the drawn pixels and the state of the graphics sequencer
+    auto state = [&]() {
+
+        std::vector<u8> result(line, line + 8);
+        result.insert(result.end(), vic.zBuffer, vic.zBuffer + 8);
+        for (auto r : { vic.sr.data, vic.sr.latchedChr, vic.sr.latchedCol, vic.sr.colorbits }) {
+            result.push_back(r);
+        }
+        result.push_back(vic.sr.mcFlop);
+        return result;
+    };
+
+    double time1 = INFINITY, time2 = INFINITY;
+    bool match = true;
+
+    printf("VICII canvas (%ld cycles per run)\n\n", rounds);
+    printf("%20s %12s %12s %9s %12s\n", "", "Slow path", "Fast path", "Speedup", "Pixels");
+
+    // Compare the results of both paths
+    for (isize i = 0; i < rounds; i++) {
+
+        setup(u32(i));
+        vic.drawCanvasSlowPath <true> ();
+        auto state1 = state();
+
+        setup(u32(i));
+        vic.drawCanvasFastPath <true> ();
+        auto state2 = state();
+
+        match &= state1 == state2;
+    }
+
+    // Measures the time spent in one of the two paths
+    auto measure = [&](auto draw) {
+
+        // Subtract the time needed to setup the sequencer
+        utl::Clock clock1;
+        for (isize i = 0; i < rounds; i++) { setup(u32(i)); }
+        auto setupTime = clock1.stop().asSeconds();
+
+        utl::Clock clock2;
+        for (isize i = 0; i < rounds; i++) { setup(u32(i)); draw(); }
+        auto totalTime = clock2.stop().asSeconds();
+
+        return std::max(0.0, double(totalTime - setupTime));
+    };
+
+    // Keep the best of three runs to filter out scheduling noise
+    for (isize run = 0; run < 3; run++) {
+
+        time1 = std::min(time1, measure([&]() { vic.drawCanvasSlowPath <true> (); }));
+        time2 = std::min(time2, measure([&]() { vic.drawCanvasFastPath <true> (); }));
+    }
+
+    printf("%20s %9.2f ns %9.2f ns %8.2fx %12s\n\n",
+           "Draw 8 pixels",
+           1e9 * time1 / double(rounds),
+           1e9 * time2 / double(rounds),
+           time2 > 0.0 ? time1 / time2 : 0.0,
+           match ? "Identical" : "MISMATCH");
+
+    // Terminate the emulator thread
+    emulator->put(Cmd::HALT);
+    emulator->join();
+}
+
+void
+Benchmarks::monitor()
+{
+    static constexpr isize frames = 20;
+    static constexpr isize width = 1280;
+    static constexpr isize height = 960;
+
+    auto emulator = std::make_unique<Emulator>();
+    emulator->launch(nullptr, nullptr);
+    auto &c64 = emulator->main;
+    c64.installOpenRoms();
+
+    // Run until the boot screen shows up and add some colorful sprites
+    emulator->powerOn();
+    for (isize f = 0; f < 150; f++) c64.computeFrame(false);
+
+    c64.mem.poke(0xD015, 0xFF);
+    for (isize s = 0; s < 8; s++) {
+
+        c64.mem.poke(u16(0xD000 + 2 * s), u8(40 + 24 * s));
+        c64.mem.poke(u16(0xD001 + 2 * s), u8(60 + 16 * s));
+        c64.mem.poke(u16(0xD027 + s), u8(s + 1));
+    }
+    c64.computeFrame(false);
+
+    auto &texture = c64.videoPort.getTexture();
+    auto pal = c64.vic.pal();
+
+    // Start with all effects disabled
+    auto plain = c64.monitor.getConfig();
+    plain.upscaler = Upscaler::NONE;
+    plain.blur = false;
+    plain.bloom = false;
+    plain.dotmask = Dotmask::NONE;
+    plain.scanlines = Scanlines::NONE;
+    plain.disalignment = false;
+
+    struct Effect { const char *name; std::function<void(MonitorConfig &)> enable; };
+
+    std::vector<Effect> effects = {
+
+        { "None", [](MonitorConfig &) { } },
+        { "EPX upscaler", [](MonitorConfig &c) { c.upscaler = Upscaler::EPX_2X; } },
+        { "xBR upscaler", [](MonitorConfig &c) { c.upscaler = Upscaler::XBR_4X; } },
+        { "Blur", [](MonitorConfig &c) { c.blur = true; c.blurRadius = 500; } },
+        { "Bloom", [](MonitorConfig &c) { c.bloom = true; } },
+        { "Dot mask", [](MonitorConfig &c) { c.dotmask = Dotmask::TRISECTED_SHIFTED; } },
+        { "Scanlines (texture)", [](MonitorConfig &c) { c.scanlines = Scanlines::EMBEDDED; } },
+        { "Scanlines (overlay)", [](MonitorConfig &c) { c.scanlines = Scanlines::SUPERIMPOSE; } },
+        { "Misalignment", [](MonitorConfig &c) { c.disalignment = true; c.disalignmentH = 750; } },
+        { "All", [&](MonitorConfig &c) {
+
+            for (isize i = 1; i < isize(effects.size()) - 1; i++) effects[i].enable(c);
+        } }
+    };
+
+    PostProcessor single(1), multi;
+
+    printf("Monitor effects (%ld x %ld, %ld threads)\n\n", width, height, multi.getThreads());
+    printf("%20s %12s %12s %9s %12s\n", "", "1 thread", "All threads", "Speedup", "Frame");
+
+    // Renders multiple frames and returns the time spent per frame
+    auto measure = [&](PostProcessor &processor, const MonitorConfig &config, std::vector<u32> &frame) {
+
+        double best = INFINITY;
+        const u32 *pixels = nullptr;
+
+        // Keep the best of three runs to filter out scheduling noise
+        for (isize run = 0; run < 3; run++) {
+
+            utl::Clock clock;
+            for (isize f = 0; f < frames; f++) pixels = processor.apply(texture, config, pal, width, height);
+            best = std::min(best, double(clock.stop().asSeconds()) / double(frames));
+        }
+
+        frame.assign(pixels, pixels + width * height);
+        return best;
+    };
+
+    for (auto &effect : effects) {
+
+        auto config = plain;
+        effect.enable(config);
+
+        std::vector<u32> frame1, frame2;
+        auto time1 = measure(single, config, frame1);
+        auto time2 = measure(multi, config, frame2);
+
+        printf("%20s %9.2f ms %9.2f ms %8.2fx %12s\n",
+               effect.name,
+               1e3 * time1,
+               1e3 * time2,
+               time2 > 0.0 ? time1 / time2 : 0.0,
+               frame1 == frame2 ? "Identical" : "MISMATCH");
+    }
+
+    // Let the post processor adapt to a frame rate of 50 Hz
+    auto config = plain;
+    effects.back().enable(config);
+
+    PostProcessor limited(1);
+    limited.budget = 0.02;
+
+    double elapsed = 0.0;
+    for (isize f = 0; f < 10; f++) {
+
+        utl::Clock clock;
+        limited.apply(texture, config, pal, width, height);
+        elapsed = clock.stop().asSeconds();
+    }
+
+    printf("%20s %9.2f ms %12s %9s %12s\n\n",
+           "All (20 ms budget)",
+           1e3 * elapsed,
+           "", "",
+           ("Level " + std::to_string(limited.level)).c_str());
+
+    // Terminate the emulator thread
+    emulator->put(Cmd::HALT);
+    emulator->join();
+}
+
+void
+Benchmarks::turbo()
+{
+    static constexpr isize frames = 500;
+
+    /* Samples OSC3 and ENV3 and retriggers voice 3 every 256 iterations. At
+     * the same time, sprite 0 is moved across sprite 1 and the text screen,
+     * and the collision registers are recorded.
+     */
+    static constexpr u8 program[] = {
+
+        0xA9, 0xFF,             // C000  LDA #$FF
+        0x8D, 0x0E, 0xD4,       // C002  STA $D40E
+        0x8D, 0x0F, 0xD4,       // C005  STA $D40F
+        0xA9, 0x09,             // C008  LDA #$09
+        0x8D, 0x13, 0xD4,       // C00A  STA $D413
+        0xA9, 0x00,             // C00D  LDA #$00
+        0x8D, 0x14, 0xD4,       // C00F  STA $D414
+        0xA9, 0x81,             // C012  LDA #$81
+        0x8D, 0x12, 0xD4,       // C014  STA $D412
+        0xA2, 0x00,             // C017  LDX #$00
+        0xAD, 0x1B, 0xD4,       // C019  LDA $D41B
+        0x5D, 0x00, 0xC1,       // C01C  EOR $C100,X
+        0x9D, 0x00, 0xC1,       // C01F  STA $C100,X
+        0xAD, 0x1C, 0xD4,       // C022  LDA $D41C
+        0x5D, 0x00, 0xC2,       // C025  EOR $C200,X
+        0x9D, 0x00, 0xC2,       // C028  STA $C200,X
+        0xE8,                   // C02B  INX
+        0xD0, 0xEB,             // C02C  BNE $C019
+        0xAD, 0xFF, 0xC0,       // C02E  LDA $C0FF
+        0x49, 0x01,             // C031  EOR #$01
+        0x8D, 0xFF, 0xC0,       // C033  STA $C0FF
+        0x09, 0x80,             // C036  ORA #$80
+        0x8D, 0x12, 0xD4,       // C038  STA $D412
+        0xEE, 0x00, 0xD0,       // C03B  INC $D000
+        0xAC, 0xFE, 0xC0,       // C03E  LDY $C0FE
+        0xAD, 0x1E, 0xD0,       // C041  LDA $D01E
+        0x99, 0x00, 0xC3,       // C044  STA $C300,Y
+        0xAD, 0x1F, 0xD0,       // C047  LDA $D01F
+        0x99, 0x00, 0xC4,       // C04A  STA $C400,Y
+        0xEE, 0xFE, 0xC0,       // C04D  INC $C0FE
+        0x4C, 0x19, 0xC0        // C050  JMP $C019
+    };
+
+    auto emulator = std::make_unique<Emulator>();
+    emulator->launch(nullptr, nullptr);
+    auto &c64 = emulator->main;
+    c64.installOpenRoms();
+
+    printf("Turbo profile (%ld frames per run)\n\n", frames);
+    printf("%20s %12s %12s %9s %12s\n", "", "Time", "Emulated", "Speedup", "State");
+
+    // Enable the debug features the profile is supposed to skip
+    c64.mem.setOption(Opt::MEM_HEATMAP, true);
+    c64.vic.dmaDebugger.setOption(Opt::DMA_DEBUG_ENABLE, true);
+
+    // Boot, start the program, and take a snapshot all runs start from
+    emulator->powerOn();
+    for (isize f = 0; f < 150; f++) c64.computeFrame();
+
+    for (isize i = 0; i < isize(sizeof(program)); i++) c64.mem.ram[0xC000 + i] = program[i];
+    c64.mem.ram[0xC0FE] = 0x00;
+    c64.mem.ram[0xC0FF] = 0x00;
+    for (isize i = 0; i < 9; i++) c64.mem.ram[0x0277 + i] = u8("SYS49152\r"[i]);
+    c64.mem.ram[0xC6] = 9;
+
+    for (isize f = 0; f < 10; f++) c64.computeFrame();
+
+    // Place two solid sprites in front of a row of solid characters
+    for (isize i = 0; i < 63; i++) c64.mem.ram[0x0340 + i] = 0xFF;
+    for (isize i = 0; i < 40; i++) c64.mem.ram[0x0400 + 3 * 40 + i] = 0xA0;
+    c64.mem.ram[0x07F8] = c64.mem.ram[0x07F9] = 0x0D;
+    c64.mem.poke(0xD000, 0x00);
+    c64.mem.poke(0xD001, 0x50);
+    c64.mem.poke(0xD002, 0xA0);
+    c64.mem.poke(0xD003, 0x58);
+    c64.mem.poke(0xD015, 0x03);
+
+    Snapshot snapshot(c64, Compressor::NONE);
+
+    // Runs the test program and returns the time spent per frame
+    auto measure = [&](bool video, bool audio, bool debug, std::vector<u8> &state) {
+
+        c64.loadSnapshot(snapshot);
+        c64.setOption(Opt::C64_SKIP_VIDEO, video);
+        c64.setOption(Opt::C64_SKIP_AUDIO, audio);
+        c64.setOption(Opt::C64_SKIP_DEBUG, debug);
+
+        utl::Clock clock;
+        for (isize f = 0; f < frames; f++) c64.computeFrame();
+        auto elapsed = clock.stop().asSeconds();
+
+        // Record the RAM contents and the CPU state
+        state.assign(c64.mem.ram, c64.mem.ram + 0x10000);
+        for (auto r : { c64.cpu.reg.a, c64.cpu.reg.x, c64.cpu.reg.y, c64.cpu.reg.sp, c64.cpu.getP() }) {
+            state.push_back(r);
+        }
+        state.push_back(LO_BYTE(c64.cpu.reg.pc));
+        state.push_back(HI_BYTE(c64.cpu.reg.pc));
+
+        return elapsed / double(frames);
+    };
+
+    auto cyclesPerFrame = double(c64.vic.getCyclesPerFrame());
+    double reference = 0.0;
+    std::vector<u8> expected;
+
+    struct { const char *name; bool video, audio, debug; } profiles[] = {
+
+        { "Default",            false,  false,  false   },
+        { "Skip video",         true,   false,  false   },
+        { "Skip audio",         false,  true,   false   },
+        { "Skip debug",         false,  false,  true    },
+        { "Turbo",              true,   true,   true    }
+    };
+
+    for (auto &profile : profiles) {
+
+        double time = INFINITY;
+        bool match = true;
+
+        // Keep the best of three runs to filter out scheduling noise
+        for (isize run = 0; run < 3; run++) {
+
+            std::vector<u8> state;
+            time = std::min(time, measure(profile.video, profile.audio, profile.debug, state));
+
+            if (expected.empty()) expected = state;
+            match &= state == expected;
+        }
+        if (reference == 0.0) reference = time;
+
+        printf("%20s %9.3f ms %8.2f MHz %8.2fx %12s\n",
+               profile.name,
+               1000.0 * time,
+               1e-6 * cyclesPerFrame / time,
+               time > 0.0 ? reference / time : 0.0,
+               match ? "Identical" : "MISMATCH");
+    }
+    printf("\n");
+
+    // Terminate the emulator thread
+    emulator->put(Cmd::HALT);
+    emulator->join();
+}
+
+void
+Benchmarks::heatmap()
+{
+    static constexpr isize frames = 500;
+
+    std::vector<std::vector<u16>> traces;
+    for (isize f = 0; f < frames; f++) traces.push_back(heatmapTrace(f));
+
+    printf("Heatmap (%ld frames per run)\n\n", frames);
+    printf("%20s %12s %12s %9s %12s\n", "", "Baseline", "Current", "Speedup", "Image");
+
+    std::vector<u32> image(65536);
+    double record = INFINITY, update = INFINITY, draw = INFINITY;
+
+    // Keep the best of three runs to filter out scheduling noise
+    for (isize run = 0; run < 3; run++) {
+
+        auto heatmap = std::make_unique<Heatmap>();
+
+        utl::Clock recordClock, updateClock, drawClock;
+        recordClock.stop();
+        updateClock.stop();
+        drawClock.stop();
+
+        for (auto &trace : traces) {
+
+            recordClock.go();
+            for (auto addr : trace) heatmap->record(addr);
+            recordClock.stop();
+
+            updateClock.go();
+            heatmap->update();
+            updateClock.stop();
+        }
+
+        drawClock.go();
+        heatmap->draw(image.data(), 256, 256);
+        drawClock.stop();
+
+        record = std::min(record, recordClock.getElapsedTime().asSeconds() / double(frames));
+        update = std::min(update, updateClock.getElapsedTime().asSeconds() / double(frames));
+        draw = std::min(draw, double(drawClock.getElapsedTime().asSeconds()));
+    }
+
+    auto digest = utl::Hashable::fnv64((const u8 *)image.data(), isize(image.size() * sizeof(u32)));
+    auto state = compare("heatmap.image", std::to_string(digest));
+
+    report("heatmap.record", "Record accesses", 1e6 * record, "us", state);
+    report("heatmap.update", "Update", 1e6 * update, "us", state);
+    report("heatmap.draw", "Draw", 1e6 * draw, "us", state);
+    printf("\n");
+}
+
+void
+Benchmarks::snapshots()
+{
+    static constexpr isize rounds = 50;
+
+    auto emulator = std::make_unique<Emulator>();
+    emulator->launch(nullptr, nullptr);
+    auto &c64 = emulator->main;
+    c64.installOpenRoms();
+
+    // Boot and insert a disk to have some variety in the machine state
+    emulator->powerOn();
+    for (isize f = 0; f < 150; f++) c64.computeFrame();
+    c64.drive8.insertNewDisk(FSFormat::CBM, "BENCHMARK");
+    for (isize f = 0; f < 50; f++) c64.computeFrame();
+
+    auto expected = c64.checksum(true);
+
+    printf("Snapshots (%ld rounds per run)\n\n", rounds);
+    printf("%20s %12s %12s %9s %12s\n", "", "Legacy", "Native", "Speedup", "State");
+
+    double save[2] = { INFINITY, INFINITY };
+    double restore[2] = { INFINITY, INFINITY };
+    isize size[2] = { }, compressed[2] = { };
+    bool match = true;
+
+    for (auto format : { SerFormat::LEGACY, SerFormat::NATIVE }) {
+
+        auto i = format == SerFormat::LEGACY ? 0 : 1;
+
+        // Keep the best of three runs to filter out scheduling noise
+        for (isize run = 0; run < 3; run++) {
+
+            std::unique_ptr<Snapshot> snapshot;
+
+            utl::Clock clock;
+            for (isize r = 0; r < rounds; r++) snapshot = std::make_unique<Snapshot>(c64, format);
+            save[i] = std::min(save[i], clock.restart().asSeconds() / double(rounds));
+
+            for (isize r = 0; r < rounds; r++) c64.loadSnapshot(*snapshot);
+            restore[i] = std::min(restore[i], clock.stop().asSeconds() / double(rounds));
+
+            match &= c64.checksum(true) == expected;
+
+            size[i] = snapshot->getSize() - isize(sizeof(SnapshotHeader));
+            snapshot->compress(Compressor::LZ4);
+            compressed[i] = snapshot->getSize() - isize(sizeof(SnapshotHeader));
+        }
+    }
+
+    auto print = [&](const char *name, double value1, double value2, const char *unit) {
+
+        printf("%20s %9.2f %s %9.2f %s %8.2fx %12s\n",
+               name,
+               value1, unit,
+               value2, unit,
+               value2 > 0.0 ? value1 / value2 : 0.0,
+               match ? "Identical" : "MISMATCH");
+    };
+
+    print("Size", double(size[0]) / 1024.0, double(size[1]) / 1024.0, "KB");
+    print("Size (LZ4)", double(compressed[0]) / 1024.0, double(compressed[1]) / 1024.0, "KB");
+    print("Save", 1e3 * save[0], 1e3 * save[1], "ms");
+    print("Restore", 1e3 * restore[0], 1e3 * restore[1], "ms");
+    printf("\n");
+
+    // Terminate the emulator thread
+    emulator->put(Cmd::HALT);
+    emulator->join();
+}
+
+void
+Benchmarks::autoSnapshots()
+{
+    static constexpr isize rounds = 20;
+
+    auto emulator = std::make_unique<Emulator>();
+    emulator->launch(nullptr, nullptr);
+    auto &c64 = emulator->main;
+    c64.installOpenRoms();
+
+    emulator->powerOn();
+    for (isize f = 0; f < 150; f++) c64.computeFrame();
+
+    printf("Auto-snapshots (fastest of %ld rounds, emulator thread only)\n\n", rounds);
+    printf("%20s %12s %12s %9s %12s\n", "", "Synchronous", "Worker", "Speedup", "Snapshot");
+
+    // Drains the snapshots the worker has handed over
+    auto collect = [&](std::vector<std::unique_ptr<Snapshot>> &result) {
+
+        Message msg;
+        while (c64.msgQueue.get(msg)) {
+            if (msg.type == Msg::SNAPSHOT_TAKEN) result.emplace_back((Snapshot *)msg.snapshot.snapshot);
+        }
+    };
+
+    for (auto compressor : { Compressor::NONE, Compressor::RLE3, Compressor::LZ4 }) {
+
+        double elapsed[2] = { INFINITY, INFINITY };
+        bool match = true;
+
+        // Keep the best of three runs to filter out scheduling noise
+        for (isize run = 0; run < 3; run++) {
+
+            std::vector<std::unique_ptr<Snapshot>> sync, async;
+
+            // The former implementation compressed on the emulator thread
+            utl::Clock clock;
+            for (isize r = 0; r < rounds; r++) {
+
+                clock.restart();
+                sync.emplace_back(c64.takeSnapshot(compressor));
+                elapsed[0] = std::min(elapsed[0], double(clock.stop().asSeconds()));
+            }
+
+            // Leave the worker enough time to finish a snapshot in between
+            for (isize r = 0; r < rounds; r++) {
+
+                clock.restart();
+                emulator->snapshotWorker.capture(c64, compressor);
+                elapsed[1] = std::min(elapsed[1], double(clock.stop().asSeconds()));
+                emulator->snapshotWorker.flush();
+            }
+            collect(async);
+
+            // Both implementations must produce the same snapshot
+            match &= async.size() == sync.size();
+            for (usize i = 0; match && i < sync.size(); i++) {
+
+                sync[i]->uncompress();
+                async[i]->uncompress();
+                match &= sync[i]->getSize() == async[i]->getSize();
+                match &= std::memcmp(sync[i]->getSnapshotData(),
+                                     async[i]->getSnapshotData(),
+                                     sync[i]->getSize() - sizeof(SnapshotHeader)) == 0;
+                auto [width, height] = sync[i]->previewImageSize();
+                match &= async[i]->previewImageSize() == std::pair(width, height);
+                match &= std::memcmp(sync[i]->previewImageData(),
+                                     async[i]->previewImageData(),
+                                     width * height * sizeof(u32)) == 0;
+            }
+        }
+
+        printf("%20s %9.2f ms %9.2f ms %8.2fx %12s\n",
+               CompressorEnum::key(compressor),
+               1e3 * elapsed[0], 1e3 * elapsed[1],
+               elapsed[1] > 0.0 ? elapsed[0] / elapsed[1] : 0.0,
+               match ? "Identical" : "MISMATCH");
+    }
+    printf("\n");
+
+    // Terminate the emulator thread
+    emulator->put(Cmd::HALT);
+    emulator->join();
+}
+
+void
+Benchmarks::compressors()
+{
+    static constexpr isize rounds = 10;
+
+    auto emulator = std::make_unique<Emulator>();
+    emulator->launch(nullptr, nullptr);
+    auto &c64 = emulator->main;
+    c64.installOpenRoms();
+
+    // Boot and insert a disk to have some variety in the machine state
+    emulator->powerOn();
+    for (isize f = 0; f < 150; f++) c64.computeFrame();
+    c64.drive8.insertNewDisk(FSFormat::CBM, "BENCHMARK");
+    for (isize f = 0; f < 50; f++) c64.computeFrame();
+
+    std::vector<u8> state;
+    c64.save(state);
+    auto len = isize(state.size());
+
+    printf("Compressors (%ld KB of snapshot data, %ld rounds per run)\n\n", len / 1024, rounds);
+    printf("%20s %12s %12s %12s %12s\n", "", "Ratio", "Compress", "Uncompress", "Roundtrip");
+
+    for (long i = CompressorEnum::minVal; i <= CompressorEnum::maxVal; i++) {
+
+        auto compressor = Compressor(i);
+        if (compressor == Compressor::NONE) continue;
+
+        if (!Compressible::isSupported(compressor)) {
+
+            printf("%20s %12s %12s %12s %12s\n", CompressorEnum::key(compressor), "n/a", "n/a", "n/a", "n/a");
+            continue;
+        }
+
+        auto encode = [&](std::vector<u8> &result) {
+
+            switch (compressor) {
+
+                case Compressor::GZIP:    Compressible::gzip(state.data(), len, result); break;
+                case Compressor::LZ4:     Compressible::lz4(state.data(), len, result); break;
+                case Compressor::RLE2:    Compressible::rle2(state.data(), len, result); break;
+                case Compressor::RLE3:    Compressible::rle3(state.data(), len, result); break;
+                case Compressor::ZSTD:    Compressible::zstd(state.data(), len, result); break;
+                case Compressor::CHUNKED: Compressible::chunk(state.data(), len, result); break;
+                default:                  break;
+            }
+        };
+        auto decode = [&](std::vector<u8> &data, std::vector<u8> &result) {
+
+            auto *ptr = data.data();
+            auto size = isize(data.size());
+
+            switch (compressor) {
+
+                case Compressor::GZIP:    Compressible::gunzip(ptr, size, result, len); break;
+                case Compressor::LZ4:     Compressible::unlz4(ptr, size, result, len); break;
+                case Compressor::RLE2:    Compressible::unrle2(ptr, size, result, len); break;
+                case Compressor::RLE3:    Compressible::unrle3(ptr, size, result, len); break;
+                case Compressor::ZSTD:    Compressible::unzstd(ptr, size, result, len); break;
+                case Compressor::CHUNKED: Compressible::unchunk(ptr, size, result, len); break;
+                default:                  break;
+            }
+        };
+
+        double encoding = INFINITY, decoding = INFINITY;
+        std::vector<u8> compressed, uncompressed;
+
+        // Keep the best of three runs to filter out scheduling noise
+        for (isize run = 0; run < 3; run++) {
+
+            utl::Clock clock;
+            for (isize r = 0; r < rounds; r++) { compressed.clear(); encode(compressed); }
+            encoding = std::min(encoding, clock.restart().asSeconds() / double(rounds));
+
+            for (isize r = 0; r < rounds; r++) { uncompressed.clear(); decode(compressed, uncompressed); }
+            decoding = std::min(decoding, clock.stop().asSeconds() / double(rounds));
+        }
+
+        auto match = uncompressed == state;
+
+        // Chunks of the chunked format must be accessible individually
+        if (compressor == Compressor::CHUNKED) {
+
+            std::vector<u8> chunk;
+            auto count = Compressible::chunkCount(compressed.data(), isize(compressed.size()));
+
+            for (isize nr = 0; nr < count; nr++) {
+
+                Compressible::extractChunk(compressed.data(), isize(compressed.size()), nr, chunk);
+                match &= std::equal(chunk.begin(), chunk.end(), state.begin() + nr * Compressible::chunkSize);
+            }
+        }
+
+        auto throughput = [&](double seconds) { return double(len) / seconds / (1024.0 * 1024.0); };
+
+        printf("%20s %11.2fx %7.0f MB/s %7.0f MB/s %12s\n",
+               CompressorEnum::key(compressor),
+               double(len) / double(compressed.size()),
+               throughput(encoding), throughput(decoding),
+               match ? "Identical" : "MISMATCH");
+    }
+    printf("\n");
+
+    // Terminate the emulator thread
+    emulator->put(Cmd::HALT);
+    emulator->join();
+}
+
+void
+Benchmarks::checksums()
+{
+    static constexpr isize frames = 100;
+
+    auto emulator = std::make_unique<Emulator>();
+    emulator->launch(nullptr, nullptr);
+    auto &c64 = emulator->main;
+    c64.installOpenRoms();
+
+    // Boot and insert a disk to have some variety in the machine state
+    emulator->powerOn();
+    for (isize f = 0; f < 150; f++) c64.computeFrame();
+    c64.drive8.insertNewDisk(FSFormat::CBM, "BENCHMARK");
+    for (isize f = 0; f < 50; f++) c64.computeFrame();
+
+    // Discards all cached page hashes, which makes the checker hash the full
+    // state as it did before the page hashes have been introduced
+    auto invalidate = [&]() {
+
+        c64.mem.ramPages.markAll();
+        c64.drive8.mem.ramPages.markAll();
+        c64.drive9.mem.ramPages.markAll();
+        if (c64.drive8.disk) c64.drive8.disk->pages.markAll();
+        if (c64.drive9.disk) c64.drive9.disk->pages.markAll();
+    };
+
+    printf("Checksums (%ld frames per run)\n\n", frames);
+    printf("%20s %12s %12s %9s %12s\n", "", "Full", "Incremental", "Speedup", "Checksum");
+
+    double elapsed[2] = { INFINITY, INFINITY };
+    bool match = true;
+
+    // Keep the best of three runs to filter out scheduling noise
+    for (isize run = 0; run < 3; run++) {
+
+        double sum[2] = { };
+
+        for (isize f = 0; f < frames; f++) {
+
+            c64.computeFrame();
+
+            utl::Clock clock;
+            auto incremental = c64.checksum(true);
+            sum[1] += clock.restart().asSeconds();
+
+            invalidate();
+            auto full = c64.checksum(true);
+            sum[0] += clock.stop().asSeconds();
+
+            match &= incremental == full;
+        }
+
+        elapsed[0] = std::min(elapsed[0], sum[0] / double(frames));
+        elapsed[1] = std::min(elapsed[1], sum[1] / double(frames));
+    }
+
+    // The run-ahead instance must agree with the main instance after cloning
+    emulator->cloneRunAheadInstance();
+    match &= emulator->ahead.checksum(true) == c64.checksum(true);
+
+    // Restoring a snapshot must restore the checksum, too
+    auto expected = c64.checksum(true);
+    auto snapshot = std::make_unique<Snapshot>(c64);
+    for (isize f = 0; f < 10; f++) c64.computeFrame();
+    c64.loadSnapshot(*snapshot);
+    match &= c64.checksum(true) == expected;
+
+    printf("%20s %9.2f us %9.2f us %8.2fx %12s\n",
+           "Checksum (per frame)",
+           1e6 * elapsed[0], 1e6 * elapsed[1],
+           elapsed[1] > 0.0 ? elapsed[0] / elapsed[1] : 0.0,
+           match ? "Identical" : "MISMATCH");
+    printf("\n");
+
+    // Terminate the emulator thread
+    emulator->put(Cmd::HALT);
+    emulator->join();
+}
+
+void
+Benchmarks::mediaFiles()
+{
+    static constexpr isize rounds = 20;
+    static constexpr isize pulses = 16 * 1024 * 1024;
+
+    // Create a large TAP file
+    auto path = fs::temp_directory_path() / "vc64benchmark.tap";
+    {
+        u8 header[0x14] = { 'C','6','4','-','T','A','P','E','-','R','A','W', 1 };
+        header[0x10] = u8(pulses);
+        header[0x11] = u8(pulses >> 8);
+        header[0x12] = u8(pulses >> 16);
+        header[0x13] = u8(pulses >> 24);
+
+        std::vector<u8> body(pulses);
+        for (isize i = 0; i < pulses; i++) body[i] = u8(0x30 + (i * 7 + (i >> 9)) % 0x30);
+
+        std::ofstream stream(path, std::ios::binary);
+        stream.write((const char *)header, sizeof(header));
+        stream.write((const char *)body.data(), std::streamsize(body.size()));
+    }
+
+    printf("Media files (%ld MB TAP file, %ld rounds per run)\n\n", pulses >> 20, rounds);
+    printf("%20s %12s %12s %9s %12s\n", "", "Read", "Mapped", "Speedup", "Contents");
+
+    double load[2] = { INFINITY, INFINITY }, scan[2] = { INFINITY, INFINITY };
+    u64 hash[2] = { };
+
+    // Keep the best of three runs to filter out scheduling noise
+    for (isize run = 0; run < 3; run++) {
+
+        for (isize i = 0; i < 2; i++) {
+
+            bool mapped = i == 1;
+
+            // Opening a file for inspecting the header
+            utl::Clock clock;
+            for (isize r = 0; r < rounds; r++) TAPFile file(path, mapped);
+            load[i] = std::min(load[i], double(clock.restart().asSeconds()) / double(rounds));
+
+            // Opening a file and accessing all of its contents
+            for (isize r = 0; r < rounds; r++) hash[i] = TAPFile(path, mapped).fnv64();
+            scan[i] = std::min(scan[i], double(clock.stop().asSeconds()) / double(rounds));
+        }
+    }
+
+    auto match = hash[0] == hash[1];
+
+    printf("%20s %9.2f ms %9.2f ms %8.2fx %12s\n", "Open",
+           1e3 * load[0], 1e3 * load[1], load[1] > 0.0 ? load[0] / load[1] : 0.0,
+           match ? "Identical" : "MISMATCH");
+    printf("%20s %9.2f ms %9.2f ms %8.2fx %12s\n", "Open and scan",
+           1e3 * scan[0], 1e3 * scan[1], scan[1] > 0.0 ? scan[0] / scan[1] : 0.0,
+           match ? "Identical" : "MISMATCH");
+    printf("\n");
+
+    fs::remove(path);
+}
+
+}
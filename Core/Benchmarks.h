@@ -0,0 +1,101 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+/// @file
+
+#pragma once
+
+#include "BasicTypes.h"
+#include <map>
+
+namespace vc64 {
+
+/* Micro benchmarks for performance critical parts of the emulator core. The
+ * benchmarks are executed by VC64Headless (option --perf) and print their
+ * results to stdout. They are meant to be compared across builds and are not
+ * part of the regular test suite.
+ *
+ * Benchmarks with two code paths in the emulator compare both paths directly.
+ * All others measure the code path of the current build and compare it with
+ * a baseline recorded by a previous run, possibly of another build.
+ */
+class Benchmarks {
+
+    // Results loaded from the baseline file
+    static std::map<string, string> baseline;
+
+    // Results of the current run
+    static std::map<string, string> results;
+
+public:
+
+    /* Runs all benchmarks. If a baseline file is given, the results are
+     * compared with the file contents. If the file does not exist, it is
+     * created and the results of the current run are recorded.
+     */
+    static void run(const fs::path &path = { });
+
+    // Measures the event scheduler of class C64 on event-dense workloads
+    static void scheduler();
+
+    // Measures rewind recording on the emulator thread
+    static void rewind();
+
+    // Measures the audio mixer of the audio port
+    static void mixer();
+
+    // Compares the threaded CPU dispatcher with the switch dispatcher
+    static void cpu();
+
+    // Compares postponed carry pulses with executing each pulse on its own
+    static void drive();
+
+    // Compares RGBA textures with paletted textures
+    static void video();
+
+    // Compares the canvas fast path with the canvas slow path
+    static void canvas();
+
+    // Measures the software implementation of the monitor effects
+    static void monitor();
+
+    // Compares the default profile with the turbo profile and its switches
+    static void turbo();
+
+    // Measures recording, updating, and drawing the heatmap
+    static void heatmap();
+
+    // Compares the native snapshot format with the legacy format
+    static void snapshots();
+
+    // Compares asynchronous auto-snapshots with the former synchronous ones
+    static void autoSnapshots();
+
+    // Compares all compressors on snapshot data
+    static void compressors();
+
+    // Compares incremental state checksums with the former full checksums
+    static void checksums();
+
+    // Compares mapped media files with media files read into memory
+    static void mediaFiles();
+
+private:
+
+    // Prints a measurement next to its baseline value and records it
+    static void report(const string &key, const char *name, double value, const char *unit, const char *state);
+
+    // Records a digest of the produced output and compares it with the baseline
+    static const char *compare(const string &key, const string &digest);
+    static const char *compare(const string &key, double value, double tolerance);
+};
+
+}
@@ -0,0 +1,395 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+/// @file
+
+#include "config.h"
+#include "Checks.h"
+#include "C64.h"
+#include "Emulator.h"
+#include "MediaError.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace vc64 {
+
+isize
+Checks::run()
+{
+    isize failures = 0;
+
+    printf("Regression checks\n\n");
+
+    failures += !sidSync();
+    failures += !spriteCollisions();
+    failures += !nativeSnapshots();
+    failures += !checksums();
+    failures += !mediaFiles();
+
+    printf("\n%ld check(s) failed\n", failures);
+    return failures;
+}
+
+bool
+Checks::sidSync()
+{
+    static constexpr isize frames = 100;
+
+    // Records OSC3 and ENV3 while voice 3 is retriggered every 256 iterations
+    static constexpr u8 program[] = {
+
+        0xA9, 0xFF,             // C000  LDA #$FF
+        0x8D, 0x0E, 0xD4,       // C002  STA $D40E
+        0x8D, 0x0F, 0xD4,       // C005  STA $D40F
+        0xA9, 0x09,             // C008  LDA #$09
+        0x8D, 0x13, 0xD4,       // C00A  STA $D413
+        0xA9, 0x00,             // C00D  LDA #$00
+        0x8D, 0x14, 0xD4,       // C00F  STA $D414
+        0xA9, 0x81,             // C012  LDA #$81
+        0x8D, 0x12, 0xD4,       // C014  STA $D412
+        0xA2, 0x00,             // C017  LDX #$00
+        0xAD, 0x1B, 0xD4,       // C019  LDA $D41B
+        0x5D, 0x00, 0xC1,       // C01C  EOR $C100,X
+        0x9D, 0x00, 0xC1,       // C01F  STA $C100,X
+        0xAD, 0x1C, 0xD4,       // C022  LDA $D41C
+        0x5D, 0x00, 0xC2,       // C025  EOR $C200,X
+        0x9D, 0x00, 0xC2,       // C028  STA $C200,X
+        0xE8,                   // C02B  INX
+        0xD0, 0xEB,             // C02C  BNE $C019
+        0xAD, 0xFF, 0xC0,       // C02E  LDA $C0FF
+        0x49, 0x01,             // C031  EOR #$01
+        0x8D, 0xFF, 0xC0,       // C033  STA $C0FF
+        0x09, 0x80,             // C036  ORA #$80
+        0x8D, 0x12, 0xD4,       // C038  STA $D412
+        0x4C, 0x19, 0xC0        // C03B  JMP $C019
+    };
+
+    auto emulator = boot();
+    auto &c64 = emulator->main;
+    auto &sid = c64.sidBridge.sid0;
+
+    start(c64, 0xC000, program, isize(sizeof(program)));
+    Snapshot snapshot(c64, Compressor::NONE);
+
+    // Runs the program and returns the recorded register values
+    auto measure = [&](bool blocked, bool &inSync) {
+
+        c64.loadSnapshot(snapshot);
+        inSync = true;
+
+        for (isize f = 0; f < frames; f++) {
+
+            // Leave no room for new samples
+            if (blocked) while (!sid.stream.isFull()) sid.stream.write(0);
+
+            c64.computeFrame();
+            inSync &= sid.clock == c64.cpu.clock;
+        }
+        return std::vector<u8>(c64.mem.ram + 0xC100, c64.mem.ram + 0xC300);
+    };
+
+    bool inSync1, inSync2;
+    auto expected = measure(false, inSync1);
+    auto blocked = measure(true, inSync2);
+
+    shutdown(emulator);
+
+    return report("SID sync with a full sample buffer", inSync1 && inSync2 && expected == blocked);
+}
+
+bool
+Checks::spriteCollisions()
+{
+    static constexpr isize frames = 300;
+
+    // Records $D01E and $D01F once per frame and moves sprite 0 to the right
+    static constexpr u8 program[] = {
+
+        0xA0, 0x00,             // C000  LDY #$00
+        0xAD, 0x12, 0xD0,       // C002  LDA $D012
+        0xC9, 0xF8,             // C005  CMP #$F8
+        0xD0, 0xF9,             // C007  BNE $C002
+        0xAD, 0x1E, 0xD0,       // C009  LDA $D01E
+        0x99, 0x00, 0xC1,       // C00C  STA $C100,Y
+        0xAD, 0x1F, 0xD0,       // C00F  LDA $D01F
+        0x99, 0x00, 0xC2,       // C012  STA $C200,Y
+        0xEE, 0x00, 0xD0,       // C015  INC $D000
+        0xC8,                   // C018  INY
+        0xAD, 0x12, 0xD0,       // C019  LDA $D012
+        0xC9, 0xF8,             // C01C  CMP #$F8
+        0xF0, 0xF9,             // C01E  BEQ $C019
+        0xD0, 0xE0              // C020  BNE $C002
+    };
+
+    auto emulator = boot();
+    auto &c64 = emulator->main;
+
+    // Place two solid sprites in front of a row of solid characters
+    for (isize i = 0; i < 63; i++) c64.mem.ram[0x0340 + i] = 0xFF;
+    c64.mem.ram[0x07F8] = c64.mem.ram[0x07F9] = 0x0D;
+    c64.mem.poke(0xD000, 0x00);
+    c64.mem.poke(0xD001, 0x50);
+    c64.mem.poke(0xD002, 0xA0);
+    c64.mem.poke(0xD003, 0x58);
+    c64.mem.poke(0xD015, 0x03);
+
+    start(c64, 0xC000, program, isize(sizeof(program)));
+    for (isize i = 0; i < 40; i++) c64.mem.ram[0x0400 + 3 * 40 + i] = 0xA0;
+    Snapshot snapshot(c64, Compressor::NONE);
+
+    // Runs the program and returns the recorded register values
+    auto measure = [&](bool skip) {
+
+        c64.loadSnapshot(snapshot);
+        c64.setOption(Opt::C64_SKIP_VIDEO, skip);
+
+        for (isize f = 0; f < frames; f++) c64.computeFrame();
+        return std::vector<u8>(c64.mem.ram + 0xC100, c64.mem.ram + 0xC300);
+    };
+
+    auto expected = measure(false);
+    auto skipped = measure(true);
+
+    shutdown(emulator);
+
+    // Both kinds of collisions must have been observed
+    auto observed = [&](isize offset) {
+        return std::any_of(expected.begin() + offset, expected.begin() + offset + 256, [](u8 v) { return v != 0; });
+    };
+
+    return report("Sprite collisions with video skipped", observed(0) && observed(256) && expected == skipped);
+}
+
+bool
+Checks::nativeSnapshots()
+{
+    static constexpr isize frames = 50;
+
+    auto emulator = boot();
+    auto &c64 = emulator->main;
+
+    // Insert a disk to have some variety in the machine state
+    c64.drive8.insertNewDisk(FSFormat::CBM, "CHECK");
+    for (isize f = 0; f < frames; f++) c64.computeFrame();
+
+    Snapshot legacy(c64, SerFormat::LEGACY);
+    Snapshot native(c64, SerFormat::NATIVE);
+    auto expected = c64.checksum(true);
+
+    // Pass a copy through the compressed byte representation
+    Snapshot packed(native);
+    packed.compress(Compressor::LZ4);
+    Snapshot unpacked(packed.data.ptr, packed.data.size);
+
+    // Keep running to get the reference state of the restored machines
+    for (isize f = 0; f < frames; f++) c64.computeFrame();
+    auto continued = c64.checksum(true);
+
+    // Restores a snapshot and compares the state with the original machine
+    auto roundTrip = [&](const Snapshot &snapshot) {
+
+        c64.loadSnapshot(snapshot);
+        bool restored = c64.checksum(true) == expected;
+
+        for (isize f = 0; f < frames; f++) c64.computeFrame();
+        return restored && c64.checksum(true) == continued;
+    };
+
+    bool passed = roundTrip(native) && roundTrip(unpacked) && roundTrip(legacy);
+
+    // Saving the restored state must reproduce the snapshot data
+    c64.loadSnapshot(native);
+    Snapshot resaved(c64, SerFormat::NATIVE);
+
+    auto size = native.getSize() - isize(sizeof(SnapshotHeader));
+    passed &= resaved.getSize() == native.getSize();
+    passed &= passed && std::memcmp(resaved.getSnapshotData(), native.getSnapshotData(), size) == 0;
+
+    // Native snapshots from a platform with a different word size must be rejected
+    Snapshot foreign(native);
+    foreign.getHeader()->wordSize = u8(2 * sizeof(long));
+    try {
+        Snapshot rejected(foreign.data.ptr, foreign.data.size);
+        passed = false;
+    } catch (MediaError &) { }
+
+    shutdown(emulator);
+
+    return report("Native snapshot round trip", passed);
+}
+
+bool
+Checks::checksums()
+{
+    static constexpr isize frames = 100;
+
+    // Increments all bytes in pages $20 to $9F, one page after another
+    static constexpr u8 program[] = {
+
+        0xA2, 0x00,             // C000  LDX #$00
+        0xFE, 0x00, 0x20,       // C002  INC $2000,X
+        0xE8,                   // C005  INX
+        0xD0, 0xFA,             // C006  BNE $C002
+        0xEE, 0x04, 0xC0,       // C008  INC $C004
+        0xAD, 0x04, 0xC0,       // C00B  LDA $C004
+        0xC9, 0xA0,             // C00E  CMP #$A0
+        0xD0, 0xEE,             // C010  BNE $C000
+        0xA9, 0x20,             // C012  LDA #$20
+        0x8D, 0x04, 0xC0,       // C014  STA $C004
+        0x4C, 0x00, 0xC0        // C017  JMP $C000
+    };
+
+    auto emulator = boot();
+    auto &c64 = emulator->main;
+
+    // Insert a disk to have some variety in the machine state
+    c64.drive8.insertNewDisk(FSFormat::CBM, "CHECK");
+    start(c64, 0xC000, program, isize(sizeof(program)));
+
+    // Computes the checksum with all cached page hashes discarded
+    auto full = [&]() {
+
+        c64.mem.ramPages.markAll();
+        c64.drive8.mem.ramPages.markAll();
+        c64.drive9.mem.ramPages.markAll();
+        if (c64.drive8.disk) c64.drive8.disk->pages.markAll();
+        if (c64.drive9.disk) c64.drive9.disk->pages.markAll();
+
+        return c64.checksum(true);
+    };
+
+    bool passed = true;
+
+    for (isize f = 0; f < frames; f++) {
+
+        c64.computeFrame();
+
+        auto incremental = c64.checksum(true);
+        passed &= incremental == full();
+    }
+
+    // The run-ahead instance must agree with the main instance after cloning
+    emulator->cloneRunAheadInstance();
+    passed &= emulator->ahead.checksum(true) == c64.checksum(true);
+
+    // Restoring a snapshot must restore the checksum, too
+    auto expected = c64.checksum(true);
+    Snapshot snapshot(c64);
+    for (isize f = 0; f < 10; f++) c64.computeFrame();
+    c64.loadSnapshot(snapshot);
+    passed &= c64.checksum(true) == expected && expected == full();
+
+    shutdown(emulator);
+
+    return report("Incremental checksum", passed);
+}
+
+bool
+Checks::mediaFiles()
+{
+    auto path = fs::temp_directory_path() / "vc64check.tap";
+
+    // Writes a TAP file with the specified number of pulses
+    auto create = [&](isize pulses) {
+
+        u8 header[0x14] = { 'C','6','4','-','T','A','P','E','-','R','A','W', 1 };
+        header[0x10] = u8(pulses);
+        header[0x11] = u8(pulses >> 8);
+        header[0x12] = u8(pulses >> 16);
+        header[0x13] = u8(pulses >> 24);
+
+        std::vector<u8> body(pulses);
+        for (isize i = 0; i < pulses; i++) body[i] = u8(0x30 + (i * 7 + (i >> 9)) % 0x30);
+
+        std::ofstream stream(path, std::ios::binary);
+        stream.write((const char *)header, sizeof(header));
+        stream.write((const char *)body.data(), std::streamsize(body.size()));
+    };
+
+    // Reads the file into memory
+    auto read = [&]() {
+
+        Buffer<u8> buffer(path);
+        return std::make_unique<TAPFile>(buffer.ptr, buffer.size);
+    };
+
+    bool passed = true;
+
+    // Files are only mapped on request, and only if they are large
+    for (isize pulses : { 1024, 256 * 1024 }) {
+
+        create(pulses);
+
+        TAPFile loaded(path);
+        passed &= !loaded.data.isMapped() && loaded.fnv64() == read()->fnv64();
+
+        TAPFile mapped(path, true);
+        passed &= mapped.data.isMapped() == (mapped.data.size >= Buffer<u8>::mapThreshold);
+        passed &= mapped.fnv64() == read()->fnv64();
+    }
+
+    // Modifying a mapped file must not modify the file on disk
+    TAPFile mapped(path, true);
+    auto original = mapped.fnv64();
+    mapped.data[mapped.data.size - 1] ^= 0xFF;
+    passed &= mapped.data.isMapped() && read()->fnv64() == original;
+
+    // Overwriting the mapped file must detach the data first
+    mapped.writeToFile(path);
+    passed &= !mapped.data.isMapped() && read()->fnv64() == mapped.fnv64();
+
+    fs::remove(path);
+
+    return report("Memory-mapped media files", passed);
+}
+
+std::unique_ptr<Emulator>
+Checks::boot()
+{
+    auto emulator = std::make_unique<Emulator>();
+    emulator->launch(nullptr, nullptr);
+    auto &c64 = emulator->main;
+    c64.installOpenRoms();
+
+    emulator->powerOn();
+    for (isize f = 0; f < 150; f++) c64.computeFrame();
+
+    return emulator;
+}
+
+void
+Checks::shutdown(std::unique_ptr<Emulator> &emulator)
+{
+    emulator->put(Cmd::HALT);
+    emulator->join();
+}
+
+void
+Checks::start(C64 &c64, u16 addr, const u8 *program, isize size)
+{
+    for (isize i = 0; i < size; i++) c64.mem.ram[addr + i] = program[i];
+
+    auto command = "SYS" + std::to_string(addr) + "\r";
+    for (isize i = 0; i < isize(command.size()); i++) c64.mem.ram[0x0277 + i] = u8(command[i]);
+    c64.mem.ram[0xC6] = u8(command.size());
+
+    for (isize f = 0; f < 10; f++) c64.computeFrame();
+}
+
+bool
+Checks::report(const char *description, bool passed)
+{
+    printf("%-50s %s\n", description, passed ? "OK" : "FAILED");
+    return passed;
+}
+
+}
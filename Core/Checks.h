@@ -0,0 +1,65 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+/// @file
+
+#pragma once
+
+#include "BasicTypes.h"
+#include <memory>
+
+namespace vc64 {
+
+class C64;
+class Emulator;
+
+/* Regression checks for emulator properties the scripted self tests can't
+ * observe. The checks are executed by VC64Headless (option --check) and are
+ * part of the regular test suite. Each check prints a single result line.
+ */
+class Checks {
+
+public:
+
+    // Runs all checks and returns the number of failed ones
+    static isize run();
+
+    // Checks that SID stays in sync with the CPU while its sample buffer is full
+    static bool sidSync();
+
+    // Checks that the collision registers are updated if video is skipped
+    static bool spriteCollisions();
+
+    // Checks that snapshots in the native format restore the exact state
+    static bool nativeSnapshots();
+
+    // Checks that the incremental state checksum equals the full checksum
+    static bool checksums();
+
+    // Checks that memory-mapped media files match the files read into memory
+    static bool mediaFiles();
+
+private:
+
+    // Creates an emulator instance and boots it with the Open ROMs
+    static std::unique_ptr<Emulator> boot();
+
+    // Terminates the emulator thread
+    static void shutdown(std::unique_ptr<Emulator> &emulator);
+
+    // Copies a machine code program to RAM and starts it via SYS
+    static void start(C64 &c64, u16 addr, const u8 *program, isize size);
+
+    // Prints the result of a single check
+    static bool report(const char *description, bool passed);
+};
+
+}
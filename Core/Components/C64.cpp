@@ -371,6 +371,7 @@ C64::operator << (SerResetter &worker)
         eventid[i] = (EventID)0;
         data[i] = 0;
     }
+    eventQueue.rebuild(trigger);
 
     // Schedule initial events
     scheduleAbs<SLOT_CIA1>(cpu.clock, CIA_EXECUTE);
@@ -385,6 +386,16 @@ C64::operator << (SerResetter &worker)
     rasterCycle = 1;
 }
 
+void
+C64::operator << (SerReader &worker)
+{
+    serialize(worker);
+
+    // Rebuild the event queue from the restored trigger cycles
+    eventQueue.rebuild(trigger);
+    trigger[SLOT_TER] = eventQueue.next();
+}
+
 double
 C64::nativeRefreshRate() const
 {
@@ -693,6 +704,7 @@ C64::update(CmdQueue &queue)
             case Cmd::WARP_ON:
             case Cmd::WARP_OFF:
             case Cmd::HALT:
+            case Cmd::REWIND:
             case Cmd::ALARM_ABS:
             case Cmd::ALARM_REL:
             case Cmd::INSPECTION_TARGET:
@@ -806,7 +818,11 @@ C64::update(CmdQueue &queue)
 void
 C64::computeFrame()
 {
-    if (emulator.get(Opt::VICII_POWER_SAVE)) {
+    bool recording = emulator.isRecording();
+
+    if (config.skipVideo && !recording) {
+        computeFrame(true);
+    } else if (emulator.get(Opt::VICII_POWER_SAVE) && !recording) {
         computeFrame(emulator.isWarping() && (frame & 7) != 0);
     } else {
         computeFrame(false);
@@ -1178,6 +1194,10 @@ C64::endFrame()
     
     vic.endFrame();
     sidBridge.endFrame();
+
+    // Hand the finished frame and its samples over to the recorder
+    if (emulator.isRecording() && !isRunAheadInstance()) emulator.recorder.capture(*this);
+
     mem.endFrame();
     iec.execute();
     expansionport.endOfFrame();
@@ -1212,6 +1232,11 @@ C64::processCommand(const Command &cmd)
             emulator.hardReset();
             break;
             
+        case Cmd::REWIND:
+            
+            emulator.rewind(isize(cmd.value));
+            break;
+            
         case Cmd::SOFT_RESET:
             
             emulator.softReset();
@@ -1296,52 +1321,20 @@ C64::processEvents(Cycle cycle)
             //
             // Check tertiary slots
             //
-            if (isDue<SLOT_EXP>(cycle)) {
-                expansionport.processEvent(eventid[SLOT_EXP]);
-            }
-            if (isDue<SLOT_TXD>(cycle)) {
-                userPort.rs232.processTxdEvent();
-            }
-            if (isDue<SLOT_RXD>(cycle)) {
-                userPort.rs232.processRxdEvent();
-            }
-            if (isDue<SLOT_MOT>(cycle)) {
-                datasette.processMotEvent(eventid[SLOT_MOT]);
-            }
-            if (isDue<SLOT_DC8>(cycle)) {
-                drive8.processDiskChangeEvent(eventid[SLOT_DC8]);
-            }
-            if (isDue<SLOT_DC9>(cycle)) {
-                drive9.processDiskChangeEvent(eventid[SLOT_DC9]);
-            }
-            if (isDue<SLOT_SNP>(cycle)) {
-                processSNPEvent(eventid[SLOT_SNP]);
-            }
-            if (isDue<SLOT_RSH>(cycle)) {
-                retroShell.serviceEvent();
-            }
-            if (isDue<SLOT_KEY>(cycle)) {
-                keyboard.processKeyEvent(eventid[SLOT_KEY]);
-            }
-            if (isDue<SLOT_SRV>(cycle)) {
-                remoteManager.serviceServerEvent();
-            }
-            if (isDue<SLOT_DBG>(cycle)) {
-                regressionTester.processEvent(eventid[SLOT_DBG]);
-            }
-            if (isDue<SLOT_ALA>(cycle)) {
-                processAlarmEvent();
-            }
-            if (isDue<SLOT_INS>(cycle)) {
-                processINSEvent();
+
+            /* Due events are serviced in the order of their slot numbers and
+             * each slot is serviced at most once. An event that is scheduled
+             * for the current cycle by a handler is serviced in the same pass
+             * if its slot number is higher than the slot of the handler.
+             */
+            for (auto s = eventQueue.nextDue(cycle, SLOT_TER); s >= 0;
+                 s = eventQueue.nextDue(cycle, s)) {
+
+                serviceEvent(EventSlot(s));
             }
 
             // Determine the next trigger cycle for all tertiary slots
-            Cycle next = trigger[SLOT_TER + 1];
-            for (isize i = SLOT_TER + 2; i < SLOT_COUNT; i++) {
-                if (trigger[i] < next) next = trigger[i];
-            }
-            rescheduleAbs<SLOT_TER>(next);
+            rescheduleAbs<SLOT_TER>(eventQueue.next());
         }
 
         // Determine the next trigger cycle for all secondary slots
@@ -1360,6 +1353,30 @@ C64::processEvents(Cycle cycle)
     nextTrigger = next;
 }
 
+void
+C64::serviceEvent(EventSlot slot)
+{
+    switch (slot) {
+
+        case SLOT_EXP:  expansionport.processEvent(eventid[SLOT_EXP]); break;
+        case SLOT_TXD:  userPort.rs232.processTxdEvent(); break;
+        case SLOT_RXD:  userPort.rs232.processRxdEvent(); break;
+        case SLOT_MOT:  datasette.processMotEvent(eventid[SLOT_MOT]); break;
+        case SLOT_DC8:  drive8.processDiskChangeEvent(eventid[SLOT_DC8]); break;
+        case SLOT_DC9:  drive9.processDiskChangeEvent(eventid[SLOT_DC9]); break;
+        case SLOT_SNP:  processSNPEvent(eventid[SLOT_SNP]); break;
+        case SLOT_RSH:  retroShell.serviceEvent(); break;
+        case SLOT_KEY:  keyboard.processKeyEvent(eventid[SLOT_KEY]); break;
+        case SLOT_SRV:  remoteManager.serviceServerEvent(); break;
+        case SLOT_DBG:  regressionTester.processEvent(eventid[SLOT_DBG]); break;
+        case SLOT_ALA:  processAlarmEvent(); break;
+        case SLOT_INS:  processINSEvent(); break;
+
+        default:
+            fatalError;
+    }
+}
+
 void
 C64::processINSEvent()
 {
@@ -1627,7 +1644,7 @@ C64::loadSnapshot(const Snapshot &snapshot)
     snap.uncompress();
 
     // Restore the saved state
-    load(snap.getSnapshotData());
+    load(snap.getSnapshotData(), snap.format());
 
     // Inform the GUI
     msgQueue.put(vic.pal() ? Msg::PAL : Msg::NTSC);
@@ -1646,9 +1663,8 @@ C64::processSNPEvent(EventID eventId)
     // Ignore the run-ahead instance
     if (objid != 0) { cancel<SLOT_SNP>(); return; }
 
-    // Take snapshot and hand it over to the GUI
-    auto *snapshot = takeSnapshot(Compressor(data[SLOT_SNP] >> 24));
-    msgQueue.put( Message { .type = Msg::SNAPSHOT_TAKEN, .snapshot = { snapshot } } );
+    // Capture the state and let the snapshot worker hand it over to the GUI
+    emulator.snapshotWorker.capture(*this, Compressor(data[SLOT_SNP] >> 24));
 
     // Schedule the next event
     scheduleNextSNPEvent();
@@ -1901,6 +1917,8 @@ C64::loadRom(const RomFile &file)
             
             throw IOError(IOError::FILE_TYPE_MISMATCH);
     }
+
+    mem.romPages.markAll();
 }
 
 void
@@ -1932,6 +1950,8 @@ C64::deleteRom(RomType type)
         default:
             fatalError;
     }
+
+    mem.romPages.markAll();
 }
 
 void 
@@ -2018,6 +2038,8 @@ C64::installOpenRom(RomType type)
         default:
             fatalError;
     }
+
+    mem.romPages.markAll();
 }
 
 void
@@ -2084,6 +2106,8 @@ C64::flashNew(const AnyFile &file)
         default:
             fatalError;
     }
+
+    mem.romPages.markAll();
 }
 
 void
@@ -2109,6 +2133,7 @@ C64::flashNew(const AnyFile &file, isize nr)
                 // Rectify zero page
                 mem.ram[0x2D] = LO_BYTE(addr + size);   // VARTAB (lo byte)
                 mem.ram[0x2E] = HI_BYTE(addr + size);   // VARTAB (high byte)
+                mem.ramPages.markAll();
                 break;
                 
             default:
@@ -2148,6 +2173,7 @@ C64::flash(const FileSystem &fs, isize nr)
     // Rectify zero page
     mem.ram[0x2D] = LO_BYTE(addr + size);   // VARTAB (lo byte)
     mem.ram[0x2E] = HI_BYTE(addr + size);   // VARTAB (high byte)
+    mem.ramPages.markAll();
     
     msgQueue.put(Msg::FILE_FLASHED);
 }
@@ -13,6 +13,7 @@
 #pragma once
 
 #include "C64Types.h"
+#include "EventQueue.h"
 #include "MsgQueue.h"
 #include "Thread.h"
 
@@ -94,6 +95,8 @@ static constexpr double inspectionInterval = 0.1;
 class C64 final : public CoreComponent, public Inspectable<C64Info> {
 
     friend class Emulator;
+    friend class Benchmarks;
+    friend class Checks;
 
     Descriptions descriptions = {
         {
@@ -116,7 +119,11 @@ class C64 final : public CoreComponent, public Inspectable<C64Info> {
         Opt::C64_WARP_MODE,
         Opt::C64_SPEED_BOOST,
         Opt::C64_VSYNC,
-        Opt::C64_RUN_AHEAD
+        Opt::C64_RUN_AHEAD,
+        Opt::C64_REWIND,
+        Opt::C64_SKIP_VIDEO,
+        Opt::C64_SKIP_AUDIO,
+        Opt::C64_SKIP_DEBUG
     };
     
 private:
@@ -190,6 +197,11 @@ public:
     // Next trigger cycle
     Cycle nextTrigger = NEVER;
 
+    /* All tertiary slots are kept in a priority queue. The trigger cycle of
+     * the earliest tertiary event is mirrored in SLOT_TER.
+     */
+    EventQueue<SLOT_TER + 1, SLOT_COUNT - 1> eventQueue;
+
 
     //
     // Emulator thread
@@ -331,6 +343,7 @@ public:
         CLONE_ARRAY(eventid)
         CLONE_ARRAY(data)
         CLONE(nextTrigger)
+        CLONE(eventQueue)
         CLONE(frame)
         CLONE(scanline)
         CLONE(rasterCycle)
@@ -382,7 +395,7 @@ public:
     void operator << (SerResetter &worker) override;
     void operator << (SerChecker &worker) override { serialize(worker); }
     void operator << (SerCounter &worker) override { serialize(worker); }
-    void operator << (SerReader &worker) override { serialize(worker); }
+    void operator << (SerReader &worker) override;
     void operator << (SerWriter &worker) override { serialize(worker); }
 
 
@@ -568,6 +581,23 @@ public:
     // Processes all pending events
     void processEvents(Cycle cycle);
 
+private:
+
+    // Services a due event in one of the tertiary slots
+    void serviceEvent(EventSlot slot);
+
+    // Propagates a trigger cycle change to the event queue
+    template<EventSlot s> void updateQueue()
+    {
+        if constexpr (isTertiarySlot(s)) {
+
+            eventQueue.update(s, trigger[s]);
+            trigger[SLOT_TER] = eventQueue.next();
+        }
+    }
+
+public:
+
     // Returns true iff the specified slot contains any event
     template<EventSlot s> bool hasEvent() const { return this->eventid[s] != (EventID)0; }
 
@@ -588,9 +618,7 @@ public:
 
         if (cycle < nextTrigger) nextTrigger = cycle;
 
-        if constexpr (isTertiarySlot(s)) {
-            if (cycle < trigger[SLOT_TER]) trigger[SLOT_TER] = cycle;
-        }
+        updateQueue<s>();
         if constexpr (isSecondarySlot(s) || isTertiarySlot(s)) {
             if (cycle < trigger[SLOT_SEC]) trigger[SLOT_SEC] = cycle;
         }
@@ -607,9 +635,7 @@ public:
         trigger[s] = cycle;
         if (cycle < nextTrigger) nextTrigger = cycle;
 
-        if constexpr (isTertiarySlot(s)) {
-            if (cycle < trigger[SLOT_TER]) trigger[SLOT_TER] = cycle;
-        }
+        updateQueue<s>();
         if constexpr (isSecondarySlot(s) || isTertiarySlot(s)) {
             if (cycle < trigger[SLOT_SEC]) trigger[SLOT_SEC] = cycle;
         }
@@ -659,6 +685,8 @@ public:
         eventid[s] = (EventID)0;
         data[s] = 0;
         trigger[s] = NEVER;
+
+        updateQueue<s>();
     }
 
 private:
@@ -192,6 +192,10 @@ C64::getOption(Opt opt) const
         case Opt::C64_SPEED_BOOST:       return (i64)config.speedBoost;
         case Opt::C64_VSYNC:             return (i64)config.vsync;
         case Opt::C64_RUN_AHEAD:         return (i64)config.runAhead;
+        case Opt::C64_REWIND:            return (i64)config.rewind;
+        case Opt::C64_SKIP_VIDEO:        return (i64)config.skipVideo;
+        case Opt::C64_SKIP_AUDIO:        return (i64)config.skipAudio;
+        case Opt::C64_SKIP_DEBUG:        return (i64)config.skipDebug;
 
         default:
             fatalError;
@@ -222,6 +226,9 @@ C64::checkOption(Opt opt, i64 value)
             return;
 
         case Opt::C64_VSYNC:
+        case Opt::C64_SKIP_VIDEO:
+        case Opt::C64_SKIP_AUDIO:
+        case Opt::C64_SKIP_DEBUG:
 
             return;
 
@@ -232,6 +239,13 @@ C64::checkOption(Opt opt, i64 value)
             }
             return;
 
+        case Opt::C64_REWIND:
+
+            if (value < 0 || value > 1024) {
+                throw CoreError(CoreError::OPT_INV_ARG, "0...1024");
+            }
+            return;
+
         default:
             throw CoreError(CoreError::OPT_UNSUPPORTED);
     }
@@ -270,6 +284,26 @@ C64::setOption(Opt opt, i64 value)
             config.runAhead = isize(value);
             return;
 
+        case Opt::C64_REWIND:
+
+            config.rewind = isize(value);
+            return;
+
+        case Opt::C64_SKIP_VIDEO:
+
+            config.skipVideo = bool(value);
+            return;
+
+        case Opt::C64_SKIP_AUDIO:
+
+            config.skipAudio = bool(value);
+            return;
+
+        case Opt::C64_SKIP_DEBUG:
+
+            config.skipDebug = bool(value);
+            return;
+
         default:
             fatalError;
     }
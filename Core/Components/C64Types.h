@@ -310,6 +310,14 @@ typedef struct
     
     //! Number of run-ahead frames (0 = run-ahead is disabled)
     isize runAhead;
+
+    //! Size of the rewind buffer in MB (0 = rewinding is disabled)
+    isize rewind;
+
+    //! Turbo profile (skips work that has no effect on the CPU-visible state)
+    bool skipVideo;
+    bool skipAudio;
+    bool skipDebug;
 }
 C64Config;
 
@@ -39,6 +39,7 @@ CPU::writePort(u8 val)
 
     // When writing to the port register, the last VICII byte appears
     mem.ram[0x0001] = vic.getDataBusPhi1();
+    mem.ramPages.mark(0x0001);
 
     // Switch memory banks
     mem.updatePeekPokeLookupTables();
@@ -68,6 +69,7 @@ CPU::writePortDir(u8 val)
 
     // When writing to the direction register, the last VICII byte appears
     mem.ram[0x0000] = vic.getDataBusPhi1();
+    mem.ramPages.mark(0x0000);
 
     // Switch memory banks
     mem.updatePeekPokeLookupTables();
@@ -247,6 +249,15 @@ CPU::toggleBreakpoint(isize nr)
     debugger.breakpoints.isEnabled(nr) ? disableBreakpoint(nr) : enableBreakpoint(nr);
 }
 
+void
+CPU::setBreakpointCondition(isize nr, const GuardCondition &cond)
+{
+    if (!debugger.breakpoints.guardNr(nr)) throw CoreError(CoreError::BP_NOT_FOUND, nr);
+
+    debugger.breakpoints.setCondition(nr, cond);
+    msgQueue.put(Msg::BREAKPOINT_UPDATED);
+}
+
 void 
 CPU::setEnableBreakpoint(isize nr, bool value)
 {
@@ -321,6 +332,15 @@ CPU::toggleWatchpoint(isize nr)
     debugger.watchpoints.isEnabled(nr) ? disableWatchpoint(nr) : enableWatchpoint(nr);
 }
 
+void
+CPU::setWatchpointCondition(isize nr, const GuardCondition &cond)
+{
+    if (!debugger.watchpoints.guardNr(nr)) throw CoreError(CoreError::WP_NOT_FOUND, nr);
+
+    debugger.watchpoints.setCondition(nr, cond);
+    msgQueue.put(Msg::WATCHPOINT_UPDATED);
+}
+
 void
 CPU::setEnableWatchpoint(isize nr, bool value)
 {
@@ -393,6 +413,19 @@ CPU::readDasm(u16 addr) const
     }
 }
 
+bool
+CPU::hasSideEffects(u16 addr) const
+{
+    switch (id) {
+
+        case 1: return drive8.mem.hasSideEffects(addr);
+        case 2: return drive9.mem.hasSideEffects(addr);
+
+        default:
+            return true;
+    }
+}
+
 u16
 CPU::readResetVector()
 {
@@ -217,6 +217,7 @@ public:
     virtual void write(u16 addr, u8 val) override;
     virtual u16 readResetVector() override;
     virtual u8 readDasm(u16 addr) const override;
+    virtual bool hasSideEffects(u16 addr) const override;
 
     virtual void writePort(u8 val) override;
     virtual void writePortDir(u8 val) override;
@@ -283,6 +284,8 @@ public:
 
     void toggleBreakpoint(isize nr);
 
+    void setBreakpointCondition(isize nr, const GuardCondition &cond);
+
 private:
 
     void setEnableBreakpoint(isize nr, bool value);
@@ -313,6 +316,8 @@ public:
 
     void toggleWatchpoint(isize nr);
 
+    void setWatchpointCondition(isize nr, const GuardCondition &cond);
+
 private:
 
     void setEnableWatchpoint(isize nr, bool value);
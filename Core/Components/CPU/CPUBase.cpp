@@ -30,6 +30,20 @@ CPU::_dump(Category category, std::ostream &os) const
             os << utl::tab(name + " " + std::to_string(i));
             os << utl::hex(guard->addr);
 
+            if (auto &cond = guard->condition; cond.operand != GuardOperand::NONE) {
+
+                static const char *operands[] = { "", "A", "X", "Y", "SP", "P", "" };
+                static const char *comparisons[] = { "==", "!=", "<", "<=", ">", ">=" };
+
+                os << " if ";
+                if (cond.operand == GuardOperand::MEM) {
+                    os << "[" << utl::hex(cond.addr) << "]";
+                } else {
+                    os << operands[isize(cond.operand)];
+                }
+                os << " " << comparisons[isize(cond.comparison)] << " " << utl::hex(cond.value);
+            }
+
             if (!guard->enabled) os << " (Disabled)";
             else if (guard->ignore) os << " (Disabled for " << utl::dec(guard->ignore) << " hits)";
             os << std::endl;
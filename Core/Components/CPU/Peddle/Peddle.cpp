@@ -186,6 +186,133 @@ Peddle::setPWithoutB(u8 p)
     reg.sr.c = (p & C_FLAG);
 }
 
+isize
+Peddle::idleLoopCycles() const
+{
+    // The CPU must be about to fetch an instruction with no interrupt ahead
+    if (next != fetch || flags || rdyLine || doNmi || doIrq) return 0;
+    if (nmiLine || !edgeDetector.isClear()) return 0;
+    if (!reg.sr.i && (irqLine || !levelDetector.isClear())) return 0;
+
+    u16 head = reg.pc;
+    u16 pc = head;
+    u8 a = reg.a, x = reg.x, y = reg.y;
+    StatusRegister sr = reg.sr;
+    isize cycles = 0;
+
+    for (isize i = 0; i < 8; i++) {
+
+        if (hasSideEffects(pc)) return 0;
+        u8 opcode = readDasm(pc);
+        isize length = getLengthOfInstruction(opcode);
+
+        if (length > 1 && hasSideEffects(u16(pc + 1))) return 0;
+        if (length > 2 && hasSideEffects(u16(pc + 2))) return 0;
+        u8 lo = readDasm(u16(pc + 1));
+        u8 hi = readDasm(u16(pc + 2));
+        u16 succ = u16(pc + length);
+
+        // Determine the operand
+        u8 op = 0;
+        switch (addressingMode[opcode]) {
+
+            case AddrMode::ADDR_IMMEDIATE:
+
+                op = lo;
+                cycles += 2;
+                break;
+
+            case AddrMode::ADDR_ZERO_PAGE:
+
+                if (hasSideEffects(lo)) return 0;
+                op = readDasm(lo);
+                cycles += 3;
+                break;
+
+            case AddrMode::ADDR_ABSOLUTE:
+
+                if (hasSideEffects(u16(lo | hi << 8))) return 0;
+                op = readDasm(u16(lo | hi << 8));
+                cycles += 4;
+                break;
+
+            default:
+                break;
+        }
+
+        // Execute the instruction (only side-effect free instructions qualify)
+        switch (opcode) {
+
+            case 0xA9: case 0xA5: case 0xAD: a = op; sr.n = a & 0x80; sr.z = !a; break;
+            case 0xA2: case 0xA6: case 0xAE: x = op; sr.n = x & 0x80; sr.z = !x; break;
+            case 0xA0: case 0xA4: case 0xAC: y = op; sr.n = y & 0x80; sr.z = !y; break;
+            case 0x29: case 0x25: case 0x2D: a &= op; sr.n = a & 0x80; sr.z = !a; break;
+            case 0x09: case 0x05: case 0x0D: a |= op; sr.n = a & 0x80; sr.z = !a; break;
+            case 0x49: case 0x45: case 0x4D: a ^= op; sr.n = a & 0x80; sr.z = !a; break;
+
+            case 0xC9: case 0xC5: case 0xCD:
+            case 0xE0: case 0xE4: case 0xEC:
+            case 0xC0: case 0xC4: case 0xCC:
+            {
+                u8 val = (opcode & 0xE0) == 0xC0 ? ((opcode & 0x03) ? a : y) : x;
+                u8 diff = u8(val - op);
+                sr.c = val >= op;
+                sr.n = diff & 0x80;
+                sr.z = !diff;
+                break;
+            }
+            case 0x24: case 0x2C:
+
+                sr.n = op & 0x80;
+                sr.v = op & 0x40;
+                sr.z = !(op & a);
+                break;
+
+            case 0xEA:
+
+                cycles += 2;
+                break;
+
+            case 0x4C:
+
+                // The loop must be closed by jumping back to its head
+                cycles += 3;
+                if (u16(lo | hi << 8) != head) return 0;
+                goto closed;
+
+            case 0x10: case 0x30: case 0x50: case 0x70:
+            case 0x90: case 0xB0: case 0xD0: case 0xF0:
+            {
+                bool flag =
+                opcode < 0x40 ? sr.n : opcode < 0x80 ? sr.v : opcode < 0xC0 ? sr.c : sr.z;
+                bool taken = flag == bool(opcode & 0x20);
+
+                cycles += 2;
+                if (!taken) break;
+
+                // Taken branches must lead back to the head of the loop
+                u16 target = u16(succ + i8(lo));
+                cycles += (target ^ succ) & 0xFF00 ? 2 : 1;
+                if (target != head) return 0;
+                goto closed;
+            }
+            default:
+                return 0;
+        }
+
+        pc = succ;
+    }
+    return 0;
+
+closed:
+
+    // The loop must not alter any register or flag
+    if (a != reg.a || x != reg.x || y != reg.y) return 0;
+    if (sr.n != reg.sr.n || sr.v != reg.sr.v || sr.z != reg.sr.z || sr.c != reg.sr.c) return 0;
+
+    return cycles;
+}
+
 #include "PeddleInit_cpp.h"
 #include "PeddleExec_cpp.h"
 #include "PeddleMemory_cpp.h"
@@ -22,6 +22,7 @@ class Peddle : public SubComponent {
 
     friend class Debugger;
     friend class Disassembler;
+    friend class Guards;
     friend class Breakpoints;
     friend class Watchpoints;
 
@@ -229,6 +230,16 @@ public:
     // Returns true if the next cycle marks the beginning of an instruction
     bool inFetchPhase() const { return next == fetch; }
 
+    /* Checks whether the CPU spins in an idle loop. An idle loop is a short
+     * sequence of instructions starting at the current PC that only reads from
+     * memory locations without side effects, branches back to its beginning,
+     * and leaves all registers unchanged. Such a loop runs forever unless an
+     * interrupt occurs or another component modifies memory. The function
+     * returns the number of cycles of a single iteration or 0 if the CPU is
+     * not at the beginning of an idle loop.
+     */
+    isize idleLoopCycles() const;
+
 
     //
     // Examining instructions
@@ -259,6 +270,13 @@ public:
     void execute();
     template <CPURevision C> void execute();
 
+    /* Executes a single cycle with a specific dispatcher. execute() calls one
+     * of these functions, depending on PEDDLE_THREADED_DISPATCH. The threaded
+     * dispatcher is specialized for enabled and disabled debugger checks.
+     */
+    template <CPURevision C> void executeSwitched();
+    template <CPURevision C, bool debug> void executeThreaded();
+
     // Executes the CPU for the specified number of cycles
     void execute(int count);
     template <CPURevision C> void execute(int count);
@@ -278,7 +296,7 @@ public:
 protected:
 
     // Called after the last microcycle has been completed
-    template <CPURevision C> void done();
+    template <CPURevision C, bool debug = true> void done();
 
 
     //
@@ -383,6 +401,9 @@ protected:
     virtual u8 readDasm(u16 addr) const { return 0; }
     virtual u16 readResetVector();
 
+    // Indicates whether a read access to the specified address changes state
+    virtual bool hasSideEffects(u16 addr) const { return true; }
+
 public:
 
     // Feeds the result of an asynchronous read operation into the CPU
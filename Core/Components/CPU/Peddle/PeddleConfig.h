@@ -68,3 +68,27 @@
  * only be decided after the CPU has completed its current cycle.
  */
 #define PEDDLE_ASYNC_READS false
+
+/* Threaded dispatch
+ *
+ * Peddle executes a single microinstruction per cycle. By default, the
+ * microinstruction is selected by a large switch statement. Alternatively,
+ * Peddle can jump directly to the microinstruction via a table of label
+ * addresses. This saves the range check of the switch statement and gives
+ * each dispatch its own indirect branch. In addition, the threaded dispatcher
+ * comes in two variants. One of them omits all debugger checks and is used
+ * as long as no breakpoints, watchpoints, or instruction logging are active.
+ * The option requires the "labels as values" extension of GCC and clang. On
+ * other compilers, Peddle silently falls back to the switch dispatcher.
+ *
+ * Enable to gain speed, disable for maximum portability.
+ */
+#ifndef PEDDLE_THREADED_DISPATCH
+#define PEDDLE_THREADED_DISPATCH false
+#endif
+
+#if defined(__GNUC__)
+#define PEDDLE_HAS_THREADED_DISPATCH true
+#else
+#define PEDDLE_HAS_THREADED_DISPATCH false
+#endif
@@ -11,6 +11,7 @@
 #include <iomanip>
 #include <fstream>
 #include <cassert>
+#include <cstring>
 
 namespace vc64::peddle {
 
@@ -56,11 +57,10 @@ Guards::guardNr(long nr) const
 Guard *
 Guards::guardAt(u32 addr) const
 {
-    for (int i = 0; i < count; i++) {
-        if (guards[i].addr == addr) return &guards[i];
-    }
+    if (!filtered(addr)) return nullptr;
 
-    return nullptr;
+    auto it = index.find(addr);
+    return it != index.end() ? &guards[it->second] : nullptr;
 }
 
 void
@@ -81,7 +81,9 @@ Guards::setAt(u32 addr, long skip)
     guards[count].enabled = true;
     guards[count].hits = 0;
     guards[count].ignore = skip;
+    guards[count].condition = { };
     count++;
+    updateLookup();
     setNeedsCheck(true);
 }
 
@@ -94,15 +96,12 @@ Guards::remove(long nr)
 void
 Guards::removeAt(u32 addr)
 {
-    for (int i = 0; i < count; i++) {
-
-        if (guards[i].addr == addr) {
+    if (auto it = index.find(addr); it != index.end()) {
 
-            for (int j = i; j + 1 < count; j++) guards[j] = guards[j + 1];
-            count--;
-            break;
-        }
+        for (long j = it->second; j + 1 < count; j++) guards[j] = guards[j + 1];
+        count--;
     }
+    updateLookup();
     setNeedsCheck(count != 0);
 }
 
@@ -111,6 +110,7 @@ Guards::moveTo(long nr, u32 newAddr)
 {
     if (nr >= count || isSetAt(newAddr)) return;
     guards[nr].moveTo(newAddr);
+    updateLookup();
 }
 
 bool
@@ -170,13 +170,75 @@ Guards::ignore(long nr, long count)
     if (guard) guard->ignore = count;
 }
 
+void
+Guards::setCondition(long nr, const GuardCondition &cond)
+{
+    Guard *guard = guardNr(nr);
+    if (guard) guard->condition = cond;
+}
+
+void
+Guards::setConditionAt(u32 addr, const GuardCondition &cond)
+{
+    Guard *guard = guardAt(addr);
+    if (guard) guard->condition = cond;
+}
+
 bool
 Guards::eval(u32 addr)
 {
-    for (int i = 0; i < count; i++)
-        if (guards[i].eval(addr)) return true;
+    // At most one guard is set per address (most addresses are rejected by the filter)
+    Guard *guard = guardAt(addr);
+    if (!guard || !guard->enabled || !satisfies(guard->condition)) return false;
 
-    return false;
+    return guard->eval(addr);
+}
+
+bool
+Guards::satisfies(const GuardCondition &cond) const
+{
+    u8 lhs;
+
+    switch (cond.operand) {
+
+        case GuardOperand::NONE:    return true;
+        case GuardOperand::A:       lhs = cpu.reg.a; break;
+        case GuardOperand::X:       lhs = cpu.reg.x; break;
+        case GuardOperand::Y:       lhs = cpu.reg.y; break;
+        case GuardOperand::SP:      lhs = cpu.reg.sp; break;
+        case GuardOperand::P:       lhs = cpu.getP(); break;
+        case GuardOperand::MEM:     lhs = cpu.readDasm(cond.addr); break;
+
+        default:
+            fatalError;
+    }
+
+    switch (cond.comparison) {
+
+        case GuardComparison::EQ:   return lhs == cond.value;
+        case GuardComparison::NE:   return lhs != cond.value;
+        case GuardComparison::LT:   return lhs < cond.value;
+        case GuardComparison::LE:   return lhs <= cond.value;
+        case GuardComparison::GT:   return lhs > cond.value;
+        case GuardComparison::GE:   return lhs >= cond.value;
+
+        default:
+            fatalError;
+    }
+}
+
+void
+Guards::updateLookup()
+{
+    std::memset(filter, 0, sizeof(filter));
+    index.clear();
+
+    for (long i = 0; i < count; i++) {
+
+        auto addr = guards[i].addr;
+        filter[(addr & 0xFFFF) >> 6] |= u64(1) << (addr & 63);
+        index[addr] = i;
+    }
 }
 
 void
@@ -9,6 +9,7 @@
 
 #include "PeddleDebuggerTypes.h"
 #include "Peddle.h"
+#include <unordered_map>
 
 namespace vc64::peddle {
 
@@ -31,6 +32,15 @@ protected:
     // Number of currently stored guards
     long count = 0;
 
+    /* Address filter. A set bit indicates that a guard might be set at the
+     * corresponding address (modulo 64KB). It allows eval() to reject the
+     * vast majority of addresses without scanning the guard array.
+     */
+    u64 filter[0x10000 / 64] = { };
+
+    // Maps the address of each guard to its position in the guards array
+    std::unordered_map<u32, long> index;
+
     // Indicates if guard checking is necessary
     virtual void setNeedsCheck(bool value) = 0;
     
@@ -68,7 +78,7 @@ public:
 
     void remove(long nr);
     void removeAt(u32 addr);
-    void removeAll() { count = 0; setNeedsCheck(false); }
+    void removeAll() { count = 0; updateLookup(); setNeedsCheck(false); }
 
 
     //
@@ -95,6 +105,14 @@ public:
     void ignore(long nr, long count);
 
 
+    //
+    // Managing conditions
+    //
+
+    void setCondition(long nr, const GuardCondition &cond);
+    void setConditionAt(u32 addr, const GuardCondition &cond);
+
+
     //
     // Checking a guard
     //
@@ -103,6 +121,19 @@ private:
     
     // Returns true if the guard hits
     bool eval(u32 addr);
+
+    // Checks whether the condition of a guard holds
+    bool satisfies(const GuardCondition &cond) const;
+
+
+    //
+    // Maintaining the address filter and the index
+    //
+
+    bool filtered(u32 addr) const {
+        return filter[(addr & 0xFFFF) >> 6] & (u64(1) << (addr & 63));
+    }
+    void updateLookup();
 };
 
 class Breakpoints : public Guards {
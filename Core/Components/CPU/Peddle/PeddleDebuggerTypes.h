@@ -11,6 +11,26 @@
 
 namespace vc64::peddle {
 
+// Value a guard condition refers to
+enum class GuardOperand : u8 { NONE, A, X, Y, SP, P, MEM };
+
+// Comparison performed by a guard condition
+enum class GuardComparison : u8 { EQ, NE, LT, LE, GT, GE };
+
+// Predicate that has to hold for a guard to trigger
+struct GuardCondition {
+
+    // Observed value (NONE makes the guard unconditional)
+    GuardOperand operand = GuardOperand::NONE;
+
+    // Observed memory location (if operand is MEM)
+    u16 addr = 0;
+
+    // Comparison operator and the value to compare with
+    GuardComparison comparison = GuardComparison::EQ;
+    u8 value = 0;
+};
+
 // Base structure for a single breakpoint or watchpoint
 struct Guard {
 
@@ -26,6 +46,9 @@ struct Guard {
     // Ignore counter
     long ignore;
 
+    // Additional condition (only checked if the address matches)
+    GuardCondition condition;
+
 public:
 
     // Returns true if the guard hits
@@ -151,7 +151,7 @@ doNmi |= (edgeDetector.delayed() != 0);
 #define FIX_ADDR_HI reg.adh++;
 
 #define CONTINUE next = (MicroInstruction)((int)next+1); return;
-#define DONE     done<C>(); return;
+#define DONE     done<C, debug>(); return;
 
 void
 Peddle::adc(u8 op)
@@ -362,2736 +362,76 @@ Peddle::execute()
 template <CPURevision C> void
 Peddle::execute()
 {
-    switch (next) {
-            
-        case fetch:
-
-            if constexpr (C != CPURevision::MOS_6507) {
-
-                // Check interrupt lines
-                if (unlikely(doNmi)) {
-
-                    nmiWillTrigger();
-                    IDLE_FETCH
-                    edgeDetector.clear();
-                    next = nmi_2;
-                    doNmi = false;
-                    doIrq = false; // NMI wins
-                    return;
-
-                } else if (unlikely(doIrq)) {
-
-                    irqWillTrigger();
-                    IDLE_FETCH
-                    next = irq_2;
-                    doIrq = false;
-                    return;
-                }
-            }
-
-            // Execute the Fetch phase
-            FETCH_IR
-            next = actionFunc[reg.ir];
-            return;
-            
-            //
-            // Illegal instructions
-            //
-            
-        case JAM:
-
-            cpuDidJam();
-            CONTINUE
-
-        case JAM_2:
-            
-            POLL_INT
-            DONE
-
-            //
-            // IRQ handling
-            //
-            
-        case irq_2:
-            
-            IDLE_READ_IMPLIED
-            CONTINUE
-            
-        case irq_3:
-            
-            PUSH_PCH
-            CONTINUE
-            
-        case irq_4:
-            
-            PUSH_PCL
-            // Check for interrupt hijacking
-            // If there is a positive edge on the NMI line ...
-            if (edgeDetector.current()) {
-                
-                // ... jump to the NMI vector instead of the IRQ vector.
-                edgeDetector.clear();
-                next = nmi_5;
-                return;
-            }
-            CONTINUE
-            
-        case irq_5:
-            
-            write<C>(0x100+(reg.sp--), getPWithClearedB());
-            CONTINUE
-            
-        case irq_6:
-            
-            READ_FROM(0xFFFE)
-            SET_PCL(reg.d);
-            setI(1);
-            CONTINUE
-            
-        case irq_7:
-            
-            READ_FROM(0xFFFF)
-            SET_PCH(reg.d);
-            irqDidTrigger();
-            DONE
-            
-            //
-            // NMI handling
-            //
-
-        case nmi_2:
-
-            IDLE_READ_IMPLIED
-            CONTINUE
-            
-        case nmi_3:
-            
-            PUSH_PCH
-            CONTINUE
-            
-        case nmi_4:
-            
-            PUSH_PCL
-            CONTINUE
-            
-        case nmi_5:
-            
-            write<C>(0x100+(reg.sp--), getPWithClearedB());
-            CONTINUE
-            
-        case nmi_6:
-            
-            READ_FROM(0xFFFA)
-            SET_PCL(reg.d);
-            setI(1);
-            CONTINUE
-            
-        case nmi_7:
-
-            READ_FROM(0xFFFB)
-            SET_PCH(reg.d);
-            nmiDidTrigger();
-            DONE
-
-            //
-            // Adressing mode: Immediate (shared behavior)
-            //
-
-        case BRK: case RTI: case RTS:
-            
-            IDLE_READ_IMMEDIATE
-            CONTINUE
-            
-            //
-            // Adressing mode: Implied (shared behavior)
-            //
-
-        case PHA: case PHP: case PLA: case PLP:
-            
-            IDLE_READ_IMPLIED
-            CONTINUE
-            
-            //
-            // Adressing mode: Zero-Page  (shared behavior)
-            //
-
-        case ADC_zpg: case AND_zpg: case ASL_zpg: case BIT_zpg:
-        case CMP_zpg: case CPX_zpg: case CPY_zpg: case DEC_zpg:
-        case EOR_zpg: case INC_zpg: case LDA_zpg: case LDX_zpg:
-        case LDY_zpg: case LSR_zpg: case NOP_zpg: case ORA_zpg:
-        case ROL_zpg: case ROR_zpg: case SBC_zpg: case STA_zpg:
-        case STX_zpg: case STY_zpg: case DCP_zpg: case ISC_zpg:
-        case LAX_zpg: case RLA_zpg: case RRA_zpg: case SAX_zpg:
-        case SLO_zpg: case SRE_zpg:
-            
-            FETCH_ADDR_LO
-            CONTINUE
-            
-        case ASL_zpg_2: case DEC_zpg_2: case INC_zpg_2: case LSR_zpg_2:
-        case ROL_zpg_2: case ROR_zpg_2: case DCP_zpg_2: case ISC_zpg_2:
-        case RLA_zpg_2: case RRA_zpg_2: case SLO_zpg_2: case SRE_zpg_2:
-            
-            READ_FROM_ZERO_PAGE
-            CONTINUE
-            
-            //
-            // Adressing mode: Zero-Page Indexed (shared behavior)
-            //
-            
-        case ADC_zpg_x: case AND_zpg_x: case ASL_zpg_x: case CMP_zpg_x:
-        case DEC_zpg_x: case EOR_zpg_x: case INC_zpg_x: case LDA_zpg_x:
-        case LDY_zpg_x: case LSR_zpg_x: case NOP_zpg_x: case ORA_zpg_x:
-        case ROL_zpg_x: case ROR_zpg_x: case SBC_zpg_x: case STA_zpg_x:
-        case STY_zpg_x: case DCP_zpg_x: case ISC_zpg_x: case RLA_zpg_x:
-        case RRA_zpg_x: case SLO_zpg_x: case SRE_zpg_x:
-
-        case LDX_zpg_y: case STX_zpg_y: case LAX_zpg_y: case SAX_zpg_y:
-            
-            FETCH_ADDR_LO
-            CONTINUE
-
-        case ADC_zpg_x_2: case AND_zpg_x_2: case ASL_zpg_x_2: case CMP_zpg_x_2:
-        case DEC_zpg_x_2: case EOR_zpg_x_2: case INC_zpg_x_2: case LDA_zpg_x_2:
-        case LDY_zpg_x_2: case LSR_zpg_x_2: case NOP_zpg_x_2: case ORA_zpg_x_2:
-        case ROL_zpg_x_2: case ROR_zpg_x_2: case SBC_zpg_x_2: case DCP_zpg_x_2:
-        case ISC_zpg_x_2: case RLA_zpg_x_2: case RRA_zpg_x_2: case SLO_zpg_x_2:
-        case SRE_zpg_x_2: case STA_zpg_x_2: case STY_zpg_x_2:
-            
-            READ_FROM_ZERO_PAGE
-            ADD_INDEX_X
-            CONTINUE
-
-        case LDX_zpg_y_2: case LAX_zpg_y_2: case STX_zpg_y_2: case SAX_zpg_y_2:
-            
-            READ_FROM_ZERO_PAGE
-            ADD_INDEX_Y
-            CONTINUE
-
-        case ASL_zpg_x_3: case DEC_zpg_x_3: case INC_zpg_x_3: case LSR_zpg_x_3:
-        case ROL_zpg_x_3: case ROR_zpg_x_3: case DCP_zpg_x_3: case ISC_zpg_x_3:
-        case RLA_zpg_x_3: case RRA_zpg_x_3: case SLO_zpg_x_3: case SRE_zpg_x_3:
-            
-            READ_FROM_ZERO_PAGE
-            CONTINUE
-            
-            
-            //
-            // Adressing mode: Absolute (shared behavior)
-            //
-            
-        case ADC_abs: case AND_abs: case ASL_abs: case BIT_abs:
-        case CMP_abs: case CPX_abs: case CPY_abs: case DEC_abs:
-        case EOR_abs: case INC_abs: case LDA_abs: case LDX_abs:
-        case LDY_abs: case LSR_abs: case NOP_abs: case ORA_abs:
-        case ROL_abs: case ROR_abs: case SBC_abs: case STA_abs:
-        case STX_abs: case STY_abs: case DCP_abs: case ISC_abs:
-        case LAX_abs: case RLA_abs: case RRA_abs: case SAX_abs:
-        case SLO_abs: case SRE_abs:
-            
-            FETCH_ADDR_LO
-            CONTINUE
-
-        case ADC_abs_2: case AND_abs_2: case ASL_abs_2: case BIT_abs_2:
-        case CMP_abs_2: case CPX_abs_2: case CPY_abs_2: case DEC_abs_2:
-        case EOR_abs_2: case INC_abs_2: case LDA_abs_2: case LDX_abs_2:
-        case LDY_abs_2: case LSR_abs_2: case NOP_abs_2: case ORA_abs_2:
-        case ROL_abs_2: case ROR_abs_2: case SBC_abs_2: case STA_abs_2:
-        case STX_abs_2: case STY_abs_2: case DCP_abs_2: case ISC_abs_2:
-        case LAX_abs_2: case RLA_abs_2: case RRA_abs_2: case SAX_abs_2:
-        case SLO_abs_2: case SRE_abs_2:
-            
-            FETCH_ADDR_HI
-            CONTINUE
-            
-        case ASL_abs_3: case DEC_abs_3: case INC_abs_3: case LSR_abs_3:
-        case ROL_abs_3: case ROR_abs_3: case DCP_abs_3: case ISC_abs_3:
-        case RLA_abs_3: case RRA_abs_3: case SLO_abs_3: case SRE_abs_3:
-            
-            READ_FROM_ADDRESS
-            CONTINUE
-            
-            //
-            // Adressing mode: Absolute Indexed (shared behavior)
-            //
-            
-        case ADC_abs_x: case AND_abs_x: case ASL_abs_x: case CMP_abs_x:
-        case DEC_abs_x: case EOR_abs_x: case INC_abs_x: case LDA_abs_x:
-        case LDY_abs_x: case LSR_abs_x: case NOP_abs_x: case ORA_abs_x:
-        case ROL_abs_x: case ROR_abs_x: case SBC_abs_x: case STA_abs_x:
-        case DCP_abs_x: case ISC_abs_x: case RLA_abs_x: case RRA_abs_x:
-        case SHY_abs_x: case SLO_abs_x: case SRE_abs_x:
-            
-        case ADC_abs_y: case AND_abs_y: case CMP_abs_y: case EOR_abs_y:
-        case LDA_abs_y: case LDX_abs_y: case LSR_abs_y: case ORA_abs_y:
-        case SBC_abs_y: case STA_abs_y: case DCP_abs_y: case ISC_abs_y:
-        case LAS_abs_y: case LAX_abs_y: case RLA_abs_y: case RRA_abs_y:
-        case SHA_abs_y: case SHX_abs_y: case SLO_abs_y: case SRE_abs_y:
-        case TAS_abs_y:
-            
-            FETCH_ADDR_LO
-            CONTINUE
-            
-        case ADC_abs_x_2: case AND_abs_x_2: case ASL_abs_x_2: case CMP_abs_x_2:
-        case DEC_abs_x_2: case EOR_abs_x_2: case INC_abs_x_2: case LDA_abs_x_2:
-        case LDY_abs_x_2: case LSR_abs_x_2: case NOP_abs_x_2: case ORA_abs_x_2:
-        case ROL_abs_x_2: case ROR_abs_x_2: case SBC_abs_x_2: case STA_abs_x_2:
-        case DCP_abs_x_2: case ISC_abs_x_2: case RLA_abs_x_2: case RRA_abs_x_2:
-        case SHY_abs_x_2: case SLO_abs_x_2: case SRE_abs_x_2:
-            
-            FETCH_ADDR_HI
-            ADD_INDEX_X
-            CONTINUE
-            
-        case ADC_abs_y_2: case AND_abs_y_2: case CMP_abs_y_2: case EOR_abs_y_2:
-        case LDA_abs_y_2: case LDX_abs_y_2: case LSR_abs_y_2: case ORA_abs_y_2:
-        case SBC_abs_y_2: case STA_abs_y_2: case DCP_abs_y_2: case ISC_abs_y_2:
-        case LAS_abs_y_2: case LAX_abs_y_2: case RLA_abs_y_2: case RRA_abs_y_2:
-        case SHA_abs_y_2: case SHX_abs_y_2: case SLO_abs_y_2: case SRE_abs_y_2:
-        case TAS_abs_y_2:
-            
-            FETCH_ADDR_HI
-            ADD_INDEX_Y
-            CONTINUE
-            
-        case ASL_abs_x_3: case DEC_abs_x_3: case INC_abs_x_3: case LSR_abs_x_3:
-        case ROL_abs_x_3: case ROR_abs_x_3: case DCP_abs_x_3: case ISC_abs_x_3:
-        case RLA_abs_x_3: case RRA_abs_x_3: case STA_abs_x_3: case SLO_abs_x_3:
-        case SRE_abs_x_3:
-
-        case LSR_abs_y_3: case STA_abs_y_3: case DCP_abs_y_3: case ISC_abs_y_3:
-        case RLA_abs_y_3: case RRA_abs_y_3: case SLO_abs_y_3: case SRE_abs_y_3:
-            
-            READ_FROM_ADDRESS
-            if (PAGE_BOUNDARY_CROSSED) { FIX_ADDR_HI }
-            CONTINUE
-            
-        case ASL_abs_x_4: case DEC_abs_x_4: case INC_abs_x_4: case LSR_abs_x_4:
-        case ROL_abs_x_4: case ROR_abs_x_4: case DCP_abs_x_4: case ISC_abs_x_4:
-        case RLA_abs_x_4: case RRA_abs_x_4: case SLO_abs_x_4: case SRE_abs_x_4:
-            
-        case DCP_abs_y_4: case LSR_abs_y_4: case ISC_abs_y_4: case RLA_abs_y_4:
-        case RRA_abs_y_4: case SLO_abs_y_4: case SRE_abs_y_4:
-            
-            READ_FROM_ADDRESS
-            CONTINUE
-            
-            //
-            // Adressing mode: Indexed Indirect (shared behavior)
-            //
-
-        case ADC_ind_x: case AND_ind_x: case ASL_ind_x: case CMP_ind_x:
-        case DEC_ind_x: case EOR_ind_x: case INC_ind_x: case LDA_ind_x:
-        case LDX_ind_x: case LDY_ind_x: case LSR_ind_x: case ORA_ind_x:
-        case ROL_ind_x: case ROR_ind_x: case SBC_ind_x: case STA_ind_x:
-        case DCP_ind_x: case ISC_ind_x: case LAX_ind_x: case RLA_ind_x:
-        case RRA_ind_x: case SAX_ind_x: case SLO_ind_x: case SRE_ind_x:
-            
-            FETCH_POINTER_ADDR
-            CONTINUE
-            
-        case ADC_ind_x_2: case AND_ind_x_2: case ASL_ind_x_2: case CMP_ind_x_2:
-        case DEC_ind_x_2: case EOR_ind_x_2: case INC_ind_x_2: case LDA_ind_x_2:
-        case LDX_ind_x_2: case LDY_ind_x_2: case LSR_ind_x_2: case ORA_ind_x_2:
-        case ROL_ind_x_2: case ROR_ind_x_2: case SBC_ind_x_2: case STA_ind_x_2:
-        case DCP_ind_x_2: case ISC_ind_x_2: case LAX_ind_x_2: case RLA_ind_x_2:
-        case RRA_ind_x_2: case SAX_ind_x_2: case SLO_ind_x_2: case SRE_ind_x_2:
-            
-            IDLE_READ_FROM_ADDRESS_INDIRECT
-            ADD_INDEX_X_INDIRECT
-            CONTINUE
-            
-        case ADC_ind_x_3: case AND_ind_x_3: case ASL_ind_x_3: case CMP_ind_x_3:
-        case DEC_ind_x_3: case EOR_ind_x_3: case INC_ind_x_3: case LDA_ind_x_3:
-        case LDX_ind_x_3: case LDY_ind_x_3: case LSR_ind_x_3: case ORA_ind_x_3:
-        case ROL_ind_x_3: case ROR_ind_x_3: case SBC_ind_x_3: case STA_ind_x_3:
-        case DCP_ind_x_3: case ISC_ind_x_3: case LAX_ind_x_3: case RLA_ind_x_3:
-        case RRA_ind_x_3: case SAX_ind_x_3: case SLO_ind_x_3: case SRE_ind_x_3:
-            
-            FETCH_ADDR_LO_INDIRECT
-            CONTINUE
-            
-        case ADC_ind_x_4: case AND_ind_x_4: case ASL_ind_x_4: case CMP_ind_x_4:
-        case DEC_ind_x_4: case EOR_ind_x_4: case INC_ind_x_4: case LDA_ind_x_4:
-        case LDX_ind_x_4: case LDY_ind_x_4: case LSR_ind_x_4: case ORA_ind_x_4:
-        case ROL_ind_x_4: case ROR_ind_x_4: case SBC_ind_x_4: case STA_ind_x_4:
-        case DCP_ind_x_4: case ISC_ind_x_4: case LAX_ind_x_4: case RLA_ind_x_4:
-        case RRA_ind_x_4: case SAX_ind_x_4: case SLO_ind_x_4: case SRE_ind_x_4:
-            
-            FETCH_ADDR_HI_INDIRECT
-            CONTINUE
-            
-        case ASL_ind_x_5: case DEC_ind_x_5: case INC_ind_x_5: case LSR_ind_x_5:
-        case ROL_ind_x_5: case ROR_ind_x_5: case DCP_ind_x_5: case ISC_ind_x_5:
-        case RLA_ind_x_5: case RRA_ind_x_5: case SLO_ind_x_5: case SRE_ind_x_5:
-            
-            READ_FROM_ADDRESS
-            CONTINUE
-            
-            //
-            // Adressing mode: Indirect Indexed (shared behavior)
-            //
-            
-        case ADC_ind_y: case AND_ind_y: case CMP_ind_y: case EOR_ind_y:
-        case LDA_ind_y: case LDX_ind_y: case LDY_ind_y: case LSR_ind_y:
-        case ORA_ind_y: case SBC_ind_y: case STA_ind_y: case DCP_ind_y:
-        case ISC_ind_y: case LAX_ind_y: case RLA_ind_y: case RRA_ind_y:
-        case SHA_ind_y: case SLO_ind_y: case SRE_ind_y:
-            
-            FETCH_POINTER_ADDR
-            CONTINUE
-
-        case ADC_ind_y_2: case AND_ind_y_2: case CMP_ind_y_2: case EOR_ind_y_2:
-        case LDA_ind_y_2: case LDX_ind_y_2: case LDY_ind_y_2: case LSR_ind_y_2:
-        case ORA_ind_y_2: case SBC_ind_y_2: case STA_ind_y_2: case DCP_ind_y_2:
-        case ISC_ind_y_2: case LAX_ind_y_2: case RLA_ind_y_2: case RRA_ind_y_2:
-        case SHA_ind_y_2: case SLO_ind_y_2: case SRE_ind_y_2:
-            
-            FETCH_ADDR_LO_INDIRECT
-            CONTINUE
-            
-        case ADC_ind_y_3: case AND_ind_y_3: case CMP_ind_y_3: case EOR_ind_y_3:
-        case LDA_ind_y_3: case LDX_ind_y_3: case LDY_ind_y_3: case LSR_ind_y_3:
-        case ORA_ind_y_3: case SBC_ind_y_3: case STA_ind_y_3: case DCP_ind_y_3:
-        case ISC_ind_y_3: case LAX_ind_y_3: case RLA_ind_y_3: case RRA_ind_y_3:
-        case SHA_ind_y_3: case SLO_ind_y_3: case SRE_ind_y_3:
-            
-            FETCH_ADDR_HI_INDIRECT
-            ADD_INDEX_Y
-            CONTINUE
-
-        case LSR_ind_y_4: case STA_ind_y_4: case DCP_ind_y_4: case ISC_ind_y_4:
-        case RLA_ind_y_4: case RRA_ind_y_4: case SLO_ind_y_4: case SRE_ind_y_4:
-            
-            READ_FROM_ADDRESS
-            if (PAGE_BOUNDARY_CROSSED) { FIX_ADDR_HI }
-            CONTINUE
-            
-        case LSR_ind_y_5: case DCP_ind_y_5: case ISC_ind_y_5: case RLA_ind_y_5:
-        case RRA_ind_y_5: case SLO_ind_y_5: case SRE_ind_y_5:
-            
-            READ_FROM_ADDRESS
-            CONTINUE
-            
-            //
-            // Adressing mode: Relative (shared behavior)
-            //
-            
-        case BCC_rel_2: case BCS_rel_2: case BEQ_rel_2: case BMI_rel_2:
-        case BNE_rel_2: case BPL_rel_2: case BVC_rel_2: case BVS_rel_2:
-        {
-            IDLE_READ_IMPLIED
-            u8 pc_hi = HI_BYTE(reg.pc);
-            reg.pc += (i8)reg.d;
-            
-            if (unlikely(pc_hi != HI_BYTE(reg.pc))) {
-                next = (reg.d & 0x80) ? branch_3_underflow : branch_3_overflow;
-                return;
-            }
-            DONE
-        }
-            
-        case branch_3_underflow:
-            
-            IDLE_READ_FROM(reg.pc + 0x100)
-            POLL_INT_AGAIN
-            DONE
-            
-        case branch_3_overflow:
-            
-            IDLE_READ_FROM(reg.pc - 0x100)
-            POLL_INT_AGAIN
-            DONE
-            
-            
-            // Instruction: ADC
-            //
-            // Operation:   A,C := A+M+C
-            //
-            // Flags:       N Z C I D V
-            //              / / / - - /
-
-        case ADC_imm:
-
-            READ_IMMEDIATE
-            adc(reg.d);
-            POLL_INT
-            DONE
-
-        case ADC_zpg_2:
-        case ADC_zpg_x_3:
-            
-            READ_FROM_ZERO_PAGE
-            adc(reg.d);
-            POLL_INT
-            DONE
-
-        case ADC_abs_x_3:
-        case ADC_abs_y_3:
-        case ADC_ind_y_4:
-            
-            READ_FROM_ADDRESS
-            if (PAGE_BOUNDARY_CROSSED) {
-                FIX_ADDR_HI
-                CONTINUE
-            } else {
-                adc(reg.d);
-                POLL_INT
-                DONE
-            }
-            
-        case ADC_abs_3:
-        case ADC_abs_x_4:
-        case ADC_abs_y_4:
-        case ADC_ind_x_5:
-        case ADC_ind_y_5:
-            
-            READ_FROM_ADDRESS
-            adc(reg.d);
-            POLL_INT
-            DONE
-            
-            
-            // Instruction: AND
-            //
-            // Operation:   A := A AND M
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-
-        case AND_imm:
-            
-            READ_IMMEDIATE
-            loadA(reg.a & reg.d);
-            POLL_INT
-            DONE
-
-        case AND_zpg_2:
-        case AND_zpg_x_3:
-            
-            READ_FROM_ZERO_PAGE
-            loadA(reg.a & reg.d);
-            POLL_INT
-            DONE
-            
-        case AND_abs_x_3:
-        case AND_abs_y_3:
-        case AND_ind_y_4:
-            
-            READ_FROM_ADDRESS
-            if (PAGE_BOUNDARY_CROSSED) {
-                FIX_ADDR_HI
-                CONTINUE
-            } else {
-                loadA(reg.a & reg.d);
-                POLL_INT
-                DONE
-            }
-            
-        case AND_abs_3:
-        case AND_abs_x_4:
-        case AND_abs_y_4:
-        case AND_ind_x_5:
-        case AND_ind_y_5:
-            
-            READ_FROM_ADDRESS
-            loadA(reg.a & reg.d);
-            POLL_INT
-            DONE
-            
-            
-            // Instruction: ASL
-            //
-            // Operation:   C <- (A|M << 1) <- 0
-            //
-            // Flags:       N Z C I D V
-            //              / / / - - -
-
-#define DO_ASL_ACC setC(reg.a & 0x80); loadA((u8)(reg.a << 1));
-#define DO_ASL setC(reg.d & 0x80); reg.d = (u8)(reg.d << 1);
-
-        case ASL_acc:
-            
-            IDLE_READ_IMPLIED
-            DO_ASL_ACC
-            POLL_INT
-            DONE
-            
-        case ASL_zpg_3:
-        case ASL_zpg_x_4:
-            
-            WRITE_TO_ZERO_PAGE
-            DO_ASL
-            CONTINUE
-
-        case ASL_abs_4:
-        case ASL_abs_x_5:
-        case ASL_ind_x_6:
-            
-            WRITE_TO_ADDRESS
-            DO_ASL
-            CONTINUE
-            
-        case ASL_zpg_4:
-        case ASL_zpg_x_5:
-            
-            WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
-            POLL_INT
-            DONE
-            
-        case ASL_abs_5:
-        case ASL_abs_x_6:
-        case ASL_ind_x_7:
-            
-            WRITE_TO_ADDRESS_AND_SET_FLAGS
-            POLL_INT
-            DONE
-            
-            
-            // Instruction: BCC
-            //
-            // Operation:   Branch on C = 0
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-
-        case BCC_rel:
-            
-            READ_IMMEDIATE
-            POLL_INT
-            
-            if (!getC()) {
-                CONTINUE
-            } else {
-                DONE
-            }
-            
-            
-            // Instruction: BCS
-            //
-            // Operation:   Branch on C = 1
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-
-        case BCS_rel:
-            
-            READ_IMMEDIATE
-            POLL_INT
-            
-            if (getC()) {
-                CONTINUE
-            } else {
-                DONE
-            }
-            
-
-            // Instruction: BEQ
-            //
-            // Operation:   Branch on Z = 1
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-            
-        case BEQ_rel:
-            
-            READ_IMMEDIATE
-            POLL_INT
-            
-            if (getZ()) {
-                CONTINUE
-            } else {
-                DONE
-            }
-            
-            
-            // Instruction: BIT
-            //
-            // Operation:   A AND M, N := M7, V := M6
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - /
-            
-        case BIT_zpg_2:
-            
-            READ_FROM_ZERO_PAGE
-            setN(reg.d & 128);
-            setV(reg.d & 64);
-            setZ((reg.d & reg.a) == 0);
-            POLL_INT
-            DONE
-
-        case BIT_abs_3:
-            
-            READ_FROM_ADDRESS
-            setN(reg.d & 128);
-            setV(reg.d & 64);
-            setZ((reg.d & reg.a) == 0);
-            POLL_INT
-            DONE
-
-            
-            // Instruction: BMI
-            //
-            // Operation:   Branch on N = 1
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-
-        case BMI_rel:
-            
-            READ_IMMEDIATE
-            POLL_INT
-            
-            if (getN()) {
-                CONTINUE
-            } else {
-                DONE
-            }
-
-            
-            // Instruction: BNE
-            //
-            // Operation:   Branch on Z = 0
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-            
-        case BNE_rel:
-            
-            READ_IMMEDIATE
-            POLL_INT
-            
-            if (!getZ()) {
-                CONTINUE
-            } else {
-                DONE
-            }
-
-
-            // Instruction: BPL
-            //
-            // Operation:   Branch on N = 0
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-
-        case BPL_rel:
-            
-            READ_IMMEDIATE
-            POLL_INT
-            
-            if (!getN()) {
-                CONTINUE
-            } else {
-                DONE
-            }
-
-
-            // Instruction: BRK
-            //
-            // Operation:   Forced Interrupt (Break)
-            //
-            // Flags:       N Z C I D V    B
-            //              - - - 1 - -    1
-            
-        case BRK_2:
-            
-            setB(1);
-            PUSH_PCH
-            CONTINUE
-            
-        case BRK_3:
-
-            PUSH_PCL
-            
-            // Check for interrupt hijacking
-            // If there is a positive edge on the NMI line, ...
-            if (edgeDetector.current()) {
-
-                // ... jump to the NMI vector instead of the IRQ vector.
-                edgeDetector.clear();
-                next = BRK_nmi_4;
-                return;
-                
-            } else {
-                CONTINUE
-            }
-            
-        case BRK_4:
-            
-            PUSH_P
-            CONTINUE
-            
-        case BRK_5:
-            
-            READ_FROM(0xFFFE);
-            SET_PCL(reg.d);
-            setI(1);
-            CONTINUE
-            
-        case BRK_6:
-            
-            READ_FROM(0xFFFF);
-            SET_PCH(reg.d);
-            POLL_INT
-            doNmi = false; // Only the level detector is polled here. This is
-            // the reason why only IRQs can be triggered right
-            // after a BRK command, but not NMIs.
-            DONE
-            
-        case BRK_nmi_4:
-            
-            PUSH_P
-            CONTINUE
-            
-        case BRK_nmi_5:
-            
-            READ_FROM(0xFFFA);
-            SET_PCL(reg.d);
-            setI(1);
-            CONTINUE
-            
-        case BRK_nmi_6:
-            
-            READ_FROM(0xFFFB);
-            SET_PCH(reg.d);
-            POLL_INT
-            DONE
-
-            
-            // Instruction: BVC
-            //
-            // Operation:   Branch on V = 0
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-
-        case BVC_rel:
-            
-            READ_IMMEDIATE
-            POLL_INT
-
-            if (!getV()) {
-                CONTINUE
-            } else {
-                DONE
-            }
-
-
-            // Instruction: BVS
-            //
-            // Operation:   Branch on V = 1
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-
-        case BVS_rel:
-            
-            READ_IMMEDIATE
-            POLL_INT
-            
-            if (getV()) {
-                CONTINUE
-            } else {
-                DONE
-            }
-
-
-            // Instruction: CLC
-            //
-            // Operation:   C := 0
-            //
-            // Flags:       N Z C I D V
-            //              - - 0 - - -
-
-        case CLC:
-            
-            IDLE_READ_IMPLIED
-            setC(0);
-            POLL_INT
-            DONE
-
-
-            // Instruction: CLD
-            //
-            // Operation:   D := 0
-            //
-            // Flags:       N Z C I D V
-            //              - - - - 0 -
-
-        case CLD:
-            
-            IDLE_READ_IMPLIED
-            setD(0);
-            POLL_INT
-            DONE
-
-
-            // Instruction: CLI
-            //
-            // Operation:   I := 0
-            //
-            // Flags:       N Z C I D V
-            //              - - - 0 - -
-
-        case CLI:
-            
-            POLL_INT
-            setI(0);
-            IDLE_READ_IMPLIED
-            DONE
-            
-            
-            // Instruction: CLV
-            //
-            // Operation:   V := 0
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - 0
-
-        case CLV:
-            
-            IDLE_READ_IMPLIED
-            setV(0);
-            POLL_INT
-            DONE
-
-
-            // Instruction: CMP
-            //
-            // Operation:   A-M
-            //
-            // Flags:       N Z C I D V
-            //              / / / - - -
-
-        case CMP_imm:
-            
-            READ_IMMEDIATE
-            cmp(reg.a, reg.d);
-            POLL_INT
-            DONE
-
-        case CMP_zpg_2:
-        case CMP_zpg_x_3:
-            
-            READ_FROM_ZERO_PAGE
-            cmp(reg.a, reg.d);
-            POLL_INT
-            DONE
-
-        case CMP_abs_x_3:
-        case CMP_abs_y_3:
-        case CMP_ind_y_4:
-            
-            READ_FROM_ADDRESS
-            if (PAGE_BOUNDARY_CROSSED) {
-                FIX_ADDR_HI
-                CONTINUE
-            } else {
-                cmp(reg.a, reg.d);
-                POLL_INT
-                DONE
-            }
-            
-        case CMP_abs_3:
-        case CMP_abs_x_4:
-        case CMP_abs_y_4:
-        case CMP_ind_x_5:
-        case CMP_ind_y_5:
-            
-            READ_FROM_ADDRESS
-            cmp(reg.a, reg.d);
-            POLL_INT
-            DONE
-
-            
-            // Instruction: CPX
-            //
-            // Operation:   X-M
-            //
-            // Flags:       N Z C I D V
-            //              / / / - - -
-
-        case CPX_imm:
-            
-            READ_IMMEDIATE
-            cmp(reg.x, reg.d);
-            POLL_INT
-            DONE
-            
-        case CPX_zpg_2:
-            
-            READ_FROM_ZERO_PAGE
-            cmp(reg.x, reg.d);
-            POLL_INT
-            DONE
-            
-        case CPX_abs_3:
-            
-            READ_FROM_ADDRESS
-            cmp(reg.x, reg.d);
-            POLL_INT
-            DONE
-
-
-            // Instruction: CPY
-            //
-            // Operation:   Y-M
-            //
-            // Flags:       N Z C I D V
-            //              / / / - - -
-
-        case CPY_imm:
-            
-            READ_IMMEDIATE
-            cmp(reg.y, reg.d);
-            POLL_INT
-            DONE
-
-        case CPY_zpg_2:
-            
-            READ_FROM_ZERO_PAGE
-            cmp(reg.y, reg.d);
-            POLL_INT
-            DONE
-
-        case CPY_abs_3:
-            
-            READ_FROM_ADDRESS
-            cmp(reg.y, reg.d);
-            POLL_INT
-            DONE
-
-
-            // Instruction: DEC
-            //
-            // Operation:   M := : M - 1
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-            
-#define DO_DEC reg.d--;
-            
-        case DEC_zpg_3:
-        case DEC_zpg_x_4:
-            
-            WRITE_TO_ZERO_PAGE
-            DO_DEC
-            CONTINUE
-            
-        case DEC_zpg_4:
-        case DEC_zpg_x_5:
-            
-            WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
-            POLL_INT
-            DONE
-            
-        case DEC_abs_4:
-        case DEC_abs_x_5:
-        case DEC_ind_x_6:
-            
-            WRITE_TO_ADDRESS
-            DO_DEC
-            CONTINUE
-            
-        case DEC_abs_5:
-        case DEC_abs_x_6:
-        case DEC_ind_x_7:
-            
-            WRITE_TO_ADDRESS_AND_SET_FLAGS
-            POLL_INT
-            DONE
-
-
-            // Instruction: DEX
-            //
-            // Operation:   X := X - 1
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-
-        case DEX:
-            
-            IDLE_READ_IMPLIED
-            loadX(reg.x - 1);
-            POLL_INT
-            DONE
-            
-            
-            // Instruction: DEY
-            //
-            // Operation:   Y := Y - 1
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-
-        case DEY:
-            
-            IDLE_READ_IMPLIED
-            loadY(reg.y - 1);
-            POLL_INT
-            DONE
-
-
-            // Instruction: EOR
-            //
-            // Operation:   A := A XOR M
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-
-#define DO_EOR loadA(reg.a ^ reg.d);
-            
-        case EOR_imm:
-            
-            READ_IMMEDIATE
-            DO_EOR
-            POLL_INT
-            DONE
-            
-        case EOR_zpg_2:
-        case EOR_zpg_x_3:
-            
-            READ_FROM_ZERO_PAGE
-            DO_EOR
-            POLL_INT
-            DONE
-            
-        case EOR_abs_x_3:
-        case EOR_abs_y_3:
-        case EOR_ind_y_4:
-            
-            READ_FROM_ADDRESS
-            if (PAGE_BOUNDARY_CROSSED) {
-                FIX_ADDR_HI
-                CONTINUE
-            } else {
-                DO_EOR
-                POLL_INT
-                DONE
-            }
-
-        case EOR_abs_3:
-        case EOR_abs_x_4:
-        case EOR_abs_y_4:
-        case EOR_ind_x_5:
-        case EOR_ind_y_5:
-            
-            READ_FROM_ADDRESS
-            DO_EOR
-            POLL_INT
-            DONE
-
-
-            // Instruction: INC
-            //
-            // Operation:   M := M + 1
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-            
-#define DO_INC reg.d++;
-            
-        case INC_zpg_3:
-        case INC_zpg_x_4:
-            
-            WRITE_TO_ZERO_PAGE
-            DO_INC
-            CONTINUE
-            
-        case INC_zpg_4:
-        case INC_zpg_x_5:
-            
-            WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
-            POLL_INT
-            DONE
-
-        case INC_abs_4:
-        case INC_abs_x_5:
-        case INC_ind_x_6:
-            
-            WRITE_TO_ADDRESS
-            DO_INC
-            CONTINUE
-            
-        case INC_abs_5:
-        case INC_abs_x_6:
-        case INC_ind_x_7:
-            
-            WRITE_TO_ADDRESS_AND_SET_FLAGS
-            POLL_INT
-            DONE
-            
-
-            // Instruction: INX
-            //
-            // Operation:   X := X + 1
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-
-        case INX:
-            
-            IDLE_READ_IMPLIED
-            loadX(reg.x + 1);
-            POLL_INT
-            DONE
-
-
-            // Instruction: INY
-            //
-            // Operation:   Y := Y + 1
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-
-        case INY:
-            
-            IDLE_READ_IMPLIED
-            loadY(reg.y + 1);
-            POLL_INT
-            DONE
-
-
-            // Instruction: JMP
-            //
-            // Operation:   PC := Operand
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-
-        case JMP_abs:
-            
-            FETCH_ADDR_LO
-            CONTINUE
-            
-        case JMP_abs_2:
-            
-            FETCH_ADDR_HI
-            reg.pc = LO_HI(reg.adl, reg.adh);
-            POLL_INT
-            DONE
-
-        case JMP_abs_ind:
-            
-            FETCH_ADDR_LO
-            CONTINUE
-            
-        case JMP_abs_ind_2:
-            
-            FETCH_ADDR_HI
-            CONTINUE
-            
-        case JMP_abs_ind_3:
-            
-            READ_FROM_ADDRESS
-            SET_PCL(reg.d);
-            reg.adl++;
-            CONTINUE
-            
-        case JMP_abs_ind_4:
-            
-            READ_FROM_ADDRESS
-            SET_PCH(reg.d);
-            POLL_INT
-            DONE
-
-            
-            // Instruction: JSR
-            //
-            // Operation:   PC to stack, PC := Operand
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-            
-        case JSR:
-            
-            FETCH_ADDR_LO
-            CONTINUE
-            
-        case JSR_2:
-            
-            IDLE_PULL
-            CONTINUE
-            
-        case JSR_3:
-            
-            PUSH_PCH
-            CONTINUE
-            
-        case JSR_4:
-            
-            PUSH_PCL
-            CONTINUE
-            
-        case JSR_5:
-            
-            FETCH_ADDR_HI
-            reg.pc = LO_HI(reg.adl, reg.adh);
-            POLL_INT
-            DONE
-
-            
-            // Instruction: LDA
-            //
-            // Operation:   A := M
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-
-        case LDA_imm:
-            
-            READ_IMMEDIATE
-            loadA(reg.d);
-            POLL_INT
-            DONE
-
-        case LDA_zpg_2:
-        case LDA_zpg_x_3:
-            
-            READ_FROM_ZERO_PAGE
-            loadA(reg.d);
-            POLL_INT
-            DONE
-
-        case LDA_abs_x_3:
-        case LDA_abs_y_3:
-        case LDA_ind_y_4:
-            
-            READ_FROM_ADDRESS
-            if (PAGE_BOUNDARY_CROSSED) {
-                FIX_ADDR_HI
-                CONTINUE
-            } else {
-                loadA(reg.d);
-                POLL_INT
-                DONE
-            }
-            
-        case LDA_abs_3:
-        case LDA_abs_x_4:
-        case LDA_abs_y_4:
-        case LDA_ind_x_5:
-        case LDA_ind_y_5:
-            
-            READ_FROM_ADDRESS
-            loadA(reg.d);
-            POLL_INT
-            DONE
-
-            
-            // Instruction: LDX
-            //
-            // Operation:   X := M
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-
-        case LDX_imm:
-            
-            READ_IMMEDIATE
-            loadX(reg.d);
-            POLL_INT
-            DONE
-
-        case LDX_zpg_2:
-        case LDX_zpg_y_3:
-            
-            READ_FROM_ZERO_PAGE
-            loadX(reg.d);
-            POLL_INT
-            DONE
-
-        case LDX_abs_y_3:
-        case LDX_ind_y_4:
-            
-            READ_FROM_ADDRESS
-            if (PAGE_BOUNDARY_CROSSED) {
-                FIX_ADDR_HI
-                CONTINUE
-            } else {
-                loadX(reg.d);
-                POLL_INT
-                DONE
-            }
-            
-        case LDX_abs_3:
-        case LDX_abs_y_4:
-        case LDX_ind_x_5:
-        case LDX_ind_y_5:
-            
-            READ_FROM_ADDRESS
-            loadX(reg.d);
-            POLL_INT
-            DONE
-            
-            
-            // Instruction: LDY
-            //
-            // Operation:   Y := M
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-
-        case LDY_imm:
-            
-            READ_IMMEDIATE
-            loadY(reg.d);
-            POLL_INT
-            DONE
-            
-        case LDY_zpg_2:
-        case LDY_zpg_x_3:
-            
-            READ_FROM_ZERO_PAGE
-            loadY(reg.d);
-            POLL_INT
-            DONE
-
-        case LDY_abs_x_3:
-        case LDY_ind_y_4:
-            
-            READ_FROM_ADDRESS
-            if (PAGE_BOUNDARY_CROSSED) {
-                FIX_ADDR_HI
-                CONTINUE
-            } else {
-                loadY(reg.d);
-                POLL_INT
-                DONE
-            }
-
-        case LDY_abs_3:
-        case LDY_abs_x_4:
-        case LDY_ind_x_5:
-        case LDY_ind_y_5:
-            
-            READ_FROM_ADDRESS
-            loadY(reg.d);
-            POLL_INT
-            DONE
-            
-
-            // Instruction: LSR
-            //
-            // Operation:   0 -> (A|M >> 1) -> C
-            //
-            // Flags:       N Z C I D V
-            //              0 / / - - -
-
-        case LSR_acc:
-            
-            IDLE_READ_IMPLIED
-            setC(reg.a & 1); loadA(reg.a >> 1);
-            POLL_INT
-            DONE
-
-        case LSR_zpg_3:
-        case LSR_zpg_x_4:
-            
-            WRITE_TO_ZERO_PAGE
-            setC(reg.d & 1); reg.d = reg.d >> 1;
-            CONTINUE
-            
-        case LSR_zpg_4:
-        case LSR_zpg_x_5:
-            
-            WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
-            POLL_INT
-            DONE
-            
-        case LSR_abs_4:
-        case LSR_abs_x_5:
-        case LSR_abs_y_5:
-        case LSR_ind_x_6:
-        case LSR_ind_y_6:
-            
-            WRITE_TO_ADDRESS
-            setC(reg.d & 1); reg.d = reg.d >> 1;
-            CONTINUE
-            
-        case LSR_abs_5:
-        case LSR_abs_x_6:
-        case LSR_abs_y_6:
-        case LSR_ind_x_7:
-        case LSR_ind_y_7:
-            
-            WRITE_TO_ADDRESS_AND_SET_FLAGS
-            POLL_INT
-            DONE
-            
-
-            // Instruction: NOP
-            //
-            // Operation:   No operation
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-
-        case NOP:
-            
-            IDLE_READ_IMPLIED
-            POLL_INT
-            DONE
-
-        case NOP_imm:
-            
-            IDLE_READ_IMMEDIATE
-            POLL_INT
-            DONE
-
-        case NOP_zpg_2:
-        case NOP_zpg_x_3:
-            
-            IDLE_READ_FROM_ZERO_PAGE
-            POLL_INT
-            DONE
-            
-        case NOP_abs_x_3:
-            
-            IDLE_READ_FROM_ADDRESS
-            if (PAGE_BOUNDARY_CROSSED) {
-                FIX_ADDR_HI
-                CONTINUE
-            } else {
-                POLL_INT
-                DONE
-            }
-            
-        case NOP_abs_3:
-        case NOP_abs_x_4:
-            
-            IDLE_READ_FROM_ADDRESS
-            POLL_INT
-            DONE
-            
-
-            // Instruction: ORA
-            //
-            // Operation:   A := A v M
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-
-        case ORA_imm:
-            
-            READ_IMMEDIATE
-            loadA(reg.a | reg.d);
-            POLL_INT
-            DONE
-            
-        case ORA_zpg_2:
-        case ORA_zpg_x_3:
-            
-            READ_FROM_ZERO_PAGE
-            loadA(reg.a | reg.d);
-            POLL_INT
-            DONE
-
-        case ORA_abs_x_3:
-        case ORA_abs_y_3:
-        case ORA_ind_y_4:
-            
-            READ_FROM_ADDRESS
-            if (PAGE_BOUNDARY_CROSSED) {
-                FIX_ADDR_HI
-                CONTINUE
-            } else {
-                loadA(reg.a | reg.d);
-                POLL_INT
-                DONE
-            }
-            
-        case ORA_abs_3:
-        case ORA_abs_x_4:
-        case ORA_abs_y_4:
-        case ORA_ind_x_5:
-        case ORA_ind_y_5:
-            
-            READ_FROM_ADDRESS
-            loadA(reg.a | reg.d);
-            POLL_INT
-            DONE
-            
-            
-            // Instruction: PHA
-            //
-            // Operation:   A to stack
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-            
-        case PHA_2:
-            
-            PUSH_A
-            POLL_INT
-            DONE
-
-            
-            // Instruction: PHA
-            //
-            // Operation:   P to stack
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-            
-        case PHP_2:
-            
-            PUSH_P
-            POLL_INT
-            DONE
-
-            
-            // Instruction: PLA
-            //
-            // Operation:   Stack to A
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-            
-        case PLA_2:
-            
-            reg.sp++;
-            CONTINUE
-            
-        case PLA_3:
-            
-            PULL_A
-            POLL_INT
-            DONE
+    if constexpr (PEDDLE_THREADED_DISPATCH) {
 
-            
-            // Instruction: PLP
-            //
-            // Operation:   Stack to p
-            //
-            // Flags:       N Z C I D V
-            //              / / / / / /
-            
-        case PLP_2:
-
-            IDLE_PULL
-            reg.sp++;
-            CONTINUE
-            
-        case PLP_3:
-
-            POLL_INT // Interrupts are polled before P is pulled
-            PULL_P
-            DONE
-
-            
-            // Instruction: ROL
-            //
-            //              -----------------------
-            //              |                     |
-            // Operation:   ---(A|M << 1) <- C <---
-            //
-            // Flags:       N Z C I D V
-            //              / / / - - -
-
-#define DO_ROL_ACC { u8 c = !!getC(); setC(reg.a & 0x80); loadA((u8)(reg.a << 1 | c)); }
-#define DO_ROL { u8 c = !!getC(); setC(reg.d & 0x80); reg.d = (u8)(reg.d << 1 | c); }
-
-        case ROL_acc:
-            
-            IDLE_READ_IMPLIED
-            DO_ROL_ACC
-            POLL_INT
-            DONE
-            
-        case ROL_zpg_3:
-        case ROL_zpg_x_4:
-            
-            WRITE_TO_ZERO_PAGE
-            DO_ROL
-            CONTINUE
-            
-        case ROL_zpg_4:
-        case ROL_zpg_x_5:
-            
-            WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
-            POLL_INT
-            DONE
-            
-        case ROL_abs_4:
-        case ROL_abs_x_5:
-        case ROL_ind_x_6:
-            
-            WRITE_TO_ADDRESS
-            DO_ROL
-            CONTINUE
-            
-        case ROL_abs_5:
-        case ROL_abs_x_6:
-        case ROL_ind_x_7:
-            
-            WRITE_TO_ADDRESS_AND_SET_FLAGS
-            POLL_INT
-            DONE
-
-
-            // Instruction: ROR
-            //
-            //              -----------------------
-            //              |                     |
-            // Operation:   --->(A|M >> 1) -> C ---
-            //
-            // Flags:       N Z C I D V
-            //              / / / - - -
-
-#define DO_ROR_ACC { u8 c = !!getC(); setC(reg.a & 0x1); loadA((u8)(reg.a >> 1 | c << 7)); }
-#define DO_ROR { u8 c = !!getC(); setC(reg.d & 0x1); reg.d = (u8)(reg.d >> 1 | c << 7); }
-            
-        case ROR_acc:
-            
-            IDLE_READ_IMPLIED
-            DO_ROR_ACC
-            POLL_INT
-            DONE
-            
-        case ROR_zpg_3:
-        case ROR_zpg_x_4:
-            
-            WRITE_TO_ZERO_PAGE
-            DO_ROR
-            CONTINUE
-            
-        case ROR_zpg_4:
-        case ROR_zpg_x_5:
-            
-            WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
-            POLL_INT
-            DONE
-            
-        case ROR_abs_4:
-        case ROR_abs_x_5:
-        case ROR_ind_x_6:
-            
-            WRITE_TO_ADDRESS
-            DO_ROR
-            CONTINUE
-            
-        case ROR_abs_5:
-        case ROR_abs_x_6:
-        case ROR_ind_x_7:
-            
-            WRITE_TO_ADDRESS_AND_SET_FLAGS
-            POLL_INT
-            DONE
-
-            
-            // Instruction: RTI
-            //
-            // Operation:   P from Stack, PC from Stack
-            //
-            // Flags:       N Z C I D V
-            //              / / / / / /
-            
-        case RTI_2:
-            
-            IDLE_PULL
-            reg.sp++;
-            CONTINUE
-            
-        case RTI_3:
-            
-            PULL_P
-            reg.sp++;
-            CONTINUE
-            
-        case RTI_4:
-            
-            PULL_PCL
-            reg.sp++;
-            CONTINUE
-            
-        case RTI_5:
-            
-            PULL_PCH
-            POLL_INT
-            DONE
-
-
-            // Instruction: RTS
-            //
-            // Operation:   PC from Stack
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-            
-        case RTS_2:
-            
-            IDLE_PULL
-            reg.sp++;
-            CONTINUE
-            
-        case RTS_3:
-            
-            PULL_PCL
-            reg.sp++;
-            CONTINUE
-            
-        case RTS_4:
-            
-            PULL_PCH
-            CONTINUE
-            
-        case RTS_5:
-            
-            IDLE_READ_IMMEDIATE
-            POLL_INT
-            DONE
-
-            
-            // Instruction: SBC
-            //
-            // Operation:   A := A - M - (~C)
-            //
-            // Flags:       N Z C I D V
-            //              / / / - - /
-
-        case SBC_imm:
-            
-            READ_IMMEDIATE
-            sbc(reg.d);
-            POLL_INT
-            DONE
-            
-        case SBC_zpg_2:
-        case SBC_zpg_x_3:
-            
-            READ_FROM_ZERO_PAGE
-            sbc(reg.d);
-            POLL_INT
-            DONE
-            
-        case SBC_abs_x_3:
-        case SBC_abs_y_3:
-        case SBC_ind_y_4:
-            
-            READ_FROM_ADDRESS
-            if (PAGE_BOUNDARY_CROSSED) {
-                FIX_ADDR_HI
-                CONTINUE
-            } else {
-                sbc(reg.d);
-                POLL_INT
-                DONE
-            }
-            
-        case SBC_abs_3:
-        case SBC_abs_x_4:
-        case SBC_abs_y_4:
-        case SBC_ind_x_5:
-        case SBC_ind_y_5:
-            
-            READ_FROM_ADDRESS
-            sbc(reg.d);
-            POLL_INT
-            DONE
-
-
-            // Instruction: SEC
-            //
-            // Operation:   C := 1
-            //
-            // Flags:       N Z C I D V
-            //              - - 1 - - -
-
-        case SEC:
-            
-            IDLE_READ_IMPLIED
-            setC(1);
-            POLL_INT
-            DONE
-
-            
-            // Instruction: SED
-            //
-            // Operation:   D := 1
-            //
-            // Flags:       N Z C I D V
-            //              - - - - 1 -
-
-        case SED:
-            
-            IDLE_READ_IMPLIED
-            setD(1);
-            POLL_INT
-            DONE
-
-            
-            // Instruction: SEI
-            //
-            // Operation:   I := 1
-            //
-            // Flags:       N Z C I D V
-            //              - - - 1 - -
-
-        case SEI:
-            
-            POLL_IRQ
-            setI(1);
-            [[fallthrough]];
-            
-        case SEI_cont:
-            
-            next = SEI_cont;
-            IDLE_READ_IMPLIED
-            POLL_NMI
-            DONE
-            
-
-            // Instruction: STA
-            //
-            // Operation:   M := A
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-            
-        case STA_zpg_2:
-        case STA_zpg_x_3:
-            
-            reg.d = reg.a;
-            WRITE_TO_ZERO_PAGE
-            POLL_INT
-            DONE
-            
-        case STA_abs_3:
-        case STA_abs_x_4:
-            
-            reg.d = reg.a;
-            WRITE_TO_ADDRESS
-            POLL_INT
-            DONE
-            
-        case STA_abs_y_4:
-        case STA_ind_x_5:
-        case STA_ind_y_5:
-            
-            reg.d = reg.a;
-            WRITE_TO_ADDRESS
-            POLL_INT
-            DONE
-
-
-            // Instruction: STX
-            //
-            // Operation:   M := X
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-            
-        case STX_zpg_2:
-        case STX_zpg_y_3:
-            
-            reg.d = reg.x;
-            WRITE_TO_ZERO_PAGE
-            POLL_INT
-            DONE
-            
-        case STX_abs_3:
-            
-            reg.d = reg.x;
-            WRITE_TO_ADDRESS
-            POLL_INT
-            DONE
-
-            
-            // Instruction: STY
-            //
-            // Operation:   M := Y
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-            
-        case STY_zpg_2:
-        case STY_zpg_x_3:
-            
-            reg.d = reg.y;
-            WRITE_TO_ZERO_PAGE
-            POLL_INT
-            DONE
-            
-        case STY_abs_3:
-            
-            reg.d = reg.y;
-            WRITE_TO_ADDRESS
-            POLL_INT
-            DONE
-
-
-            // Instruction: TAX
-            //
-            // Operation:   X := A
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-
-        case TAX:
-            
-            IDLE_READ_IMPLIED
-            loadX(reg.a);
-            POLL_INT
-            DONE
-
-            
-            // Instruction: TAY
-            //
-            // Operation:   Y := A
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-
-        case TAY:
-            
-            IDLE_READ_IMPLIED
-            loadY(reg.a);
-            POLL_INT
-            DONE
-
-
-            // Instruction: TSX
-            //
-            // Operation:   X := Stack pointer
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-
-        case TSX:
-            
-            IDLE_READ_IMPLIED
-            loadX(reg.sp);
-            POLL_INT
-            DONE
-
-
-            // Instruction: TXA
-            //
-            // Operation:   A := X
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-
-        case TXA:
-            
-            IDLE_READ_IMPLIED
-            loadA(reg.x);
-            POLL_INT
-            DONE
-
-
-            // Instruction: TXS
-            //
-            // Operation:   Stack pointer := X
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-
-        case TXS:
-            
-            IDLE_READ_IMPLIED
-            reg.sp = reg.x;
-            POLL_INT
-            DONE
-
-
-            // Instruction: TYA
-            //
-            // Operation:   A := Y
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-
-        case TYA:
-            
-            IDLE_READ_IMPLIED
-            loadA(reg.y);
-            POLL_INT
-            DONE
-
-            
-            //
-            // Illegal instructions
-            //
-
-            
-            // Instruction: ALR
-            //
-            // Operation:   AND, followed by LSR
-            //
-            // Flags:       N Z C I D V
-            //              / / / - - -
-
-        case ALR_imm:
-            
-            READ_IMMEDIATE
-            reg.a = reg.a & reg.d;
-            setC(reg.a & 1);
-            loadA(reg.a >> 1);
-            POLL_INT
-            DONE
-
-
-            // Instruction: ANC
-            //
-            // Operation:   A := A & op,   N flag is copied to C
-            //
-            // Flags:       N Z C I D V
-            //              / / / - - -
-
-        case ANC_imm:
-            
-            READ_IMMEDIATE
-            loadA(reg.a & reg.d);
-            setC(getN());
-            POLL_INT
-            DONE
-
-
-            // Instruction: ARR
-            //
-            // Operation:   AND, followed by ROR
-            //
-            // Flags:       N Z C I D V
-            //              / / / - - /
-
-        case ARR_imm:
-        {
-            READ_IMMEDIATE
-            
-            u8 tmp2 = reg.a & reg.d;
-            
-            // Taken from Frodo...
-            reg.a = (getC() ? (tmp2 >> 1) | 0x80 : tmp2 >> 1);
-            if (!getD()) {
-                setN(reg.a & 0x80);
-                setZ(reg.a == 0);
-                setC(reg.a & 0x40);
-                setV((reg.a & 0x40) ^ ((reg.a & 0x20) << 1));
-            } else {
-                int c_flag;
-                
-                setN(getC());
-                setZ(reg.a == 0);
-                setV((tmp2 ^ reg.a) & 0x40);
-                if ((tmp2 & 0x0f) + (tmp2 & 0x01) > 5)
-                    reg.a = (reg.a & 0xf0) | ((reg.a + 6) & 0x0f);
-                c_flag = (tmp2 + (tmp2 & 0x10)) & 0x1f0;
-                if (c_flag > 0x50) {
-                    setC(1);
-                    reg.a += 0x60;
-                } else {
-                    setC(0);
-                }
-            }
-            POLL_INT
-            DONE
-        }
-
-
-            // Instruction: AXS
-            //
-            // Operation:   X = (A & X) - op
-            //
-            // Flags:       N Z C I D V
-            //              / / / - - -
-
-        case AXS_imm:
-        {
-            READ_IMMEDIATE
-            
-            u8 op2  = reg.a & reg.x;
-            u8 tmp = op2 - reg.d;
-            
-            setC(op2 >= reg.d);
-            loadX(tmp);
-            POLL_INT
-            DONE
+        if (flags) {
+            executeThreaded<C, true>();
+        } else {
+            executeThreaded<C, false>();
         }
 
+    } else {
 
-            // Instruction: DCP
-            //
-            // Operation:   DEC followed by CMP
-            //
-            // Flags:       N Z C I D V
-            //              / / / - - -
-            
-        case DCP_zpg_3:
-        case DCP_zpg_x_4:
-            
-            WRITE_TO_ZERO_PAGE
-            reg.d--;
-            CONTINUE
-            
-        case DCP_zpg_4:
-        case DCP_zpg_x_5:
-            
-            WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
-            cmp(reg.a, reg.d);
-            POLL_INT
-            DONE
-            
-        case DCP_abs_4:
-        case DCP_abs_x_5:
-        case DCP_abs_y_5:
-        case DCP_ind_x_6:
-        case DCP_ind_y_6:
-            
-            WRITE_TO_ADDRESS
-            reg.d--;
-            CONTINUE
-            
-        case DCP_abs_5:
-        case DCP_abs_x_6:
-        case DCP_abs_y_6:
-        case DCP_ind_x_7:
-        case DCP_ind_y_7:
-            
-            WRITE_TO_ADDRESS_AND_SET_FLAGS
-            cmp(reg.a, reg.d);
-            POLL_INT
-            DONE
-
-
-            // Instruction: ISC
-            //
-            // Operation:   INC followed by SBC
-            //
-            // Flags:       N Z C I D V
-            //              / / / - - /
-            
-        case ISC_zpg_3:
-        case ISC_zpg_x_4:
-            
-            WRITE_TO_ZERO_PAGE
-            reg.d++;
-            CONTINUE
-            
-        case ISC_zpg_4:
-        case ISC_zpg_x_5:
-            
-            WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
-            sbc(reg.d);
-            POLL_INT
-            DONE
-
-        case ISC_abs_4:
-        case ISC_abs_x_5:
-        case ISC_abs_y_5:
-        case ISC_ind_x_6:
-        case ISC_ind_y_6:
-            
-            WRITE_TO_ADDRESS
-            reg.d++;
-            CONTINUE
-            
-        case ISC_abs_5:
-        case ISC_abs_x_6:
-        case ISC_abs_y_6:
-        case ISC_ind_x_7:
-        case ISC_ind_y_7:
-            
-            WRITE_TO_ADDRESS_AND_SET_FLAGS
-            sbc(reg.d);
-            POLL_INT
-            DONE
-
-
-            // Instruction: LAS
-            //
-            // Operation:   SP,X,A = op & SP
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-            
-        case LAS_abs_y_3:
-            
-            READ_FROM_ADDRESS
-            if (PAGE_BOUNDARY_CROSSED) {
-                FIX_ADDR_HI
-                CONTINUE
-            } else {
-                reg.d &= reg.sp;
-                reg.sp = reg.d;
-                reg.x = reg.d;
-                loadA(reg.d);
-                POLL_INT
-                DONE
-            }
-            
-        case LAS_abs_y_4:
-            
-            READ_FROM_ADDRESS
-            reg.d &= reg.sp;
-            reg.sp = reg.d;
-            reg.x = reg.d;
-            loadA(reg.d);
-            POLL_INT
-            DONE
-
-            
-            // Instruction: LAX
-            //
-            // Operation:   LDA, followed by LDX
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-            
-        case LAX_zpg_2:
-        case LAX_zpg_y_3:
-            
-            READ_FROM_ZERO_PAGE
-            loadA(reg.d);
-            loadX(reg.d);
-            POLL_INT
-            DONE
-            
-        case LAX_abs_y_3:
-        case LAX_ind_y_4:
-            
-            READ_FROM_ADDRESS
-            if (PAGE_BOUNDARY_CROSSED) {
-                FIX_ADDR_HI
-                CONTINUE
-            } else {
-                loadA(reg.d);
-                loadX(reg.d);
-                POLL_INT
-                DONE
-            }
-            
-        case LAX_abs_3:
-        case LAX_abs_y_4:
-        case LAX_ind_x_5:
-        case LAX_ind_y_5:
-            
-            READ_FROM_ADDRESS;
-            loadA(reg.d);
-            loadX(reg.d);
-            POLL_INT
-            DONE
-
-            
-            // Instruction: RLA
-            //
-            // Operation:   ROL, followed by AND
-            //
-            // Flags:       N Z C I D V
-            //              / / / - - -
-            
-        case RLA_zpg_3:
-        case RLA_zpg_x_4:
-            
-            WRITE_TO_ZERO_PAGE
-            DO_ROL
-            CONTINUE
-            
-        case RLA_zpg_4:
-        case RLA_zpg_x_5:
-            
-            WRITE_TO_ZERO_PAGE
-            loadA(reg.a & reg.d);
-            POLL_INT
-            DONE
-            
-        case RLA_abs_4:
-        case RLA_abs_x_5:
-        case RLA_abs_y_5:
-        case RLA_ind_x_6:
-        case RLA_ind_y_6:
-            
-            WRITE_TO_ADDRESS
-            DO_ROL
-            CONTINUE
-            
-        case RLA_abs_5:
-        case RLA_abs_x_6:
-        case RLA_abs_y_6:
-        case RLA_ind_x_7:
-        case RLA_ind_y_7:
-            
-            WRITE_TO_ADDRESS
-            loadA(reg.a & reg.d);
-            POLL_INT
-            DONE
-
-            // Instruction: RRA
-            //
-            // Operation:   ROR, followed by ADC
-            //
-            // Flags:       N Z C I D V
-            //              / / / - - /
-            
-        case RRA_zpg_3:
-        case RRA_zpg_x_4:
-            
-            WRITE_TO_ZERO_PAGE
-            DO_ROR
-            CONTINUE
-            
-        case RRA_zpg_4:
-        case RRA_zpg_x_5:
-            
-            WRITE_TO_ZERO_PAGE
-            adc(reg.d);
-            POLL_INT
-            DONE
-
-        case RRA_abs_4:
-        case RRA_abs_x_5:
-        case RRA_abs_y_5:
-        case RRA_ind_x_6:
-        case RRA_ind_y_6:
-            
-            WRITE_TO_ADDRESS
-            DO_ROR
-            CONTINUE
-            
-        case RRA_abs_5:
-        case RRA_abs_x_6:
-        case RRA_abs_y_6:
-        case RRA_ind_x_7:
-        case RRA_ind_y_7:
-            
-            WRITE_TO_ADDRESS
-            adc(reg.d);
-            POLL_INT
-            DONE
-
-            
-            // Instruction: SAX
-            //
-            // Operation:   Mem := A & X
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-            
-        case SAX_zpg_2:
-        case SAX_zpg_y_3:
-            
-            reg.d = reg.a & reg.x;
-            WRITE_TO_ZERO_PAGE
-            POLL_INT
-            DONE
-
-        case SAX_abs_3:
-        case SAX_ind_x_5:
-            
-            reg.d = reg.a & reg.x;
-            WRITE_TO_ADDRESS
-            POLL_INT
-            DONE
-
-
-            // Instruction: SHA
-            //
-            // Operation:   Mem := A & X & (M + 1)
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-            
-        case SHA_abs_y_3:
-            
-            IDLE_READ_FROM_ADDRESS
-            
-            /* "There are two unstable conditions, the first is when a DMA is
-             *  going on while the instruction executes (the CPU is halted by
-             *  the VIC-II) then the & M+1 part drops off."
-             */
-            
-            reg.d = reg.a & reg.x & (rdyLineUp == clock ? 0xFF : reg.adh + 1);
-            
-            /* "The other unstable condition is when the addressing/indexing
-             *  causes a page boundary crossing, in that case the highbyte of
-             *  the target address may become equal to the value stored."
-             */
-            
-            if (PAGE_BOUNDARY_CROSSED) {
-                FIX_ADDR_HI;
-                reg.adh = reg.a & reg.x & reg.adh;
-            }
-            
-            CONTINUE
-            
-        case SHA_abs_y_4:
-            
-            WRITE_TO_ADDRESS
-            POLL_INT
-            DONE
-            
-        case SHA_ind_y_4:
-            
-            IDLE_READ_FROM_ADDRESS
-            
-            /* "There are two unstable conditions, the first is when a DMA is
-             *  going on while the instruction executes (the CPU is halted by
-             *  the VIC-II) then the & M+1 part drops off."
-             */
-            
-            reg.d = reg.a & reg.x & (rdyLineUp == clock ? 0xFF : reg.adh + 1);
-            
-            /* "The other unstable condition is when the addressing/indexing
-             *  causes a page boundary crossing, in that case the highbyte of
-             *  the target address may become equal to the value stored."
-             */
-            
-            if (PAGE_BOUNDARY_CROSSED) {
-                FIX_ADDR_HI;
-                reg.adh = reg.a & reg.x & reg.adh;
-            }
-
-            CONTINUE
-            
-        case SHA_ind_y_5:
-            
-            WRITE_TO_ADDRESS
-            POLL_INT
-            DONE
-
-
-            // Instruction: SHX
-            //
-            // Operation:   Mem := X & (HI_BYTE(op) + 1)
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
+        executeSwitched<C>();
+    }
+}
 
-        case SHX_abs_y_3:
-            
-            IDLE_READ_FROM_ADDRESS
-            
-            /* "There are two unstable conditions, the first is when a DMA is
-             *  going on while the instruction executes (the CPU is halted by
-             *  the VIC-II) then the & M+1 part drops off."
-             */
-            
-            reg.d = reg.x & (rdyLineUp == clock ? 0xFF : reg.adh + 1);
-            
-            /* "The other unstable condition is when the addressing/indexing
-             *  causes a page boundary crossing, in that case the highbyte of
-             *  the target address may become equal to the value stored."
-             */
-            
-            if (PAGE_BOUNDARY_CROSSED) {
-                FIX_ADDR_HI;
-                reg.adh = reg.x & reg.adh;
-            }
-            
-            CONTINUE
+template <CPURevision C> void
+Peddle::executeSwitched()
+{
+    // The switch dispatcher always performs the debugger checks
+    static constexpr bool debug = true;
 
-        case SHX_abs_y_4:
-            
-            WRITE_TO_ADDRESS
-            POLL_INT
-            DONE
+#define MICROCODE(x) case x
+#define FALLTHROUGH [[fallthrough]];
 
+    switch (next) {
 
-            // Instruction: SHY
-            //
-            // Operation:   Mem := Y & (HI_BYTE(op) + 1)
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-            
-        case SHY_abs_x_3:
-            
-            IDLE_READ_FROM_ADDRESS
-            
-            /* "There are two unstable conditions, the first is when a DMA is
-             *  going on while the instruction executes (the CPU is halted by
-             *  the VIC-II) then the & M+1 part drops off."
-             */
-            
-            reg.d = reg.y & (rdyLineUp == clock ? 0xFF : reg.adh + 1);
-            
-            /* "The other unstable condition is when the addressing/indexing
-             *  causes a page boundary crossing, in that case the highbyte of
-             *  the target address may become equal to the value stored."
-             */
-            
-            if (PAGE_BOUNDARY_CROSSED) {
-                FIX_ADDR_HI;
-                reg.adh = reg.y & reg.adh;
-            }
+#include "PeddleMicrocode_cpp.h"
 
-            CONTINUE
-            
-        case SHY_abs_x_4:
+        default:
             
-            WRITE_TO_ADDRESS
-            POLL_INT
-            DONE
-
+            fatalError;
+    }
 
-            // Instruction: SLO (ASO)
-            //
-            // Operation:   ASL memory location, followed by OR on accumulator
-            //
-            // Flags:       N Z C I D V
-            //              / / / - - -
+#undef MICROCODE
+#undef FALLTHROUGH
+}
 
-#define DO_SLO setC(reg.d & 128); reg.d <<= 1;
+#if PEDDLE_HAS_THREADED_DISPATCH
 
-        case SLO_zpg_3:
-        case SLO_zpg_x_4:
-            
-            WRITE_TO_ZERO_PAGE
-            DO_SLO
-            CONTINUE
-            
-        case SLO_zpg_4:
-        case SLO_zpg_x_5:
-            
-            WRITE_TO_ZERO_PAGE
-            loadA(reg.a | reg.d);
-            POLL_INT
-            DONE
-            
-        case SLO_abs_4:
-        case SLO_abs_x_5:
-        case SLO_abs_y_5:
-        case SLO_ind_x_6:
-        case SLO_ind_y_6:
-            
-            WRITE_TO_ADDRESS
-            DO_SLO
-            CONTINUE
-            
-        case SLO_abs_5:
-        case SLO_abs_x_6:
-        case SLO_abs_y_6:
-        case SLO_ind_x_7:
-        case SLO_ind_y_7:
-            
-            WRITE_TO_ADDRESS
-            loadA(reg.a | reg.d);
-            POLL_INT
-            DONE
-            
+template <CPURevision C, bool debug> void
+Peddle::executeThreaded()
+{
+#define MICRO(x) &&x##_label,
+#define MICROCODE(x) x##_label
+#define FALLTHROUGH
 
-            // Instruction: SRE (LSE)
-            //
-            // Operation:   LSR, followed by EOR
-            //
-            // Flags:       N Z C I D V
-            //              / / / - - -
+    static void *const labels[] = {
 
-#define DO_SRE setC(reg.d & 1); reg.d >>= 1;
+#include "PeddleMicroInstructions.h"
+    };
+    static_assert(isize(sizeof(labels) / sizeof(labels[0])) == TAS_abs_y_4 + 1);
 
-        case SRE_zpg_3:
-        case SRE_zpg_x_4:
-            
-            WRITE_TO_ZERO_PAGE
-            DO_SRE
-            CONTINUE
-            
-        case SRE_zpg_4:
-        case SRE_zpg_x_5:
-            
-            WRITE_TO_ZERO_PAGE
-            loadA(reg.a ^ reg.d);
-            POLL_INT
-            DONE
-            
-        case SRE_abs_4:
-        case SRE_abs_x_5:
-        case SRE_abs_y_5:
-        case SRE_ind_x_6:
-        case SRE_ind_y_6:
-            
-            WRITE_TO_ADDRESS
-            DO_SRE
-            CONTINUE
-            
-        case SRE_abs_5:
-        case SRE_abs_x_6:
-        case SRE_abs_y_6:
-        case SRE_ind_x_7:
-        case SRE_ind_y_7:
-            
-            WRITE_TO_ADDRESS
-            loadA(reg.a ^ reg.d);
-            POLL_INT
-            DONE
-
-
-            // Instruction: TAS (SHS)
-            //
-            // Operation:   SP := A & X,  Mem := SP & (HI_BYTE(op) + 1)
-            //
-            // Flags:       N Z C I D V
-            //              - - - - - -
-            
-        case TAS_abs_y_3:
-            
-            IDLE_READ_FROM_ADDRESS
-            
-            reg.sp = reg.a & reg.x;
-            
-            /* "There are two unstable conditions, the first is when a DMA is
-             *  going on while the instruction executes (the CPU is halted by
-             *  the VIC-II) then the & M+1 part drops off."
-             */
-            
-            reg.d = reg.a & reg.x & (rdyLineUp == clock ? 0xFF : reg.adh + 1);
-            
-            /* "The other unstable condition is when the addressing/indexing
-             *  causes a page boundary crossing, in that case the highbyte of
-             *  the target address may become equal to the value stored."
-             */
-            
-            if (PAGE_BOUNDARY_CROSSED) {
-                FIX_ADDR_HI;
-                reg.adh = reg.a & reg.x & reg.adh;
-            }
+    goto *labels[next];
 
-            CONTINUE
-            
-        case TAS_abs_y_4:
-            
-            WRITE_TO_ADDRESS
-            POLL_INT
-            DONE
-
-            // Instruction: ANE
-            //
-            // Operation:   A = X & op & (A | 0xEE) (taken from Frodo)
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
-
-        case ANE_imm:
-            
-            READ_IMMEDIATE
-            loadA(reg.x & reg.d & (reg.a | 0xEE));
-            POLL_INT
-            DONE
+#include "PeddleMicrocode_cpp.h"
 
+#undef MICROCODE
+#undef FALLTHROUGH
+#undef MICRO
+}
 
-            // Instruction: LXA
-            //
-            // Operation:   A = X = op & (A | 0xEE) (taken from Frodo)
-            //
-            // Flags:       N Z C I D V
-            //              / / - - - -
+#else
 
-        case LXA_imm:
-            
-            READ_IMMEDIATE
-            reg.x = reg.d & (reg.a | 0xEE);
-            loadA(reg.x);
-            POLL_INT
-            DONE
-            
-        default:
-            
-            fatalError;
-    }
+template <CPURevision C, bool debug> void
+Peddle::executeThreaded()
+{
+    executeSwitched<C>();
 }
 
+#endif
+
 void
 Peddle::execute(int count)
 {
@@ -3180,10 +520,10 @@ Peddle::finishInstruction()
     while (!inFetchPhase()) execute<C>();
 }
 
-template <CPURevision C> void
+template <CPURevision C, bool debug> void
 Peddle::done() {
 
-    if (flags) {
+    if (debug && flags) {
 
         if (flags & CPU_LOG_INSTRUCTION) {
 
@@ -3200,3 +540,26 @@ Peddle::done() {
     reg.pc0 = reg.pc;
     next = fetch;
 }
+
+/* The dispatchers are explicitly instantiated, because components outside
+ * this translation unit (e.g., the benchmark suite) call them directly.
+ */
+template void Peddle::reset<CPURevision::MOS_6502>();
+template void Peddle::reset<CPURevision::MOS_6507>();
+template void Peddle::reset<CPURevision::MOS_6510>();
+template void Peddle::reset<CPURevision::MOS_8502>();
+
+template void Peddle::execute<CPURevision::MOS_6502>();
+template void Peddle::execute<CPURevision::MOS_6507>();
+template void Peddle::execute<CPURevision::MOS_6510>();
+template void Peddle::execute<CPURevision::MOS_8502>();
+
+template void Peddle::executeSwitched<CPURevision::MOS_6502>();
+template void Peddle::executeSwitched<CPURevision::MOS_6507>();
+template void Peddle::executeSwitched<CPURevision::MOS_6510>();
+template void Peddle::executeSwitched<CPURevision::MOS_8502>();
+
+template void Peddle::executeThreaded<CPURevision::MOS_6502, false>();
+template void Peddle::executeThreaded<CPURevision::MOS_6507, false>();
+template void Peddle::executeThreaded<CPURevision::MOS_6510, false>();
+template void Peddle::executeThreaded<CPURevision::MOS_8502, false>();
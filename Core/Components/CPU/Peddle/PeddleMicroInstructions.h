@@ -0,0 +1,302 @@
+// -----------------------------------------------------------------------------
+// This file is part of Peddle - A MOS 65xx CPU emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Published under the terms of the MIT License
+// -----------------------------------------------------------------------------
+
+/* List of all microinstructions. The list generates enum MicroInstruction and
+ * the jump table of the threaded dispatcher. Before including, macro MICRO(x)
+ * has to be defined to yield the list entry for microinstruction x.
+ */
+
+    MICRO(fetch)
+
+    MICRO(JAM) MICRO(JAM_2)
+
+    MICRO(irq_2) MICRO(irq_3) MICRO(irq_4) MICRO(irq_5) MICRO(irq_6) MICRO(irq_7)
+    MICRO(nmi_2) MICRO(nmi_3) MICRO(nmi_4) MICRO(nmi_5) MICRO(nmi_6) MICRO(nmi_7)
+
+    MICRO(ADC_imm)
+    MICRO(ADC_zpg)   MICRO(ADC_zpg_2)
+    MICRO(ADC_zpg_x) MICRO(ADC_zpg_x_2) MICRO(ADC_zpg_x_3)
+    MICRO(ADC_abs)   MICRO(ADC_abs_2)   MICRO(ADC_abs_3)
+    MICRO(ADC_abs_x) MICRO(ADC_abs_x_2) MICRO(ADC_abs_x_3) MICRO(ADC_abs_x_4)
+    MICRO(ADC_abs_y) MICRO(ADC_abs_y_2) MICRO(ADC_abs_y_3) MICRO(ADC_abs_y_4)
+    MICRO(ADC_ind_x) MICRO(ADC_ind_x_2) MICRO(ADC_ind_x_3) MICRO(ADC_ind_x_4) MICRO(ADC_ind_x_5)
+    MICRO(ADC_ind_y) MICRO(ADC_ind_y_2) MICRO(ADC_ind_y_3) MICRO(ADC_ind_y_4) MICRO(ADC_ind_y_5)
+
+    MICRO(AND_imm)
+    MICRO(AND_zpg)   MICRO(AND_zpg_2)
+    MICRO(AND_zpg_x) MICRO(AND_zpg_x_2) MICRO(AND_zpg_x_3)
+    MICRO(AND_abs)   MICRO(AND_abs_2)   MICRO(AND_abs_3)
+    MICRO(AND_abs_x) MICRO(AND_abs_x_2) MICRO(AND_abs_x_3) MICRO(AND_abs_x_4)
+    MICRO(AND_abs_y) MICRO(AND_abs_y_2) MICRO(AND_abs_y_3) MICRO(AND_abs_y_4)
+    MICRO(AND_ind_x) MICRO(AND_ind_x_2) MICRO(AND_ind_x_3) MICRO(AND_ind_x_4) MICRO(AND_ind_x_5)
+    MICRO(AND_ind_y) MICRO(AND_ind_y_2) MICRO(AND_ind_y_3) MICRO(AND_ind_y_4) MICRO(AND_ind_y_5)
+
+    MICRO(ASL_acc)
+    MICRO(ASL_zpg)   MICRO(ASL_zpg_2)   MICRO(ASL_zpg_3)   MICRO(ASL_zpg_4)
+    MICRO(ASL_zpg_x) MICRO(ASL_zpg_x_2) MICRO(ASL_zpg_x_3) MICRO(ASL_zpg_x_4) MICRO(ASL_zpg_x_5)
+    MICRO(ASL_abs)   MICRO(ASL_abs_2)   MICRO(ASL_abs_3)   MICRO(ASL_abs_4)   MICRO(ASL_abs_5)
+    MICRO(ASL_abs_x) MICRO(ASL_abs_x_2) MICRO(ASL_abs_x_3) MICRO(ASL_abs_x_4) MICRO(ASL_abs_x_5) MICRO(ASL_abs_x_6)
+    MICRO(ASL_ind_x) MICRO(ASL_ind_x_2) MICRO(ASL_ind_x_3) MICRO(ASL_ind_x_4) MICRO(ASL_ind_x_5) MICRO(ASL_ind_x_6) MICRO(ASL_ind_x_7)
+
+    MICRO(branch_3_underflow) MICRO(branch_3_overflow)
+    MICRO(BCC_rel) MICRO(BCC_rel_2)
+    MICRO(BCS_rel) MICRO(BCS_rel_2)
+    MICRO(BEQ_rel) MICRO(BEQ_rel_2)
+
+    MICRO(BIT_zpg) MICRO(BIT_zpg_2)
+    MICRO(BIT_abs) MICRO(BIT_abs_2) MICRO(BIT_abs_3)
+
+    MICRO(BMI_rel) MICRO(BMI_rel_2)
+    MICRO(BNE_rel) MICRO(BNE_rel_2)
+    MICRO(BPL_rel) MICRO(BPL_rel_2)
+
+    MICRO(BRK) MICRO(BRK_2) MICRO(BRK_3) MICRO(BRK_4) MICRO(BRK_5) MICRO(BRK_6)
+    MICRO(BRK_nmi_4) MICRO(BRK_nmi_5) MICRO(BRK_nmi_6)
+
+    MICRO(BVC_rel) MICRO(BVC_rel_2)
+    MICRO(BVS_rel) MICRO(BVS_rel_2)
+    MICRO(CLC)
+    MICRO(CLD)
+    MICRO(CLI)
+    MICRO(CLV)
+
+    MICRO(CMP_imm)
+    MICRO(CMP_zpg)   MICRO(CMP_zpg_2)
+    MICRO(CMP_zpg_x) MICRO(CMP_zpg_x_2) MICRO(CMP_zpg_x_3)
+    MICRO(CMP_abs)   MICRO(CMP_abs_2)   MICRO(CMP_abs_3)
+    MICRO(CMP_abs_x) MICRO(CMP_abs_x_2) MICRO(CMP_abs_x_3) MICRO(CMP_abs_x_4)
+    MICRO(CMP_abs_y) MICRO(CMP_abs_y_2) MICRO(CMP_abs_y_3) MICRO(CMP_abs_y_4)
+    MICRO(CMP_ind_x) MICRO(CMP_ind_x_2) MICRO(CMP_ind_x_3) MICRO(CMP_ind_x_4) MICRO(CMP_ind_x_5)
+    MICRO(CMP_ind_y) MICRO(CMP_ind_y_2) MICRO(CMP_ind_y_3) MICRO(CMP_ind_y_4) MICRO(CMP_ind_y_5)
+
+    MICRO(CPX_imm)
+    MICRO(CPX_zpg) MICRO(CPX_zpg_2)
+    MICRO(CPX_abs) MICRO(CPX_abs_2) MICRO(CPX_abs_3)
+
+    MICRO(CPY_imm)
+    MICRO(CPY_zpg) MICRO(CPY_zpg_2)
+    MICRO(CPY_abs) MICRO(CPY_abs_2) MICRO(CPY_abs_3)
+
+    MICRO(DEC_zpg)   MICRO(DEC_zpg_2)   MICRO(DEC_zpg_3)   MICRO(DEC_zpg_4)
+    MICRO(DEC_zpg_x) MICRO(DEC_zpg_x_2) MICRO(DEC_zpg_x_3) MICRO(DEC_zpg_x_4) MICRO(DEC_zpg_x_5)
+    MICRO(DEC_abs)   MICRO(DEC_abs_2)   MICRO(DEC_abs_3)   MICRO(DEC_abs_4)   MICRO(DEC_abs_5)
+    MICRO(DEC_abs_x) MICRO(DEC_abs_x_2) MICRO(DEC_abs_x_3) MICRO(DEC_abs_x_4) MICRO(DEC_abs_x_5) MICRO(DEC_abs_x_6)
+    MICRO(DEC_ind_x) MICRO(DEC_ind_x_2) MICRO(DEC_ind_x_3) MICRO(DEC_ind_x_4) MICRO(DEC_ind_x_5) MICRO(DEC_ind_x_6) MICRO(DEC_ind_x_7)
+
+    MICRO(DEX)
+    MICRO(DEY)
+
+    MICRO(EOR_imm)
+    MICRO(EOR_zpg)   MICRO(EOR_zpg_2)
+    MICRO(EOR_zpg_x) MICRO(EOR_zpg_x_2) MICRO(EOR_zpg_x_3)
+    MICRO(EOR_abs)   MICRO(EOR_abs_2)   MICRO(EOR_abs_3)
+    MICRO(EOR_abs_x) MICRO(EOR_abs_x_2) MICRO(EOR_abs_x_3) MICRO(EOR_abs_x_4)
+    MICRO(EOR_abs_y) MICRO(EOR_abs_y_2) MICRO(EOR_abs_y_3) MICRO(EOR_abs_y_4)
+    MICRO(EOR_ind_x) MICRO(EOR_ind_x_2) MICRO(EOR_ind_x_3) MICRO(EOR_ind_x_4) MICRO(EOR_ind_x_5)
+    MICRO(EOR_ind_y) MICRO(EOR_ind_y_2) MICRO(EOR_ind_y_3) MICRO(EOR_ind_y_4) MICRO(EOR_ind_y_5)
+
+    MICRO(INC_zpg)   MICRO(INC_zpg_2)   MICRO(INC_zpg_3)   MICRO(INC_zpg_4)
+    MICRO(INC_zpg_x) MICRO(INC_zpg_x_2) MICRO(INC_zpg_x_3) MICRO(INC_zpg_x_4) MICRO(INC_zpg_x_5)
+    MICRO(INC_abs)   MICRO(INC_abs_2)   MICRO(INC_abs_3)   MICRO(INC_abs_4)   MICRO(INC_abs_5)
+    MICRO(INC_abs_x) MICRO(INC_abs_x_2) MICRO(INC_abs_x_3) MICRO(INC_abs_x_4) MICRO(INC_abs_x_5) MICRO(INC_abs_x_6)
+    MICRO(INC_ind_x) MICRO(INC_ind_x_2) MICRO(INC_ind_x_3) MICRO(INC_ind_x_4) MICRO(INC_ind_x_5) MICRO(INC_ind_x_6) MICRO(INC_ind_x_7)
+
+    MICRO(INX)
+    MICRO(INY)
+
+    MICRO(JMP_abs) MICRO(JMP_abs_2)
+    MICRO(JMP_abs_ind) MICRO(JMP_abs_ind_2) MICRO(JMP_abs_ind_3) MICRO(JMP_abs_ind_4)
+
+    MICRO(JSR) MICRO(JSR_2) MICRO(JSR_3) MICRO(JSR_4) MICRO(JSR_5)
+
+    MICRO(LDA_imm)
+    MICRO(LDA_zpg)   MICRO(LDA_zpg_2)
+    MICRO(LDA_zpg_x) MICRO(LDA_zpg_x_2) MICRO(LDA_zpg_x_3)
+    MICRO(LDA_abs)   MICRO(LDA_abs_2)   MICRO(LDA_abs_3)
+    MICRO(LDA_abs_x) MICRO(LDA_abs_x_2) MICRO(LDA_abs_x_3) MICRO(LDA_abs_x_4)
+    MICRO(LDA_abs_y) MICRO(LDA_abs_y_2) MICRO(LDA_abs_y_3) MICRO(LDA_abs_y_4)
+    MICRO(LDA_ind_x) MICRO(LDA_ind_x_2) MICRO(LDA_ind_x_3) MICRO(LDA_ind_x_4) MICRO(LDA_ind_x_5)
+    MICRO(LDA_ind_y) MICRO(LDA_ind_y_2) MICRO(LDA_ind_y_3) MICRO(LDA_ind_y_4) MICRO(LDA_ind_y_5)
+
+    MICRO(LDX_imm)
+    MICRO(LDX_zpg)   MICRO(LDX_zpg_2)
+    MICRO(LDX_zpg_y) MICRO(LDX_zpg_y_2) MICRO(LDX_zpg_y_3)
+    MICRO(LDX_abs)   MICRO(LDX_abs_2)   MICRO(LDX_abs_3)
+    MICRO(LDX_abs_y) MICRO(LDX_abs_y_2) MICRO(LDX_abs_y_3) MICRO(LDX_abs_y_4)
+    MICRO(LDX_ind_x) MICRO(LDX_ind_x_2) MICRO(LDX_ind_x_3) MICRO(LDX_ind_x_4) MICRO(LDX_ind_x_5)
+    MICRO(LDX_ind_y) MICRO(LDX_ind_y_2) MICRO(LDX_ind_y_3) MICRO(LDX_ind_y_4) MICRO(LDX_ind_y_5)
+
+    MICRO(LDY_imm)
+    MICRO(LDY_zpg)   MICRO(LDY_zpg_2)
+    MICRO(LDY_zpg_x) MICRO(LDY_zpg_x_2) MICRO(LDY_zpg_x_3)
+    MICRO(LDY_abs)   MICRO(LDY_abs_2)   MICRO(LDY_abs_3)
+    MICRO(LDY_abs_x) MICRO(LDY_abs_x_2) MICRO(LDY_abs_x_3) MICRO(LDY_abs_x_4)
+    MICRO(LDY_ind_x) MICRO(LDY_ind_x_2) MICRO(LDY_ind_x_3) MICRO(LDY_ind_x_4) MICRO(LDY_ind_x_5)
+    MICRO(LDY_ind_y) MICRO(LDY_ind_y_2) MICRO(LDY_ind_y_3) MICRO(LDY_ind_y_4) MICRO(LDY_ind_y_5)
+
+    MICRO(LSR_acc)
+    MICRO(LSR_zpg)   MICRO(LSR_zpg_2)   MICRO(LSR_zpg_3)   MICRO(LSR_zpg_4)
+    MICRO(LSR_zpg_x) MICRO(LSR_zpg_x_2) MICRO(LSR_zpg_x_3) MICRO(LSR_zpg_x_4) MICRO(LSR_zpg_x_5)
+    MICRO(LSR_abs)   MICRO(LSR_abs_2)   MICRO(LSR_abs_3)   MICRO(LSR_abs_4)   MICRO(LSR_abs_5)
+    MICRO(LSR_abs_x) MICRO(LSR_abs_x_2) MICRO(LSR_abs_x_3) MICRO(LSR_abs_x_4) MICRO(LSR_abs_x_5) MICRO(LSR_abs_x_6)
+    MICRO(LSR_abs_y) MICRO(LSR_abs_y_2) MICRO(LSR_abs_y_3) MICRO(LSR_abs_y_4) MICRO(LSR_abs_y_5) MICRO(LSR_abs_y_6)
+    MICRO(LSR_ind_x) MICRO(LSR_ind_x_2) MICRO(LSR_ind_x_3) MICRO(LSR_ind_x_4) MICRO(LSR_ind_x_5) MICRO(LSR_ind_x_6) MICRO(LSR_ind_x_7)
+    MICRO(LSR_ind_y) MICRO(LSR_ind_y_2) MICRO(LSR_ind_y_3) MICRO(LSR_ind_y_4) MICRO(LSR_ind_y_5) MICRO(LSR_ind_y_6) MICRO(LSR_ind_y_7)
+
+    MICRO(NOP)
+    MICRO(NOP_imm)
+    MICRO(NOP_zpg)   MICRO(NOP_zpg_2)
+    MICRO(NOP_zpg_x) MICRO(NOP_zpg_x_2) MICRO(NOP_zpg_x_3)
+    MICRO(NOP_abs)   MICRO(NOP_abs_2)   MICRO(NOP_abs_3)
+    MICRO(NOP_abs_x) MICRO(NOP_abs_x_2) MICRO(NOP_abs_x_3) MICRO(NOP_abs_x_4)
+
+    MICRO(ORA_imm)
+    MICRO(ORA_zpg)   MICRO(ORA_zpg_2)
+    MICRO(ORA_zpg_x) MICRO(ORA_zpg_x_2) MICRO(ORA_zpg_x_3)
+    MICRO(ORA_abs)   MICRO(ORA_abs_2)   MICRO(ORA_abs_3)
+    MICRO(ORA_abs_x) MICRO(ORA_abs_x_2) MICRO(ORA_abs_x_3) MICRO(ORA_abs_x_4)
+    MICRO(ORA_abs_y) MICRO(ORA_abs_y_2) MICRO(ORA_abs_y_3) MICRO(ORA_abs_y_4)
+    MICRO(ORA_ind_x) MICRO(ORA_ind_x_2) MICRO(ORA_ind_x_3) MICRO(ORA_ind_x_4) MICRO(ORA_ind_x_5)
+    MICRO(ORA_ind_y) MICRO(ORA_ind_y_2) MICRO(ORA_ind_y_3) MICRO(ORA_ind_y_4) MICRO(ORA_ind_y_5)
+
+    MICRO(PHA) MICRO(PHA_2)
+    MICRO(PHP) MICRO(PHP_2)
+    MICRO(PLA) MICRO(PLA_2) MICRO(PLA_3)
+    MICRO(PLP) MICRO(PLP_2) MICRO(PLP_3)
+
+    MICRO(ROL_acc)
+    MICRO(ROL_zpg)   MICRO(ROL_zpg_2)   MICRO(ROL_zpg_3)   MICRO(ROL_zpg_4)
+    MICRO(ROL_zpg_x) MICRO(ROL_zpg_x_2) MICRO(ROL_zpg_x_3) MICRO(ROL_zpg_x_4) MICRO(ROL_zpg_x_5)
+    MICRO(ROL_abs)   MICRO(ROL_abs_2)   MICRO(ROL_abs_3)   MICRO(ROL_abs_4)   MICRO(ROL_abs_5)
+    MICRO(ROL_abs_x) MICRO(ROL_abs_x_2) MICRO(ROL_abs_x_3) MICRO(ROL_abs_x_4) MICRO(ROL_abs_x_5) MICRO(ROL_abs_x_6)
+    MICRO(ROL_ind_x) MICRO(ROL_ind_x_2) MICRO(ROL_ind_x_3) MICRO(ROL_ind_x_4) MICRO(ROL_ind_x_5) MICRO(ROL_ind_x_6) MICRO(ROL_ind_x_7)
+
+    MICRO(ROR_acc)
+    MICRO(ROR_zpg)   MICRO(ROR_zpg_2)   MICRO(ROR_zpg_3)   MICRO(ROR_zpg_4)
+    MICRO(ROR_zpg_x) MICRO(ROR_zpg_x_2) MICRO(ROR_zpg_x_3) MICRO(ROR_zpg_x_4) MICRO(ROR_zpg_x_5)
+    MICRO(ROR_abs)   MICRO(ROR_abs_2)   MICRO(ROR_abs_3)   MICRO(ROR_abs_4)   MICRO(ROR_abs_5)
+    MICRO(ROR_abs_x) MICRO(ROR_abs_x_2) MICRO(ROR_abs_x_3) MICRO(ROR_abs_x_4) MICRO(ROR_abs_x_5) MICRO(ROR_abs_x_6)
+    MICRO(ROR_ind_x) MICRO(ROR_ind_x_2) MICRO(ROR_ind_x_3) MICRO(ROR_ind_x_4) MICRO(ROR_ind_x_5) MICRO(ROR_ind_x_6) MICRO(ROR_ind_x_7)
+
+    MICRO(RTI) MICRO(RTI_2) MICRO(RTI_3) MICRO(RTI_4) MICRO(RTI_5)
+    MICRO(RTS) MICRO(RTS_2) MICRO(RTS_3) MICRO(RTS_4) MICRO(RTS_5)
+
+    MICRO(SBC_imm)
+    MICRO(SBC_zpg)   MICRO(SBC_zpg_2)
+    MICRO(SBC_zpg_x) MICRO(SBC_zpg_x_2) MICRO(SBC_zpg_x_3)
+    MICRO(SBC_abs)   MICRO(SBC_abs_2)   MICRO(SBC_abs_3)
+    MICRO(SBC_abs_x) MICRO(SBC_abs_x_2) MICRO(SBC_abs_x_3) MICRO(SBC_abs_x_4)
+    MICRO(SBC_abs_y) MICRO(SBC_abs_y_2) MICRO(SBC_abs_y_3) MICRO(SBC_abs_y_4)
+    MICRO(SBC_ind_x) MICRO(SBC_ind_x_2) MICRO(SBC_ind_x_3) MICRO(SBC_ind_x_4) MICRO(SBC_ind_x_5)
+    MICRO(SBC_ind_y) MICRO(SBC_ind_y_2) MICRO(SBC_ind_y_3) MICRO(SBC_ind_y_4) MICRO(SBC_ind_y_5)
+
+    MICRO(SEC)
+    MICRO(SED)
+    MICRO(SEI) MICRO(SEI_cont)
+
+    MICRO(STA_zpg)   MICRO(STA_zpg_2)
+    MICRO(STA_zpg_x) MICRO(STA_zpg_x_2) MICRO(STA_zpg_x_3)
+    MICRO(STA_abs)   MICRO(STA_abs_2)   MICRO(STA_abs_3)
+    MICRO(STA_abs_x) MICRO(STA_abs_x_2) MICRO(STA_abs_x_3) MICRO(STA_abs_x_4)
+    MICRO(STA_abs_y) MICRO(STA_abs_y_2) MICRO(STA_abs_y_3) MICRO(STA_abs_y_4)
+    MICRO(STA_ind_x) MICRO(STA_ind_x_2) MICRO(STA_ind_x_3) MICRO(STA_ind_x_4) MICRO(STA_ind_x_5)
+    MICRO(STA_ind_y) MICRO(STA_ind_y_2) MICRO(STA_ind_y_3) MICRO(STA_ind_y_4) MICRO(STA_ind_y_5)
+
+    MICRO(STX_zpg)   MICRO(STX_zpg_2)
+    MICRO(STX_zpg_y) MICRO(STX_zpg_y_2) MICRO(STX_zpg_y_3)
+    MICRO(STX_abs)   MICRO(STX_abs_2)   MICRO(STX_abs_3)
+
+    MICRO(STY_zpg)   MICRO(STY_zpg_2)
+    MICRO(STY_zpg_x) MICRO(STY_zpg_x_2) MICRO(STY_zpg_x_3)
+    MICRO(STY_abs)   MICRO(STY_abs_2)   MICRO(STY_abs_3)
+
+    MICRO(TAX)
+    MICRO(TAY)
+    MICRO(TSX)
+    MICRO(TXA)
+    MICRO(TXS)
+    MICRO(TYA)
+
+    // Illegal instructions
+
+    MICRO(ALR_imm)
+    MICRO(ANC_imm)
+    MICRO(ANE_imm)
+    MICRO(ARR_imm)
+    MICRO(AXS_imm)
+
+    MICRO(DCP_zpg)   MICRO(DCP_zpg_2)   MICRO(DCP_zpg_3)   MICRO(DCP_zpg_4)
+    MICRO(DCP_zpg_x) MICRO(DCP_zpg_x_2) MICRO(DCP_zpg_x_3) MICRO(DCP_zpg_x_4) MICRO(DCP_zpg_x_5)
+    MICRO(DCP_abs)   MICRO(DCP_abs_2)   MICRO(DCP_abs_3)   MICRO(DCP_abs_4)   MICRO(DCP_abs_5)
+    MICRO(DCP_abs_x) MICRO(DCP_abs_x_2) MICRO(DCP_abs_x_3) MICRO(DCP_abs_x_4) MICRO(DCP_abs_x_5) MICRO(DCP_abs_x_6)
+    MICRO(DCP_abs_y) MICRO(DCP_abs_y_2) MICRO(DCP_abs_y_3) MICRO(DCP_abs_y_4) MICRO(DCP_abs_y_5) MICRO(DCP_abs_y_6)
+    MICRO(DCP_ind_x) MICRO(DCP_ind_x_2) MICRO(DCP_ind_x_3) MICRO(DCP_ind_x_4) MICRO(DCP_ind_x_5) MICRO(DCP_ind_x_6) MICRO(DCP_ind_x_7)
+    MICRO(DCP_ind_y) MICRO(DCP_ind_y_2) MICRO(DCP_ind_y_3) MICRO(DCP_ind_y_4) MICRO(DCP_ind_y_5) MICRO(DCP_ind_y_6) MICRO(DCP_ind_y_7)
+
+    MICRO(ISC_zpg)   MICRO(ISC_zpg_2)   MICRO(ISC_zpg_3)   MICRO(ISC_zpg_4)
+    MICRO(ISC_zpg_x) MICRO(ISC_zpg_x_2) MICRO(ISC_zpg_x_3) MICRO(ISC_zpg_x_4) MICRO(ISC_zpg_x_5)
+    MICRO(ISC_abs)   MICRO(ISC_abs_2)   MICRO(ISC_abs_3)   MICRO(ISC_abs_4)   MICRO(ISC_abs_5)
+    MICRO(ISC_abs_x) MICRO(ISC_abs_x_2) MICRO(ISC_abs_x_3) MICRO(ISC_abs_x_4) MICRO(ISC_abs_x_5) MICRO(ISC_abs_x_6)
+    MICRO(ISC_abs_y) MICRO(ISC_abs_y_2) MICRO(ISC_abs_y_3) MICRO(ISC_abs_y_4) MICRO(ISC_abs_y_5) MICRO(ISC_abs_y_6)
+    MICRO(ISC_ind_x) MICRO(ISC_ind_x_2) MICRO(ISC_ind_x_3) MICRO(ISC_ind_x_4) MICRO(ISC_ind_x_5) MICRO(ISC_ind_x_6) MICRO(ISC_ind_x_7)
+    MICRO(ISC_ind_y) MICRO(ISC_ind_y_2) MICRO(ISC_ind_y_3) MICRO(ISC_ind_y_4) MICRO(ISC_ind_y_5) MICRO(ISC_ind_y_6) MICRO(ISC_ind_y_7)
+
+    MICRO(LAS_abs_y) MICRO(LAS_abs_y_2) MICRO(LAS_abs_y_3) MICRO(LAS_abs_y_4)
+
+    MICRO(LAX_zpg)   MICRO(LAX_zpg_2)
+    MICRO(LAX_zpg_y) MICRO(LAX_zpg_y_2) MICRO(LAX_zpg_y_3)
+    MICRO(LAX_abs)   MICRO(LAX_abs_2)   MICRO(LAX_abs_3)
+    MICRO(LAX_abs_y) MICRO(LAX_abs_y_2) MICRO(LAX_abs_y_3) MICRO(LAX_abs_y_4)
+    MICRO(LAX_ind_x) MICRO(LAX_ind_x_2) MICRO(LAX_ind_x_3) MICRO(LAX_ind_x_4) MICRO(LAX_ind_x_5)
+    MICRO(LAX_ind_y) MICRO(LAX_ind_y_2) MICRO(LAX_ind_y_3) MICRO(LAX_ind_y_4) MICRO(LAX_ind_y_5)
+
+    MICRO(LXA_imm)
+
+    MICRO(RLA_zpg)   MICRO(RLA_zpg_2)   MICRO(RLA_zpg_3)   MICRO(RLA_zpg_4)
+    MICRO(RLA_zpg_x) MICRO(RLA_zpg_x_2) MICRO(RLA_zpg_x_3) MICRO(RLA_zpg_x_4) MICRO(RLA_zpg_x_5)
+    MICRO(RLA_abs)   MICRO(RLA_abs_2)   MICRO(RLA_abs_3)   MICRO(RLA_abs_4)   MICRO(RLA_abs_5)
+    MICRO(RLA_abs_x) MICRO(RLA_abs_x_2) MICRO(RLA_abs_x_3) MICRO(RLA_abs_x_4) MICRO(RLA_abs_x_5) MICRO(RLA_abs_x_6)
+    MICRO(RLA_abs_y) MICRO(RLA_abs_y_2) MICRO(RLA_abs_y_3) MICRO(RLA_abs_y_4) MICRO(RLA_abs_y_5) MICRO(RLA_abs_y_6)
+    MICRO(RLA_ind_x) MICRO(RLA_ind_x_2) MICRO(RLA_ind_x_3) MICRO(RLA_ind_x_4) MICRO(RLA_ind_x_5) MICRO(RLA_ind_x_6) MICRO(RLA_ind_x_7)
+    MICRO(RLA_ind_y) MICRO(RLA_ind_y_2) MICRO(RLA_ind_y_3) MICRO(RLA_ind_y_4) MICRO(RLA_ind_y_5) MICRO(RLA_ind_y_6) MICRO(RLA_ind_y_7)
+
+    MICRO(RRA_zpg)   MICRO(RRA_zpg_2)   MICRO(RRA_zpg_3)   MICRO(RRA_zpg_4)
+    MICRO(RRA_zpg_x) MICRO(RRA_zpg_x_2) MICRO(RRA_zpg_x_3) MICRO(RRA_zpg_x_4) MICRO(RRA_zpg_x_5)
+    MICRO(RRA_abs)   MICRO(RRA_abs_2)   MICRO(RRA_abs_3)   MICRO(RRA_abs_4)   MICRO(RRA_abs_5)
+    MICRO(RRA_abs_x) MICRO(RRA_abs_x_2) MICRO(RRA_abs_x_3) MICRO(RRA_abs_x_4) MICRO(RRA_abs_x_5) MICRO(RRA_abs_x_6)
+    MICRO(RRA_abs_y) MICRO(RRA_abs_y_2) MICRO(RRA_abs_y_3) MICRO(RRA_abs_y_4) MICRO(RRA_abs_y_5) MICRO(RRA_abs_y_6)
+    MICRO(RRA_ind_x) MICRO(RRA_ind_x_2) MICRO(RRA_ind_x_3) MICRO(RRA_ind_x_4) MICRO(RRA_ind_x_5) MICRO(RRA_ind_x_6) MICRO(RRA_ind_x_7)
+    MICRO(RRA_ind_y) MICRO(RRA_ind_y_2) MICRO(RRA_ind_y_3) MICRO(RRA_ind_y_4) MICRO(RRA_ind_y_5) MICRO(RRA_ind_y_6) MICRO(RRA_ind_y_7)
+
+    MICRO(SAX_zpg)   MICRO(SAX_zpg_2)
+    MICRO(SAX_zpg_y) MICRO(SAX_zpg_y_2) MICRO(SAX_zpg_y_3)
+    MICRO(SAX_abs)   MICRO(SAX_abs_2)   MICRO(SAX_abs_3)
+    MICRO(SAX_ind_x) MICRO(SAX_ind_x_2) MICRO(SAX_ind_x_3) MICRO(SAX_ind_x_4) MICRO(SAX_ind_x_5)
+
+    MICRO(SHA_ind_y) MICRO(SHA_ind_y_2) MICRO(SHA_ind_y_3) MICRO(SHA_ind_y_4) MICRO(SHA_ind_y_5)
+    MICRO(SHA_abs_y) MICRO(SHA_abs_y_2) MICRO(SHA_abs_y_3) MICRO(SHA_abs_y_4)
+
+    MICRO(SHX_abs_y) MICRO(SHX_abs_y_2) MICRO(SHX_abs_y_3) MICRO(SHX_abs_y_4)
+    MICRO(SHY_abs_x) MICRO(SHY_abs_x_2) MICRO(SHY_abs_x_3) MICRO(SHY_abs_x_4)
+
+    MICRO(SLO_zpg)   MICRO(SLO_zpg_2)   MICRO(SLO_zpg_3)   MICRO(SLO_zpg_4)
+    MICRO(SLO_zpg_x) MICRO(SLO_zpg_x_2) MICRO(SLO_zpg_x_3) MICRO(SLO_zpg_x_4) MICRO(SLO_zpg_x_5)
+    MICRO(SLO_abs)   MICRO(SLO_abs_2)   MICRO(SLO_abs_3)   MICRO(SLO_abs_4)   MICRO(SLO_abs_5)
+    MICRO(SLO_abs_x) MICRO(SLO_abs_x_2) MICRO(SLO_abs_x_3) MICRO(SLO_abs_x_4) MICRO(SLO_abs_x_5) MICRO(SLO_abs_x_6)
+    MICRO(SLO_abs_y) MICRO(SLO_abs_y_2) MICRO(SLO_abs_y_3) MICRO(SLO_abs_y_4) MICRO(SLO_abs_y_5) MICRO(SLO_abs_y_6)
+    MICRO(SLO_ind_x) MICRO(SLO_ind_x_2) MICRO(SLO_ind_x_3) MICRO(SLO_ind_x_4) MICRO(SLO_ind_x_5) MICRO(SLO_ind_x_6) MICRO(SLO_ind_x_7)
+    MICRO(SLO_ind_y) MICRO(SLO_ind_y_2) MICRO(SLO_ind_y_3) MICRO(SLO_ind_y_4) MICRO(SLO_ind_y_5) MICRO(SLO_ind_y_6) MICRO(SLO_ind_y_7)
+
+    MICRO(SRE_zpg)   MICRO(SRE_zpg_2)   MICRO(SRE_zpg_3)   MICRO(SRE_zpg_4)
+    MICRO(SRE_zpg_x) MICRO(SRE_zpg_x_2) MICRO(SRE_zpg_x_3) MICRO(SRE_zpg_x_4) MICRO(SRE_zpg_x_5)
+    MICRO(SRE_abs)   MICRO(SRE_abs_2)   MICRO(SRE_abs_3)   MICRO(SRE_abs_4)   MICRO(SRE_abs_5)
+    MICRO(SRE_abs_x) MICRO(SRE_abs_x_2) MICRO(SRE_abs_x_3) MICRO(SRE_abs_x_4) MICRO(SRE_abs_x_5) MICRO(SRE_abs_x_6)
+    MICRO(SRE_abs_y) MICRO(SRE_abs_y_2) MICRO(SRE_abs_y_3) MICRO(SRE_abs_y_4) MICRO(SRE_abs_y_5) MICRO(SRE_abs_y_6)
+    MICRO(SRE_ind_x) MICRO(SRE_ind_x_2) MICRO(SRE_ind_x_3) MICRO(SRE_ind_x_4) MICRO(SRE_ind_x_5) MICRO(SRE_ind_x_6) MICRO(SRE_ind_x_7)
+    MICRO(SRE_ind_y) MICRO(SRE_ind_y_2) MICRO(SRE_ind_y_3) MICRO(SRE_ind_y_4) MICRO(SRE_ind_y_5) MICRO(SRE_ind_y_6) MICRO(SRE_ind_y_7)
+
+    MICRO(TAS_abs_y) MICRO(TAS_abs_y_2) MICRO(TAS_abs_y_3) MICRO(TAS_abs_y_4)
@@ -0,0 +1,2735 @@
+// -----------------------------------------------------------------------------
+// This file is part of Peddle - A MOS 65xx CPU emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Published under the terms of the MIT License
+// -----------------------------------------------------------------------------
+
+/* This file contains the microcode of all instructions. It is included by
+ * both CPU dispatchers. Before including, macro MICROCODE(x) has to be
+ * defined to turn a microinstruction into a jump target, i.e., a case label
+ * for the switch dispatcher and a label for the threaded dispatcher. Macro
+ * FALLTHROUGH marks microinstructions that continue with the next one.
+ */
+
+        MICROCODE(fetch):
+
+            if constexpr (C != CPURevision::MOS_6507) {
+
+                // Check interrupt lines
+                if (unlikely(doNmi)) {
+
+                    nmiWillTrigger();
+                    IDLE_FETCH
+                    edgeDetector.clear();
+                    next = nmi_2;
+                    doNmi = false;
+                    doIrq = false; // NMI wins
+                    return;
+
+                } else if (unlikely(doIrq)) {
+
+                    irqWillTrigger();
+                    IDLE_FETCH
+                    next = irq_2;
+                    doIrq = false;
+                    return;
+                }
+            }
+
+            // Execute the Fetch phase
+            FETCH_IR
+            next = actionFunc[reg.ir];
+            return;
+            
+            //
+            // Illegal instructions
+            //
+            
+        MICROCODE(JAM):
+
+            cpuDidJam();
+            CONTINUE
+
+        MICROCODE(JAM_2):
+            
+            POLL_INT
+            DONE
+
+            //
+            // IRQ handling
+            //
+            
+        MICROCODE(irq_2):
+            
+            IDLE_READ_IMPLIED
+            CONTINUE
+            
+        MICROCODE(irq_3):
+            
+            PUSH_PCH
+            CONTINUE
+            
+        MICROCODE(irq_4):
+            
+            PUSH_PCL
+            // Check for interrupt hijacking
+            // If there is a positive edge on the NMI line ...
+            if (edgeDetector.current()) {
+                
+                // ... jump to the NMI vector instead of the IRQ vector.
+                edgeDetector.clear();
+                next = nmi_5;
+                return;
+            }
+            CONTINUE
+            
+        MICROCODE(irq_5):
+            
+            write<C>(0x100+(reg.sp--), getPWithClearedB());
+            CONTINUE
+            
+        MICROCODE(irq_6):
+            
+            READ_FROM(0xFFFE)
+            SET_PCL(reg.d);
+            setI(1);
+            CONTINUE
+            
+        MICROCODE(irq_7):
+            
+            READ_FROM(0xFFFF)
+            SET_PCH(reg.d);
+            irqDidTrigger();
+            DONE
+            
+            //
+            // NMI handling
+            //
+
+        MICROCODE(nmi_2):
+
+            IDLE_READ_IMPLIED
+            CONTINUE
+            
+        MICROCODE(nmi_3):
+            
+            PUSH_PCH
+            CONTINUE
+            
+        MICROCODE(nmi_4):
+            
+            PUSH_PCL
+            CONTINUE
+            
+        MICROCODE(nmi_5):
+            
+            write<C>(0x100+(reg.sp--), getPWithClearedB());
+            CONTINUE
+            
+        MICROCODE(nmi_6):
+            
+            READ_FROM(0xFFFA)
+            SET_PCL(reg.d);
+            setI(1);
+            CONTINUE
+            
+        MICROCODE(nmi_7):
+
+            READ_FROM(0xFFFB)
+            SET_PCH(reg.d);
+            nmiDidTrigger();
+            DONE
+
+            //
+            // Adressing mode: Immediate (shared behavior)
+            //
+
+        MICROCODE(BRK): MICROCODE(RTI): MICROCODE(RTS):
+            
+            IDLE_READ_IMMEDIATE
+            CONTINUE
+            
+            //
+            // Adressing mode: Implied (shared behavior)
+            //
+
+        MICROCODE(PHA): MICROCODE(PHP): MICROCODE(PLA): MICROCODE(PLP):
+            
+            IDLE_READ_IMPLIED
+            CONTINUE
+            
+            //
+            // Adressing mode: Zero-Page  (shared behavior)
+            //
+
+        MICROCODE(ADC_zpg): MICROCODE(AND_zpg): MICROCODE(ASL_zpg): MICROCODE(BIT_zpg):
+        MICROCODE(CMP_zpg): MICROCODE(CPX_zpg): MICROCODE(CPY_zpg): MICROCODE(DEC_zpg):
+        MICROCODE(EOR_zpg): MICROCODE(INC_zpg): MICROCODE(LDA_zpg): MICROCODE(LDX_zpg):
+        MICROCODE(LDY_zpg): MICROCODE(LSR_zpg): MICROCODE(NOP_zpg): MICROCODE(ORA_zpg):
+        MICROCODE(ROL_zpg): MICROCODE(ROR_zpg): MICROCODE(SBC_zpg): MICROCODE(STA_zpg):
+        MICROCODE(STX_zpg): MICROCODE(STY_zpg): MICROCODE(DCP_zpg): MICROCODE(ISC_zpg):
+        MICROCODE(LAX_zpg): MICROCODE(RLA_zpg): MICROCODE(RRA_zpg): MICROCODE(SAX_zpg):
+        MICROCODE(SLO_zpg): MICROCODE(SRE_zpg):
+            
+            FETCH_ADDR_LO
+            CONTINUE
+            
+        MICROCODE(ASL_zpg_2): MICROCODE(DEC_zpg_2): MICROCODE(INC_zpg_2): MICROCODE(LSR_zpg_2):
+        MICROCODE(ROL_zpg_2): MICROCODE(ROR_zpg_2): MICROCODE(DCP_zpg_2): MICROCODE(ISC_zpg_2):
+        MICROCODE(RLA_zpg_2): MICROCODE(RRA_zpg_2): MICROCODE(SLO_zpg_2): MICROCODE(SRE_zpg_2):
+            
+            READ_FROM_ZERO_PAGE
+            CONTINUE
+            
+            //
+            // Adressing mode: Zero-Page Indexed (shared behavior)
+            //
+            
+        MICROCODE(ADC_zpg_x): MICROCODE(AND_zpg_x): MICROCODE(ASL_zpg_x): MICROCODE(CMP_zpg_x):
+        MICROCODE(DEC_zpg_x): MICROCODE(EOR_zpg_x): MICROCODE(INC_zpg_x): MICROCODE(LDA_zpg_x):
+        MICROCODE(LDY_zpg_x): MICROCODE(LSR_zpg_x): MICROCODE(NOP_zpg_x): MICROCODE(ORA_zpg_x):
+        MICROCODE(ROL_zpg_x): MICROCODE(ROR_zpg_x): MICROCODE(SBC_zpg_x): MICROCODE(STA_zpg_x):
+        MICROCODE(STY_zpg_x): MICROCODE(DCP_zpg_x): MICROCODE(ISC_zpg_x): MICROCODE(RLA_zpg_x):
+        MICROCODE(RRA_zpg_x): MICROCODE(SLO_zpg_x): MICROCODE(SRE_zpg_x):
+
+        MICROCODE(LDX_zpg_y): MICROCODE(STX_zpg_y): MICROCODE(LAX_zpg_y): MICROCODE(SAX_zpg_y):
+            
+            FETCH_ADDR_LO
+            CONTINUE
+
+        MICROCODE(ADC_zpg_x_2): MICROCODE(AND_zpg_x_2): MICROCODE(ASL_zpg_x_2): MICROCODE(CMP_zpg_x_2):
+        MICROCODE(DEC_zpg_x_2): MICROCODE(EOR_zpg_x_2): MICROCODE(INC_zpg_x_2): MICROCODE(LDA_zpg_x_2):
+        MICROCODE(LDY_zpg_x_2): MICROCODE(LSR_zpg_x_2): MICROCODE(NOP_zpg_x_2): MICROCODE(ORA_zpg_x_2):
+        MICROCODE(ROL_zpg_x_2): MICROCODE(ROR_zpg_x_2): MICROCODE(SBC_zpg_x_2): MICROCODE(DCP_zpg_x_2):
+        MICROCODE(ISC_zpg_x_2): MICROCODE(RLA_zpg_x_2): MICROCODE(RRA_zpg_x_2): MICROCODE(SLO_zpg_x_2):
+        MICROCODE(SRE_zpg_x_2): MICROCODE(STA_zpg_x_2): MICROCODE(STY_zpg_x_2):
+            
+            READ_FROM_ZERO_PAGE
+            ADD_INDEX_X
+            CONTINUE
+
+        MICROCODE(LDX_zpg_y_2): MICROCODE(LAX_zpg_y_2): MICROCODE(STX_zpg_y_2): MICROCODE(SAX_zpg_y_2):
+            
+            READ_FROM_ZERO_PAGE
+            ADD_INDEX_Y
+            CONTINUE
+
+        MICROCODE(ASL_zpg_x_3): MICROCODE(DEC_zpg_x_3): MICROCODE(INC_zpg_x_3): MICROCODE(LSR_zpg_x_3):
+        MICROCODE(ROL_zpg_x_3): MICROCODE(ROR_zpg_x_3): MICROCODE(DCP_zpg_x_3): MICROCODE(ISC_zpg_x_3):
+        MICROCODE(RLA_zpg_x_3): MICROCODE(RRA_zpg_x_3): MICROCODE(SLO_zpg_x_3): MICROCODE(SRE_zpg_x_3):
+            
+            READ_FROM_ZERO_PAGE
+            CONTINUE
+            
+            
+            //
+            // Adressing mode: Absolute (shared behavior)
+            //
+            
+        MICROCODE(ADC_abs): MICROCODE(AND_abs): MICROCODE(ASL_abs): MICROCODE(BIT_abs):
+        MICROCODE(CMP_abs): MICROCODE(CPX_abs): MICROCODE(CPY_abs): MICROCODE(DEC_abs):
+        MICROCODE(EOR_abs): MICROCODE(INC_abs): MICROCODE(LDA_abs): MICROCODE(LDX_abs):
+        MICROCODE(LDY_abs): MICROCODE(LSR_abs): MICROCODE(NOP_abs): MICROCODE(ORA_abs):
+        MICROCODE(ROL_abs): MICROCODE(ROR_abs): MICROCODE(SBC_abs): MICROCODE(STA_abs):
+        MICROCODE(STX_abs): MICROCODE(STY_abs): MICROCODE(DCP_abs): MICROCODE(ISC_abs):
+        MICROCODE(LAX_abs): MICROCODE(RLA_abs): MICROCODE(RRA_abs): MICROCODE(SAX_abs):
+        MICROCODE(SLO_abs): MICROCODE(SRE_abs):
+            
+            FETCH_ADDR_LO
+            CONTINUE
+
+        MICROCODE(ADC_abs_2): MICROCODE(AND_abs_2): MICROCODE(ASL_abs_2): MICROCODE(BIT_abs_2):
+        MICROCODE(CMP_abs_2): MICROCODE(CPX_abs_2): MICROCODE(CPY_abs_2): MICROCODE(DEC_abs_2):
+        MICROCODE(EOR_abs_2): MICROCODE(INC_abs_2): MICROCODE(LDA_abs_2): MICROCODE(LDX_abs_2):
+        MICROCODE(LDY_abs_2): MICROCODE(LSR_abs_2): MICROCODE(NOP_abs_2): MICROCODE(ORA_abs_2):
+        MICROCODE(ROL_abs_2): MICROCODE(ROR_abs_2): MICROCODE(SBC_abs_2): MICROCODE(STA_abs_2):
+        MICROCODE(STX_abs_2): MICROCODE(STY_abs_2): MICROCODE(DCP_abs_2): MICROCODE(ISC_abs_2):
+        MICROCODE(LAX_abs_2): MICROCODE(RLA_abs_2): MICROCODE(RRA_abs_2): MICROCODE(SAX_abs_2):
+        MICROCODE(SLO_abs_2): MICROCODE(SRE_abs_2):
+            
+            FETCH_ADDR_HI
+            CONTINUE
+            
+        MICROCODE(ASL_abs_3): MICROCODE(DEC_abs_3): MICROCODE(INC_abs_3): MICROCODE(LSR_abs_3):
+        MICROCODE(ROL_abs_3): MICROCODE(ROR_abs_3): MICROCODE(DCP_abs_3): MICROCODE(ISC_abs_3):
+        MICROCODE(RLA_abs_3): MICROCODE(RRA_abs_3): MICROCODE(SLO_abs_3): MICROCODE(SRE_abs_3):
+            
+            READ_FROM_ADDRESS
+            CONTINUE
+            
+            //
+            // Adressing mode: Absolute Indexed (shared behavior)
+            //
+            
+        MICROCODE(ADC_abs_x): MICROCODE(AND_abs_x): MICROCODE(ASL_abs_x): MICROCODE(CMP_abs_x):
+        MICROCODE(DEC_abs_x): MICROCODE(EOR_abs_x): MICROCODE(INC_abs_x): MICROCODE(LDA_abs_x):
+        MICROCODE(LDY_abs_x): MICROCODE(LSR_abs_x): MICROCODE(NOP_abs_x): MICROCODE(ORA_abs_x):
+        MICROCODE(ROL_abs_x): MICROCODE(ROR_abs_x): MICROCODE(SBC_abs_x): MICROCODE(STA_abs_x):
+        MICROCODE(DCP_abs_x): MICROCODE(ISC_abs_x): MICROCODE(RLA_abs_x): MICROCODE(RRA_abs_x):
+        MICROCODE(SHY_abs_x): MICROCODE(SLO_abs_x): MICROCODE(SRE_abs_x):
+            
+        MICROCODE(ADC_abs_y): MICROCODE(AND_abs_y): MICROCODE(CMP_abs_y): MICROCODE(EOR_abs_y):
+        MICROCODE(LDA_abs_y): MICROCODE(LDX_abs_y): MICROCODE(LSR_abs_y): MICROCODE(ORA_abs_y):
+        MICROCODE(SBC_abs_y): MICROCODE(STA_abs_y): MICROCODE(DCP_abs_y): MICROCODE(ISC_abs_y):
+        MICROCODE(LAS_abs_y): MICROCODE(LAX_abs_y): MICROCODE(RLA_abs_y): MICROCODE(RRA_abs_y):
+        MICROCODE(SHA_abs_y): MICROCODE(SHX_abs_y): MICROCODE(SLO_abs_y): MICROCODE(SRE_abs_y):
+        MICROCODE(TAS_abs_y):
+            
+            FETCH_ADDR_LO
+            CONTINUE
+            
+        MICROCODE(ADC_abs_x_2): MICROCODE(AND_abs_x_2): MICROCODE(ASL_abs_x_2): MICROCODE(CMP_abs_x_2):
+        MICROCODE(DEC_abs_x_2): MICROCODE(EOR_abs_x_2): MICROCODE(INC_abs_x_2): MICROCODE(LDA_abs_x_2):
+        MICROCODE(LDY_abs_x_2): MICROCODE(LSR_abs_x_2): MICROCODE(NOP_abs_x_2): MICROCODE(ORA_abs_x_2):
+        MICROCODE(ROL_abs_x_2): MICROCODE(ROR_abs_x_2): MICROCODE(SBC_abs_x_2): MICROCODE(STA_abs_x_2):
+        MICROCODE(DCP_abs_x_2): MICROCODE(ISC_abs_x_2): MICROCODE(RLA_abs_x_2): MICROCODE(RRA_abs_x_2):
+        MICROCODE(SHY_abs_x_2): MICROCODE(SLO_abs_x_2): MICROCODE(SRE_abs_x_2):
+            
+            FETCH_ADDR_HI
+            ADD_INDEX_X
+            CONTINUE
+            
+        MICROCODE(ADC_abs_y_2): MICROCODE(AND_abs_y_2): MICROCODE(CMP_abs_y_2): MICROCODE(EOR_abs_y_2):
+        MICROCODE(LDA_abs_y_2): MICROCODE(LDX_abs_y_2): MICROCODE(LSR_abs_y_2): MICROCODE(ORA_abs_y_2):
+        MICROCODE(SBC_abs_y_2): MICROCODE(STA_abs_y_2): MICROCODE(DCP_abs_y_2): MICROCODE(ISC_abs_y_2):
+        MICROCODE(LAS_abs_y_2): MICROCODE(LAX_abs_y_2): MICROCODE(RLA_abs_y_2): MICROCODE(RRA_abs_y_2):
+        MICROCODE(SHA_abs_y_2): MICROCODE(SHX_abs_y_2): MICROCODE(SLO_abs_y_2): MICROCODE(SRE_abs_y_2):
+        MICROCODE(TAS_abs_y_2):
+            
+            FETCH_ADDR_HI
+            ADD_INDEX_Y
+            CONTINUE
+            
+        MICROCODE(ASL_abs_x_3): MICROCODE(DEC_abs_x_3): MICROCODE(INC_abs_x_3): MICROCODE(LSR_abs_x_3):
+        MICROCODE(ROL_abs_x_3): MICROCODE(ROR_abs_x_3): MICROCODE(DCP_abs_x_3): MICROCODE(ISC_abs_x_3):
+        MICROCODE(RLA_abs_x_3): MICROCODE(RRA_abs_x_3): MICROCODE(STA_abs_x_3): MICROCODE(SLO_abs_x_3):
+        MICROCODE(SRE_abs_x_3):
+
+        MICROCODE(LSR_abs_y_3): MICROCODE(STA_abs_y_3): MICROCODE(DCP_abs_y_3): MICROCODE(ISC_abs_y_3):
+        MICROCODE(RLA_abs_y_3): MICROCODE(RRA_abs_y_3): MICROCODE(SLO_abs_y_3): MICROCODE(SRE_abs_y_3):
+            
+            READ_FROM_ADDRESS
+            if (PAGE_BOUNDARY_CROSSED) { FIX_ADDR_HI }
+            CONTINUE
+            
+        MICROCODE(ASL_abs_x_4): MICROCODE(DEC_abs_x_4): MICROCODE(INC_abs_x_4): MICROCODE(LSR_abs_x_4):
+        MICROCODE(ROL_abs_x_4): MICROCODE(ROR_abs_x_4): MICROCODE(DCP_abs_x_4): MICROCODE(ISC_abs_x_4):
+        MICROCODE(RLA_abs_x_4): MICROCODE(RRA_abs_x_4): MICROCODE(SLO_abs_x_4): MICROCODE(SRE_abs_x_4):
+            
+        MICROCODE(DCP_abs_y_4): MICROCODE(LSR_abs_y_4): MICROCODE(ISC_abs_y_4): MICROCODE(RLA_abs_y_4):
+        MICROCODE(RRA_abs_y_4): MICROCODE(SLO_abs_y_4): MICROCODE(SRE_abs_y_4):
+            
+            READ_FROM_ADDRESS
+            CONTINUE
+            
+            //
+            // Adressing mode: Indexed Indirect (shared behavior)
+            //
+
+        MICROCODE(ADC_ind_x): MICROCODE(AND_ind_x): MICROCODE(ASL_ind_x): MICROCODE(CMP_ind_x):
+        MICROCODE(DEC_ind_x): MICROCODE(EOR_ind_x): MICROCODE(INC_ind_x): MICROCODE(LDA_ind_x):
+        MICROCODE(LDX_ind_x): MICROCODE(LDY_ind_x): MICROCODE(LSR_ind_x): MICROCODE(ORA_ind_x):
+        MICROCODE(ROL_ind_x): MICROCODE(ROR_ind_x): MICROCODE(SBC_ind_x): MICROCODE(STA_ind_x):
+        MICROCODE(DCP_ind_x): MICROCODE(ISC_ind_x): MICROCODE(LAX_ind_x): MICROCODE(RLA_ind_x):
+        MICROCODE(RRA_ind_x): MICROCODE(SAX_ind_x): MICROCODE(SLO_ind_x): MICROCODE(SRE_ind_x):
+            
+            FETCH_POINTER_ADDR
+            CONTINUE
+            
+        MICROCODE(ADC_ind_x_2): MICROCODE(AND_ind_x_2): MICROCODE(ASL_ind_x_2): MICROCODE(CMP_ind_x_2):
+        MICROCODE(DEC_ind_x_2): MICROCODE(EOR_ind_x_2): MICROCODE(INC_ind_x_2): MICROCODE(LDA_ind_x_2):
+        MICROCODE(LDX_ind_x_2): MICROCODE(LDY_ind_x_2): MICROCODE(LSR_ind_x_2): MICROCODE(ORA_ind_x_2):
+        MICROCODE(ROL_ind_x_2): MICROCODE(ROR_ind_x_2): MICROCODE(SBC_ind_x_2): MICROCODE(STA_ind_x_2):
+        MICROCODE(DCP_ind_x_2): MICROCODE(ISC_ind_x_2): MICROCODE(LAX_ind_x_2): MICROCODE(RLA_ind_x_2):
+        MICROCODE(RRA_ind_x_2): MICROCODE(SAX_ind_x_2): MICROCODE(SLO_ind_x_2): MICROCODE(SRE_ind_x_2):
+            
+            IDLE_READ_FROM_ADDRESS_INDIRECT
+            ADD_INDEX_X_INDIRECT
+            CONTINUE
+            
+        MICROCODE(ADC_ind_x_3): MICROCODE(AND_ind_x_3): MICROCODE(ASL_ind_x_3): MICROCODE(CMP_ind_x_3):
+        MICROCODE(DEC_ind_x_3): MICROCODE(EOR_ind_x_3): MICROCODE(INC_ind_x_3): MICROCODE(LDA_ind_x_3):
+        MICROCODE(LDX_ind_x_3): MICROCODE(LDY_ind_x_3): MICROCODE(LSR_ind_x_3): MICROCODE(ORA_ind_x_3):
+        MICROCODE(ROL_ind_x_3): MICROCODE(ROR_ind_x_3): MICROCODE(SBC_ind_x_3): MICROCODE(STA_ind_x_3):
+        MICROCODE(DCP_ind_x_3): MICROCODE(ISC_ind_x_3): MICROCODE(LAX_ind_x_3): MICROCODE(RLA_ind_x_3):
+        MICROCODE(RRA_ind_x_3): MICROCODE(SAX_ind_x_3): MICROCODE(SLO_ind_x_3): MICROCODE(SRE_ind_x_3):
+            
+            FETCH_ADDR_LO_INDIRECT
+            CONTINUE
+            
+        MICROCODE(ADC_ind_x_4): MICROCODE(AND_ind_x_4): MICROCODE(ASL_ind_x_4): MICROCODE(CMP_ind_x_4):
+        MICROCODE(DEC_ind_x_4): MICROCODE(EOR_ind_x_4): MICROCODE(INC_ind_x_4): MICROCODE(LDA_ind_x_4):
+        MICROCODE(LDX_ind_x_4): MICROCODE(LDY_ind_x_4): MICROCODE(LSR_ind_x_4): MICROCODE(ORA_ind_x_4):
+        MICROCODE(ROL_ind_x_4): MICROCODE(ROR_ind_x_4): MICROCODE(SBC_ind_x_4): MICROCODE(STA_ind_x_4):
+        MICROCODE(DCP_ind_x_4): MICROCODE(ISC_ind_x_4): MICROCODE(LAX_ind_x_4): MICROCODE(RLA_ind_x_4):
+        MICROCODE(RRA_ind_x_4): MICROCODE(SAX_ind_x_4): MICROCODE(SLO_ind_x_4): MICROCODE(SRE_ind_x_4):
+            
+            FETCH_ADDR_HI_INDIRECT
+            CONTINUE
+            
+        MICROCODE(ASL_ind_x_5): MICROCODE(DEC_ind_x_5): MICROCODE(INC_ind_x_5): MICROCODE(LSR_ind_x_5):
+        MICROCODE(ROL_ind_x_5): MICROCODE(ROR_ind_x_5): MICROCODE(DCP_ind_x_5): MICROCODE(ISC_ind_x_5):
+        MICROCODE(RLA_ind_x_5): MICROCODE(RRA_ind_x_5): MICROCODE(SLO_ind_x_5): MICROCODE(SRE_ind_x_5):
+            
+            READ_FROM_ADDRESS
+            CONTINUE
+            
+            //
+            // Adressing mode: Indirect Indexed (shared behavior)
+            //
+            
+        MICROCODE(ADC_ind_y): MICROCODE(AND_ind_y): MICROCODE(CMP_ind_y): MICROCODE(EOR_ind_y):
+        MICROCODE(LDA_ind_y): MICROCODE(LDX_ind_y): MICROCODE(LDY_ind_y): MICROCODE(LSR_ind_y):
+        MICROCODE(ORA_ind_y): MICROCODE(SBC_ind_y): MICROCODE(STA_ind_y): MICROCODE(DCP_ind_y):
+        MICROCODE(ISC_ind_y): MICROCODE(LAX_ind_y): MICROCODE(RLA_ind_y): MICROCODE(RRA_ind_y):
+        MICROCODE(SHA_ind_y): MICROCODE(SLO_ind_y): MICROCODE(SRE_ind_y):
+            
+            FETCH_POINTER_ADDR
+            CONTINUE
+
+        MICROCODE(ADC_ind_y_2): MICROCODE(AND_ind_y_2): MICROCODE(CMP_ind_y_2): MICROCODE(EOR_ind_y_2):
+        MICROCODE(LDA_ind_y_2): MICROCODE(LDX_ind_y_2): MICROCODE(LDY_ind_y_2): MICROCODE(LSR_ind_y_2):
+        MICROCODE(ORA_ind_y_2): MICROCODE(SBC_ind_y_2): MICROCODE(STA_ind_y_2): MICROCODE(DCP_ind_y_2):
+        MICROCODE(ISC_ind_y_2): MICROCODE(LAX_ind_y_2): MICROCODE(RLA_ind_y_2): MICROCODE(RRA_ind_y_2):
+        MICROCODE(SHA_ind_y_2): MICROCODE(SLO_ind_y_2): MICROCODE(SRE_ind_y_2):
+            
+            FETCH_ADDR_LO_INDIRECT
+            CONTINUE
+            
+        MICROCODE(ADC_ind_y_3): MICROCODE(AND_ind_y_3): MICROCODE(CMP_ind_y_3): MICROCODE(EOR_ind_y_3):
+        MICROCODE(LDA_ind_y_3): MICROCODE(LDX_ind_y_3): MICROCODE(LDY_ind_y_3): MICROCODE(LSR_ind_y_3):
+        MICROCODE(ORA_ind_y_3): MICROCODE(SBC_ind_y_3): MICROCODE(STA_ind_y_3): MICROCODE(DCP_ind_y_3):
+        MICROCODE(ISC_ind_y_3): MICROCODE(LAX_ind_y_3): MICROCODE(RLA_ind_y_3): MICROCODE(RRA_ind_y_3):
+        MICROCODE(SHA_ind_y_3): MICROCODE(SLO_ind_y_3): MICROCODE(SRE_ind_y_3):
+            
+            FETCH_ADDR_HI_INDIRECT
+            ADD_INDEX_Y
+            CONTINUE
+
+        MICROCODE(LSR_ind_y_4): MICROCODE(STA_ind_y_4): MICROCODE(DCP_ind_y_4): MICROCODE(ISC_ind_y_4):
+        MICROCODE(RLA_ind_y_4): MICROCODE(RRA_ind_y_4): MICROCODE(SLO_ind_y_4): MICROCODE(SRE_ind_y_4):
+            
+            READ_FROM_ADDRESS
+            if (PAGE_BOUNDARY_CROSSED) { FIX_ADDR_HI }
+            CONTINUE
+            
+        MICROCODE(LSR_ind_y_5): MICROCODE(DCP_ind_y_5): MICROCODE(ISC_ind_y_5): MICROCODE(RLA_ind_y_5):
+        MICROCODE(RRA_ind_y_5): MICROCODE(SLO_ind_y_5): MICROCODE(SRE_ind_y_5):
+            
+            READ_FROM_ADDRESS
+            CONTINUE
+            
+            //
+            // Adressing mode: Relative (shared behavior)
+            //
+            
+        MICROCODE(BCC_rel_2): MICROCODE(BCS_rel_2): MICROCODE(BEQ_rel_2): MICROCODE(BMI_rel_2):
+        MICROCODE(BNE_rel_2): MICROCODE(BPL_rel_2): MICROCODE(BVC_rel_2): MICROCODE(BVS_rel_2):
+        {
+            IDLE_READ_IMPLIED
+            u8 pc_hi = HI_BYTE(reg.pc);
+            reg.pc += (i8)reg.d;
+            
+            if (unlikely(pc_hi != HI_BYTE(reg.pc))) {
+                next = (reg.d & 0x80) ? branch_3_underflow : branch_3_overflow;
+                return;
+            }
+            DONE
+        }
+            
+        MICROCODE(branch_3_underflow):
+            
+            IDLE_READ_FROM(reg.pc + 0x100)
+            POLL_INT_AGAIN
+            DONE
+            
+        MICROCODE(branch_3_overflow):
+            
+            IDLE_READ_FROM(reg.pc - 0x100)
+            POLL_INT_AGAIN
+            DONE
+            
+            
+            // Instruction: ADC
+            //
+            // Operation:   A,C := A+M+C
+            //
+            // Flags:       N Z C I D V
+            //              / / / - - /
+
+        MICROCODE(ADC_imm):
+
+            READ_IMMEDIATE
+            adc(reg.d);
+            POLL_INT
+            DONE
+
+        MICROCODE(ADC_zpg_2):
+        MICROCODE(ADC_zpg_x_3):
+            
+            READ_FROM_ZERO_PAGE
+            adc(reg.d);
+            POLL_INT
+            DONE
+
+        MICROCODE(ADC_abs_x_3):
+        MICROCODE(ADC_abs_y_3):
+        MICROCODE(ADC_ind_y_4):
+            
+            READ_FROM_ADDRESS
+            if (PAGE_BOUNDARY_CROSSED) {
+                FIX_ADDR_HI
+                CONTINUE
+            } else {
+                adc(reg.d);
+                POLL_INT
+                DONE
+            }
+            
+        MICROCODE(ADC_abs_3):
+        MICROCODE(ADC_abs_x_4):
+        MICROCODE(ADC_abs_y_4):
+        MICROCODE(ADC_ind_x_5):
+        MICROCODE(ADC_ind_y_5):
+            
+            READ_FROM_ADDRESS
+            adc(reg.d);
+            POLL_INT
+            DONE
+            
+            
+            // Instruction: AND
+            //
+            // Operation:   A := A AND M
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+
+        MICROCODE(AND_imm):
+            
+            READ_IMMEDIATE
+            loadA(reg.a & reg.d);
+            POLL_INT
+            DONE
+
+        MICROCODE(AND_zpg_2):
+        MICROCODE(AND_zpg_x_3):
+            
+            READ_FROM_ZERO_PAGE
+            loadA(reg.a & reg.d);
+            POLL_INT
+            DONE
+            
+        MICROCODE(AND_abs_x_3):
+        MICROCODE(AND_abs_y_3):
+        MICROCODE(AND_ind_y_4):
+            
+            READ_FROM_ADDRESS
+            if (PAGE_BOUNDARY_CROSSED) {
+                FIX_ADDR_HI
+                CONTINUE
+            } else {
+                loadA(reg.a & reg.d);
+                POLL_INT
+                DONE
+            }
+            
+        MICROCODE(AND_abs_3):
+        MICROCODE(AND_abs_x_4):
+        MICROCODE(AND_abs_y_4):
+        MICROCODE(AND_ind_x_5):
+        MICROCODE(AND_ind_y_5):
+            
+            READ_FROM_ADDRESS
+            loadA(reg.a & reg.d);
+            POLL_INT
+            DONE
+            
+            
+            // Instruction: ASL
+            //
+            // Operation:   C <- (A|M << 1) <- 0
+            //
+            // Flags:       N Z C I D V
+            //              / / / - - -
+
+#define DO_ASL_ACC setC(reg.a & 0x80); loadA((u8)(reg.a << 1));
+#define DO_ASL setC(reg.d & 0x80); reg.d = (u8)(reg.d << 1);
+
+        MICROCODE(ASL_acc):
+            
+            IDLE_READ_IMPLIED
+            DO_ASL_ACC
+            POLL_INT
+            DONE
+            
+        MICROCODE(ASL_zpg_3):
+        MICROCODE(ASL_zpg_x_4):
+            
+            WRITE_TO_ZERO_PAGE
+            DO_ASL
+            CONTINUE
+
+        MICROCODE(ASL_abs_4):
+        MICROCODE(ASL_abs_x_5):
+        MICROCODE(ASL_ind_x_6):
+            
+            WRITE_TO_ADDRESS
+            DO_ASL
+            CONTINUE
+            
+        MICROCODE(ASL_zpg_4):
+        MICROCODE(ASL_zpg_x_5):
+            
+            WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
+            POLL_INT
+            DONE
+            
+        MICROCODE(ASL_abs_5):
+        MICROCODE(ASL_abs_x_6):
+        MICROCODE(ASL_ind_x_7):
+            
+            WRITE_TO_ADDRESS_AND_SET_FLAGS
+            POLL_INT
+            DONE
+            
+            
+            // Instruction: BCC
+            //
+            // Operation:   Branch on C = 0
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+
+        MICROCODE(BCC_rel):
+            
+            READ_IMMEDIATE
+            POLL_INT
+            
+            if (!getC()) {
+                CONTINUE
+            } else {
+                DONE
+            }
+            
+            
+            // Instruction: BCS
+            //
+            // Operation:   Branch on C = 1
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+
+        MICROCODE(BCS_rel):
+            
+            READ_IMMEDIATE
+            POLL_INT
+            
+            if (getC()) {
+                CONTINUE
+            } else {
+                DONE
+            }
+            
+
+            // Instruction: BEQ
+            //
+            // Operation:   Branch on Z = 1
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+            
+        MICROCODE(BEQ_rel):
+            
+            READ_IMMEDIATE
+            POLL_INT
+            
+            if (getZ()) {
+                CONTINUE
+            } else {
+                DONE
+            }
+            
+            
+            // Instruction: BIT
+            //
+            // Operation:   A AND M, N := M7, V := M6
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - /
+            
+        MICROCODE(BIT_zpg_2):
+            
+            READ_FROM_ZERO_PAGE
+            setN(reg.d & 128);
+            setV(reg.d & 64);
+            setZ((reg.d & reg.a) == 0);
+            POLL_INT
+            DONE
+
+        MICROCODE(BIT_abs_3):
+            
+            READ_FROM_ADDRESS
+            setN(reg.d & 128);
+            setV(reg.d & 64);
+            setZ((reg.d & reg.a) == 0);
+            POLL_INT
+            DONE
+
+            
+            // Instruction: BMI
+            //
+            // Operation:   Branch on N = 1
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+
+        MICROCODE(BMI_rel):
+            
+            READ_IMMEDIATE
+            POLL_INT
+            
+            if (getN()) {
+                CONTINUE
+            } else {
+                DONE
+            }
+
+            
+            // Instruction: BNE
+            //
+            // Operation:   Branch on Z = 0
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+            
+        MICROCODE(BNE_rel):
+            
+            READ_IMMEDIATE
+            POLL_INT
+            
+            if (!getZ()) {
+                CONTINUE
+            } else {
+                DONE
+            }
+
+
+            // Instruction: BPL
+            //
+            // Operation:   Branch on N = 0
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+
+        MICROCODE(BPL_rel):
+            
+            READ_IMMEDIATE
+            POLL_INT
+            
+            if (!getN()) {
+                CONTINUE
+            } else {
+                DONE
+            }
+
+
+            // Instruction: BRK
+            //
+            // Operation:   Forced Interrupt (Break)
+            //
+            // Flags:       N Z C I D V    B
+            //              - - - 1 - -    1
+            
+        MICROCODE(BRK_2):
+            
+            setB(1);
+            PUSH_PCH
+            CONTINUE
+            
+        MICROCODE(BRK_3):
+
+            PUSH_PCL
+            
+            // Check for interrupt hijacking
+            // If there is a positive edge on the NMI line, ...
+            if (edgeDetector.current()) {
+
+                // ... jump to the NMI vector instead of the IRQ vector.
+                edgeDetector.clear();
+                next = BRK_nmi_4;
+                return;
+                
+            } else {
+                CONTINUE
+            }
+            
+        MICROCODE(BRK_4):
+            
+            PUSH_P
+            CONTINUE
+            
+        MICROCODE(BRK_5):
+            
+            READ_FROM(0xFFFE);
+            SET_PCL(reg.d);
+            setI(1);
+            CONTINUE
+            
+        MICROCODE(BRK_6):
+            
+            READ_FROM(0xFFFF);
+            SET_PCH(reg.d);
+            POLL_INT
+            doNmi = false; // Only the level detector is polled here. This is
+            // the reason why only IRQs can be triggered right
+            // after a BRK command, but not NMIs.
+            DONE
+            
+        MICROCODE(BRK_nmi_4):
+            
+            PUSH_P
+            CONTINUE
+            
+        MICROCODE(BRK_nmi_5):
+            
+            READ_FROM(0xFFFA);
+            SET_PCL(reg.d);
+            setI(1);
+            CONTINUE
+            
+        MICROCODE(BRK_nmi_6):
+            
+            READ_FROM(0xFFFB);
+            SET_PCH(reg.d);
+            POLL_INT
+            DONE
+
+            
+            // Instruction: BVC
+            //
+            // Operation:   Branch on V = 0
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+
+        MICROCODE(BVC_rel):
+            
+            READ_IMMEDIATE
+            POLL_INT
+
+            if (!getV()) {
+                CONTINUE
+            } else {
+                DONE
+            }
+
+
+            // Instruction: BVS
+            //
+            // Operation:   Branch on V = 1
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+
+        MICROCODE(BVS_rel):
+            
+            READ_IMMEDIATE
+            POLL_INT
+            
+            if (getV()) {
+                CONTINUE
+            } else {
+                DONE
+            }
+
+
+            // Instruction: CLC
+            //
+            // Operation:   C := 0
+            //
+            // Flags:       N Z C I D V
+            //              - - 0 - - -
+
+        MICROCODE(CLC):
+            
+            IDLE_READ_IMPLIED
+            setC(0);
+            POLL_INT
+            DONE
+
+
+            // Instruction: CLD
+            //
+            // Operation:   D := 0
+            //
+            // Flags:       N Z C I D V
+            //              - - - - 0 -
+
+        MICROCODE(CLD):
+            
+            IDLE_READ_IMPLIED
+            setD(0);
+            POLL_INT
+            DONE
+
+
+            // Instruction: CLI
+            //
+            // Operation:   I := 0
+            //
+            // Flags:       N Z C I D V
+            //              - - - 0 - -
+
+        MICROCODE(CLI):
+            
+            POLL_INT
+            setI(0);
+            IDLE_READ_IMPLIED
+            DONE
+            
+            
+            // Instruction: CLV
+            //
+            // Operation:   V := 0
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - 0
+
+        MICROCODE(CLV):
+            
+            IDLE_READ_IMPLIED
+            setV(0);
+            POLL_INT
+            DONE
+
+
+            // Instruction: CMP
+            //
+            // Operation:   A-M
+            //
+            // Flags:       N Z C I D V
+            //              / / / - - -
+
+        MICROCODE(CMP_imm):
+            
+            READ_IMMEDIATE
+            cmp(reg.a, reg.d);
+            POLL_INT
+            DONE
+
+        MICROCODE(CMP_zpg_2):
+        MICROCODE(CMP_zpg_x_3):
+            
+            READ_FROM_ZERO_PAGE
+            cmp(reg.a, reg.d);
+            POLL_INT
+            DONE
+
+        MICROCODE(CMP_abs_x_3):
+        MICROCODE(CMP_abs_y_3):
+        MICROCODE(CMP_ind_y_4):
+            
+            READ_FROM_ADDRESS
+            if (PAGE_BOUNDARY_CROSSED) {
+                FIX_ADDR_HI
+                CONTINUE
+            } else {
+                cmp(reg.a, reg.d);
+                POLL_INT
+                DONE
+            }
+            
+        MICROCODE(CMP_abs_3):
+        MICROCODE(CMP_abs_x_4):
+        MICROCODE(CMP_abs_y_4):
+        MICROCODE(CMP_ind_x_5):
+        MICROCODE(CMP_ind_y_5):
+            
+            READ_FROM_ADDRESS
+            cmp(reg.a, reg.d);
+            POLL_INT
+            DONE
+
+            
+            // Instruction: CPX
+            //
+            // Operation:   X-M
+            //
+            // Flags:       N Z C I D V
+            //              / / / - - -
+
+        MICROCODE(CPX_imm):
+            
+            READ_IMMEDIATE
+            cmp(reg.x, reg.d);
+            POLL_INT
+            DONE
+            
+        MICROCODE(CPX_zpg_2):
+            
+            READ_FROM_ZERO_PAGE
+            cmp(reg.x, reg.d);
+            POLL_INT
+            DONE
+            
+        MICROCODE(CPX_abs_3):
+            
+            READ_FROM_ADDRESS
+            cmp(reg.x, reg.d);
+            POLL_INT
+            DONE
+
+
+            // Instruction: CPY
+            //
+            // Operation:   Y-M
+            //
+            // Flags:       N Z C I D V
+            //              / / / - - -
+
+        MICROCODE(CPY_imm):
+            
+            READ_IMMEDIATE
+            cmp(reg.y, reg.d);
+            POLL_INT
+            DONE
+
+        MICROCODE(CPY_zpg_2):
+            
+            READ_FROM_ZERO_PAGE
+            cmp(reg.y, reg.d);
+            POLL_INT
+            DONE
+
+        MICROCODE(CPY_abs_3):
+            
+            READ_FROM_ADDRESS
+            cmp(reg.y, reg.d);
+            POLL_INT
+            DONE
+
+
+            // Instruction: DEC
+            //
+            // Operation:   M := : M - 1
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+            
+#define DO_DEC reg.d--;
+            
+        MICROCODE(DEC_zpg_3):
+        MICROCODE(DEC_zpg_x_4):
+            
+            WRITE_TO_ZERO_PAGE
+            DO_DEC
+            CONTINUE
+            
+        MICROCODE(DEC_zpg_4):
+        MICROCODE(DEC_zpg_x_5):
+            
+            WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
+            POLL_INT
+            DONE
+            
+        MICROCODE(DEC_abs_4):
+        MICROCODE(DEC_abs_x_5):
+        MICROCODE(DEC_ind_x_6):
+            
+            WRITE_TO_ADDRESS
+            DO_DEC
+            CONTINUE
+            
+        MICROCODE(DEC_abs_5):
+        MICROCODE(DEC_abs_x_6):
+        MICROCODE(DEC_ind_x_7):
+            
+            WRITE_TO_ADDRESS_AND_SET_FLAGS
+            POLL_INT
+            DONE
+
+
+            // Instruction: DEX
+            //
+            // Operation:   X := X - 1
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+
+        MICROCODE(DEX):
+            
+            IDLE_READ_IMPLIED
+            loadX(reg.x - 1);
+            POLL_INT
+            DONE
+            
+            
+            // Instruction: DEY
+            //
+            // Operation:   Y := Y - 1
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+
+        MICROCODE(DEY):
+            
+            IDLE_READ_IMPLIED
+            loadY(reg.y - 1);
+            POLL_INT
+            DONE
+
+
+            // Instruction: EOR
+            //
+            // Operation:   A := A XOR M
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+
+#define DO_EOR loadA(reg.a ^ reg.d);
+            
+        MICROCODE(EOR_imm):
+            
+            READ_IMMEDIATE
+            DO_EOR
+            POLL_INT
+            DONE
+            
+        MICROCODE(EOR_zpg_2):
+        MICROCODE(EOR_zpg_x_3):
+            
+            READ_FROM_ZERO_PAGE
+            DO_EOR
+            POLL_INT
+            DONE
+            
+        MICROCODE(EOR_abs_x_3):
+        MICROCODE(EOR_abs_y_3):
+        MICROCODE(EOR_ind_y_4):
+            
+            READ_FROM_ADDRESS
+            if (PAGE_BOUNDARY_CROSSED) {
+                FIX_ADDR_HI
+                CONTINUE
+            } else {
+                DO_EOR
+                POLL_INT
+                DONE
+            }
+
+        MICROCODE(EOR_abs_3):
+        MICROCODE(EOR_abs_x_4):
+        MICROCODE(EOR_abs_y_4):
+        MICROCODE(EOR_ind_x_5):
+        MICROCODE(EOR_ind_y_5):
+            
+            READ_FROM_ADDRESS
+            DO_EOR
+            POLL_INT
+            DONE
+
+
+            // Instruction: INC
+            //
+            // Operation:   M := M + 1
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+            
+#define DO_INC reg.d++;
+            
+        MICROCODE(INC_zpg_3):
+        MICROCODE(INC_zpg_x_4):
+            
+            WRITE_TO_ZERO_PAGE
+            DO_INC
+            CONTINUE
+            
+        MICROCODE(INC_zpg_4):
+        MICROCODE(INC_zpg_x_5):
+            
+            WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
+            POLL_INT
+            DONE
+
+        MICROCODE(INC_abs_4):
+        MICROCODE(INC_abs_x_5):
+        MICROCODE(INC_ind_x_6):
+            
+            WRITE_TO_ADDRESS
+            DO_INC
+            CONTINUE
+            
+        MICROCODE(INC_abs_5):
+        MICROCODE(INC_abs_x_6):
+        MICROCODE(INC_ind_x_7):
+            
+            WRITE_TO_ADDRESS_AND_SET_FLAGS
+            POLL_INT
+            DONE
+            
+
+            // Instruction: INX
+            //
+            // Operation:   X := X + 1
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+
+        MICROCODE(INX):
+            
+            IDLE_READ_IMPLIED
+            loadX(reg.x + 1);
+            POLL_INT
+            DONE
+
+
+            // Instruction: INY
+            //
+            // Operation:   Y := Y + 1
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+
+        MICROCODE(INY):
+            
+            IDLE_READ_IMPLIED
+            loadY(reg.y + 1);
+            POLL_INT
+            DONE
+
+
+            // Instruction: JMP
+            //
+            // Operation:   PC := Operand
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+
+        MICROCODE(JMP_abs):
+            
+            FETCH_ADDR_LO
+            CONTINUE
+            
+        MICROCODE(JMP_abs_2):
+            
+            FETCH_ADDR_HI
+            reg.pc = LO_HI(reg.adl, reg.adh);
+            POLL_INT
+            DONE
+
+        MICROCODE(JMP_abs_ind):
+            
+            FETCH_ADDR_LO
+            CONTINUE
+            
+        MICROCODE(JMP_abs_ind_2):
+            
+            FETCH_ADDR_HI
+            CONTINUE
+            
+        MICROCODE(JMP_abs_ind_3):
+            
+            READ_FROM_ADDRESS
+            SET_PCL(reg.d);
+            reg.adl++;
+            CONTINUE
+            
+        MICROCODE(JMP_abs_ind_4):
+            
+            READ_FROM_ADDRESS
+            SET_PCH(reg.d);
+            POLL_INT
+            DONE
+
+            
+            // Instruction: JSR
+            //
+            // Operation:   PC to stack, PC := Operand
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+            
+        MICROCODE(JSR):
+            
+            FETCH_ADDR_LO
+            CONTINUE
+            
+        MICROCODE(JSR_2):
+            
+            IDLE_PULL
+            CONTINUE
+            
+        MICROCODE(JSR_3):
+            
+            PUSH_PCH
+            CONTINUE
+            
+        MICROCODE(JSR_4):
+            
+            PUSH_PCL
+            CONTINUE
+            
+        MICROCODE(JSR_5):
+            
+            FETCH_ADDR_HI
+            reg.pc = LO_HI(reg.adl, reg.adh);
+            POLL_INT
+            DONE
+
+            
+            // Instruction: LDA
+            //
+            // Operation:   A := M
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+
+        MICROCODE(LDA_imm):
+            
+            READ_IMMEDIATE
+            loadA(reg.d);
+            POLL_INT
+            DONE
+
+        MICROCODE(LDA_zpg_2):
+        MICROCODE(LDA_zpg_x_3):
+            
+            READ_FROM_ZERO_PAGE
+            loadA(reg.d);
+            POLL_INT
+            DONE
+
+        MICROCODE(LDA_abs_x_3):
+        MICROCODE(LDA_abs_y_3):
+        MICROCODE(LDA_ind_y_4):
+            
+            READ_FROM_ADDRESS
+            if (PAGE_BOUNDARY_CROSSED) {
+                FIX_ADDR_HI
+                CONTINUE
+            } else {
+                loadA(reg.d);
+                POLL_INT
+                DONE
+            }
+            
+        MICROCODE(LDA_abs_3):
+        MICROCODE(LDA_abs_x_4):
+        MICROCODE(LDA_abs_y_4):
+        MICROCODE(LDA_ind_x_5):
+        MICROCODE(LDA_ind_y_5):
+            
+            READ_FROM_ADDRESS
+            loadA(reg.d);
+            POLL_INT
+            DONE
+
+            
+            // Instruction: LDX
+            //
+            // Operation:   X := M
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+
+        MICROCODE(LDX_imm):
+            
+            READ_IMMEDIATE
+            loadX(reg.d);
+            POLL_INT
+            DONE
+
+        MICROCODE(LDX_zpg_2):
+        MICROCODE(LDX_zpg_y_3):
+            
+            READ_FROM_ZERO_PAGE
+            loadX(reg.d);
+            POLL_INT
+            DONE
+
+        MICROCODE(LDX_abs_y_3):
+        MICROCODE(LDX_ind_y_4):
+            
+            READ_FROM_ADDRESS
+            if (PAGE_BOUNDARY_CROSSED) {
+                FIX_ADDR_HI
+                CONTINUE
+            } else {
+                loadX(reg.d);
+                POLL_INT
+                DONE
+            }
+            
+        MICROCODE(LDX_abs_3):
+        MICROCODE(LDX_abs_y_4):
+        MICROCODE(LDX_ind_x_5):
+        MICROCODE(LDX_ind_y_5):
+            
+            READ_FROM_ADDRESS
+            loadX(reg.d);
+            POLL_INT
+            DONE
+            
+            
+            // Instruction: LDY
+            //
+            // Operation:   Y := M
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+
+        MICROCODE(LDY_imm):
+            
+            READ_IMMEDIATE
+            loadY(reg.d);
+            POLL_INT
+            DONE
+            
+        MICROCODE(LDY_zpg_2):
+        MICROCODE(LDY_zpg_x_3):
+            
+            READ_FROM_ZERO_PAGE
+            loadY(reg.d);
+            POLL_INT
+            DONE
+
+        MICROCODE(LDY_abs_x_3):
+        MICROCODE(LDY_ind_y_4):
+            
+            READ_FROM_ADDRESS
+            if (PAGE_BOUNDARY_CROSSED) {
+                FIX_ADDR_HI
+                CONTINUE
+            } else {
+                loadY(reg.d);
+                POLL_INT
+                DONE
+            }
+
+        MICROCODE(LDY_abs_3):
+        MICROCODE(LDY_abs_x_4):
+        MICROCODE(LDY_ind_x_5):
+        MICROCODE(LDY_ind_y_5):
+            
+            READ_FROM_ADDRESS
+            loadY(reg.d);
+            POLL_INT
+            DONE
+            
+
+            // Instruction: LSR
+            //
+            // Operation:   0 -> (A|M >> 1) -> C
+            //
+            // Flags:       N Z C I D V
+            //              0 / / - - -
+
+        MICROCODE(LSR_acc):
+            
+            IDLE_READ_IMPLIED
+            setC(reg.a & 1); loadA(reg.a >> 1);
+            POLL_INT
+            DONE
+
+        MICROCODE(LSR_zpg_3):
+        MICROCODE(LSR_zpg_x_4):
+            
+            WRITE_TO_ZERO_PAGE
+            setC(reg.d & 1); reg.d = reg.d >> 1;
+            CONTINUE
+            
+        MICROCODE(LSR_zpg_4):
+        MICROCODE(LSR_zpg_x_5):
+            
+            WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
+            POLL_INT
+            DONE
+            
+        MICROCODE(LSR_abs_4):
+        MICROCODE(LSR_abs_x_5):
+        MICROCODE(LSR_abs_y_5):
+        MICROCODE(LSR_ind_x_6):
+        MICROCODE(LSR_ind_y_6):
+            
+            WRITE_TO_ADDRESS
+            setC(reg.d & 1); reg.d = reg.d >> 1;
+            CONTINUE
+            
+        MICROCODE(LSR_abs_5):
+        MICROCODE(LSR_abs_x_6):
+        MICROCODE(LSR_abs_y_6):
+        MICROCODE(LSR_ind_x_7):
+        MICROCODE(LSR_ind_y_7):
+            
+            WRITE_TO_ADDRESS_AND_SET_FLAGS
+            POLL_INT
+            DONE
+            
+
+            // Instruction: NOP
+            //
+            // Operation:   No operation
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+
+        MICROCODE(NOP):
+            
+            IDLE_READ_IMPLIED
+            POLL_INT
+            DONE
+
+        MICROCODE(NOP_imm):
+            
+            IDLE_READ_IMMEDIATE
+            POLL_INT
+            DONE
+
+        MICROCODE(NOP_zpg_2):
+        MICROCODE(NOP_zpg_x_3):
+            
+            IDLE_READ_FROM_ZERO_PAGE
+            POLL_INT
+            DONE
+            
+        MICROCODE(NOP_abs_x_3):
+            
+            IDLE_READ_FROM_ADDRESS
+            if (PAGE_BOUNDARY_CROSSED) {
+                FIX_ADDR_HI
+                CONTINUE
+            } else {
+                POLL_INT
+                DONE
+            }
+            
+        MICROCODE(NOP_abs_3):
+        MICROCODE(NOP_abs_x_4):
+            
+            IDLE_READ_FROM_ADDRESS
+            POLL_INT
+            DONE
+            
+
+            // Instruction: ORA
+            //
+            // Operation:   A := A v M
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+
+        MICROCODE(ORA_imm):
+            
+            READ_IMMEDIATE
+            loadA(reg.a | reg.d);
+            POLL_INT
+            DONE
+            
+        MICROCODE(ORA_zpg_2):
+        MICROCODE(ORA_zpg_x_3):
+            
+            READ_FROM_ZERO_PAGE
+            loadA(reg.a | reg.d);
+            POLL_INT
+            DONE
+
+        MICROCODE(ORA_abs_x_3):
+        MICROCODE(ORA_abs_y_3):
+        MICROCODE(ORA_ind_y_4):
+            
+            READ_FROM_ADDRESS
+            if (PAGE_BOUNDARY_CROSSED) {
+                FIX_ADDR_HI
+                CONTINUE
+            } else {
+                loadA(reg.a | reg.d);
+                POLL_INT
+                DONE
+            }
+            
+        MICROCODE(ORA_abs_3):
+        MICROCODE(ORA_abs_x_4):
+        MICROCODE(ORA_abs_y_4):
+        MICROCODE(ORA_ind_x_5):
+        MICROCODE(ORA_ind_y_5):
+            
+            READ_FROM_ADDRESS
+            loadA(reg.a | reg.d);
+            POLL_INT
+            DONE
+            
+            
+            // Instruction: PHA
+            //
+            // Operation:   A to stack
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+            
+        MICROCODE(PHA_2):
+            
+            PUSH_A
+            POLL_INT
+            DONE
+
+            
+            // Instruction: PHA
+            //
+            // Operation:   P to stack
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+            
+        MICROCODE(PHP_2):
+            
+            PUSH_P
+            POLL_INT
+            DONE
+
+            
+            // Instruction: PLA
+            //
+            // Operation:   Stack to A
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+            
+        MICROCODE(PLA_2):
+            
+            reg.sp++;
+            CONTINUE
+            
+        MICROCODE(PLA_3):
+            
+            PULL_A
+            POLL_INT
+            DONE
+
+            
+            // Instruction: PLP
+            //
+            // Operation:   Stack to p
+            //
+            // Flags:       N Z C I D V
+            //              / / / / / /
+            
+        MICROCODE(PLP_2):
+
+            IDLE_PULL
+            reg.sp++;
+            CONTINUE
+            
+        MICROCODE(PLP_3):
+
+            POLL_INT // Interrupts are polled before P is pulled
+            PULL_P
+            DONE
+
+            
+            // Instruction: ROL
+            //
+            //              -----------------------
+            //              |                     |
+            // Operation:   ---(A|M << 1) <- C <---
+            //
+            // Flags:       N Z C I D V
+            //              / / / - - -
+
+#define DO_ROL_ACC { u8 c = !!getC(); setC(reg.a & 0x80); loadA((u8)(reg.a << 1 | c)); }
+#define DO_ROL { u8 c = !!getC(); setC(reg.d & 0x80); reg.d = (u8)(reg.d << 1 | c); }
+
+        MICROCODE(ROL_acc):
+            
+            IDLE_READ_IMPLIED
+            DO_ROL_ACC
+            POLL_INT
+            DONE
+            
+        MICROCODE(ROL_zpg_3):
+        MICROCODE(ROL_zpg_x_4):
+            
+            WRITE_TO_ZERO_PAGE
+            DO_ROL
+            CONTINUE
+            
+        MICROCODE(ROL_zpg_4):
+        MICROCODE(ROL_zpg_x_5):
+            
+            WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
+            POLL_INT
+            DONE
+            
+        MICROCODE(ROL_abs_4):
+        MICROCODE(ROL_abs_x_5):
+        MICROCODE(ROL_ind_x_6):
+            
+            WRITE_TO_ADDRESS
+            DO_ROL
+            CONTINUE
+            
+        MICROCODE(ROL_abs_5):
+        MICROCODE(ROL_abs_x_6):
+        MICROCODE(ROL_ind_x_7):
+            
+            WRITE_TO_ADDRESS_AND_SET_FLAGS
+            POLL_INT
+            DONE
+
+
+            // Instruction: ROR
+            //
+            //              -----------------------
+            //              |                     |
+            // Operation:   --->(A|M >> 1) -> C ---
+            //
+            // Flags:       N Z C I D V
+            //              / / / - - -
+
+#define DO_ROR_ACC { u8 c = !!getC(); setC(reg.a & 0x1); loadA((u8)(reg.a >> 1 | c << 7)); }
+#define DO_ROR { u8 c = !!getC(); setC(reg.d & 0x1); reg.d = (u8)(reg.d >> 1 | c << 7); }
+            
+        MICROCODE(ROR_acc):
+            
+            IDLE_READ_IMPLIED
+            DO_ROR_ACC
+            POLL_INT
+            DONE
+            
+        MICROCODE(ROR_zpg_3):
+        MICROCODE(ROR_zpg_x_4):
+            
+            WRITE_TO_ZERO_PAGE
+            DO_ROR
+            CONTINUE
+            
+        MICROCODE(ROR_zpg_4):
+        MICROCODE(ROR_zpg_x_5):
+            
+            WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
+            POLL_INT
+            DONE
+            
+        MICROCODE(ROR_abs_4):
+        MICROCODE(ROR_abs_x_5):
+        MICROCODE(ROR_ind_x_6):
+            
+            WRITE_TO_ADDRESS
+            DO_ROR
+            CONTINUE
+            
+        MICROCODE(ROR_abs_5):
+        MICROCODE(ROR_abs_x_6):
+        MICROCODE(ROR_ind_x_7):
+            
+            WRITE_TO_ADDRESS_AND_SET_FLAGS
+            POLL_INT
+            DONE
+
+            
+            // Instruction: RTI
+            //
+            // Operation:   P from Stack, PC from Stack
+            //
+            // Flags:       N Z C I D V
+            //              / / / / / /
+            
+        MICROCODE(RTI_2):
+            
+            IDLE_PULL
+            reg.sp++;
+            CONTINUE
+            
+        MICROCODE(RTI_3):
+            
+            PULL_P
+            reg.sp++;
+            CONTINUE
+            
+        MICROCODE(RTI_4):
+            
+            PULL_PCL
+            reg.sp++;
+            CONTINUE
+            
+        MICROCODE(RTI_5):
+            
+            PULL_PCH
+            POLL_INT
+            DONE
+
+
+            // Instruction: RTS
+            //
+            // Operation:   PC from Stack
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+            
+        MICROCODE(RTS_2):
+            
+            IDLE_PULL
+            reg.sp++;
+            CONTINUE
+            
+        MICROCODE(RTS_3):
+            
+            PULL_PCL
+            reg.sp++;
+            CONTINUE
+            
+        MICROCODE(RTS_4):
+            
+            PULL_PCH
+            CONTINUE
+            
+        MICROCODE(RTS_5):
+            
+            IDLE_READ_IMMEDIATE
+            POLL_INT
+            DONE
+
+            
+            // Instruction: SBC
+            //
+            // Operation:   A := A - M - (~C)
+            //
+            // Flags:       N Z C I D V
+            //              / / / - - /
+
+        MICROCODE(SBC_imm):
+            
+            READ_IMMEDIATE
+            sbc(reg.d);
+            POLL_INT
+            DONE
+            
+        MICROCODE(SBC_zpg_2):
+        MICROCODE(SBC_zpg_x_3):
+            
+            READ_FROM_ZERO_PAGE
+            sbc(reg.d);
+            POLL_INT
+            DONE
+            
+        MICROCODE(SBC_abs_x_3):
+        MICROCODE(SBC_abs_y_3):
+        MICROCODE(SBC_ind_y_4):
+            
+            READ_FROM_ADDRESS
+            if (PAGE_BOUNDARY_CROSSED) {
+                FIX_ADDR_HI
+                CONTINUE
+            } else {
+                sbc(reg.d);
+                POLL_INT
+                DONE
+            }
+            
+        MICROCODE(SBC_abs_3):
+        MICROCODE(SBC_abs_x_4):
+        MICROCODE(SBC_abs_y_4):
+        MICROCODE(SBC_ind_x_5):
+        MICROCODE(SBC_ind_y_5):
+            
+            READ_FROM_ADDRESS
+            sbc(reg.d);
+            POLL_INT
+            DONE
+
+
+            // Instruction: SEC
+            //
+            // Operation:   C := 1
+            //
+            // Flags:       N Z C I D V
+            //              - - 1 - - -
+
+        MICROCODE(SEC):
+            
+            IDLE_READ_IMPLIED
+            setC(1);
+            POLL_INT
+            DONE
+
+            
+            // Instruction: SED
+            //
+            // Operation:   D := 1
+            //
+            // Flags:       N Z C I D V
+            //              - - - - 1 -
+
+        MICROCODE(SED):
+            
+            IDLE_READ_IMPLIED
+            setD(1);
+            POLL_INT
+            DONE
+
+            
+            // Instruction: SEI
+            //
+            // Operation:   I := 1
+            //
+            // Flags:       N Z C I D V
+            //              - - - 1 - -
+
+        MICROCODE(SEI):
+            
+            POLL_IRQ
+            setI(1);
+            FALLTHROUGH
+            
+        MICROCODE(SEI_cont):
+            
+            next = SEI_cont;
+            IDLE_READ_IMPLIED
+            POLL_NMI
+            DONE
+            
+
+            // Instruction: STA
+            //
+            // Operation:   M := A
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+            
+        MICROCODE(STA_zpg_2):
+        MICROCODE(STA_zpg_x_3):
+            
+            reg.d = reg.a;
+            WRITE_TO_ZERO_PAGE
+            POLL_INT
+            DONE
+            
+        MICROCODE(STA_abs_3):
+        MICROCODE(STA_abs_x_4):
+            
+            reg.d = reg.a;
+            WRITE_TO_ADDRESS
+            POLL_INT
+            DONE
+            
+        MICROCODE(STA_abs_y_4):
+        MICROCODE(STA_ind_x_5):
+        MICROCODE(STA_ind_y_5):
+            
+            reg.d = reg.a;
+            WRITE_TO_ADDRESS
+            POLL_INT
+            DONE
+
+
+            // Instruction: STX
+            //
+            // Operation:   M := X
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+            
+        MICROCODE(STX_zpg_2):
+        MICROCODE(STX_zpg_y_3):
+            
+            reg.d = reg.x;
+            WRITE_TO_ZERO_PAGE
+            POLL_INT
+            DONE
+            
+        MICROCODE(STX_abs_3):
+            
+            reg.d = reg.x;
+            WRITE_TO_ADDRESS
+            POLL_INT
+            DONE
+
+            
+            // Instruction: STY
+            //
+            // Operation:   M := Y
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+            
+        MICROCODE(STY_zpg_2):
+        MICROCODE(STY_zpg_x_3):
+            
+            reg.d = reg.y;
+            WRITE_TO_ZERO_PAGE
+            POLL_INT
+            DONE
+            
+        MICROCODE(STY_abs_3):
+            
+            reg.d = reg.y;
+            WRITE_TO_ADDRESS
+            POLL_INT
+            DONE
+
+
+            // Instruction: TAX
+            //
+            // Operation:   X := A
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+
+        MICROCODE(TAX):
+            
+            IDLE_READ_IMPLIED
+            loadX(reg.a);
+            POLL_INT
+            DONE
+
+            
+            // Instruction: TAY
+            //
+            // Operation:   Y := A
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+
+        MICROCODE(TAY):
+            
+            IDLE_READ_IMPLIED
+            loadY(reg.a);
+            POLL_INT
+            DONE
+
+
+            // Instruction: TSX
+            //
+            // Operation:   X := Stack pointer
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+
+        MICROCODE(TSX):
+            
+            IDLE_READ_IMPLIED
+            loadX(reg.sp);
+            POLL_INT
+            DONE
+
+
+            // Instruction: TXA
+            //
+            // Operation:   A := X
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+
+        MICROCODE(TXA):
+            
+            IDLE_READ_IMPLIED
+            loadA(reg.x);
+            POLL_INT
+            DONE
+
+
+            // Instruction: TXS
+            //
+            // Operation:   Stack pointer := X
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+
+        MICROCODE(TXS):
+            
+            IDLE_READ_IMPLIED
+            reg.sp = reg.x;
+            POLL_INT
+            DONE
+
+
+            // Instruction: TYA
+            //
+            // Operation:   A := Y
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+
+        MICROCODE(TYA):
+            
+            IDLE_READ_IMPLIED
+            loadA(reg.y);
+            POLL_INT
+            DONE
+
+            
+            //
+            // Illegal instructions
+            //
+
+            
+            // Instruction: ALR
+            //
+            // Operation:   AND, followed by LSR
+            //
+            // Flags:       N Z C I D V
+            //              / / / - - -
+
+        MICROCODE(ALR_imm):
+            
+            READ_IMMEDIATE
+            reg.a = reg.a & reg.d;
+            setC(reg.a & 1);
+            loadA(reg.a >> 1);
+            POLL_INT
+            DONE
+
+
+            // Instruction: ANC
+            //
+            // Operation:   A := A & op,   N flag is copied to C
+            //
+            // Flags:       N Z C I D V
+            //              / / / - - -
+
+        MICROCODE(ANC_imm):
+            
+            READ_IMMEDIATE
+            loadA(reg.a & reg.d);
+            setC(getN());
+            POLL_INT
+            DONE
+
+
+            // Instruction: ARR
+            //
+            // Operation:   AND, followed by ROR
+            //
+            // Flags:       N Z C I D V
+            //              / / / - - /
+
+        MICROCODE(ARR_imm):
+        {
+            READ_IMMEDIATE
+            
+            u8 tmp2 = reg.a & reg.d;
+            
+            // Taken from Frodo...
+            reg.a = (getC() ? (tmp2 >> 1) | 0x80 : tmp2 >> 1);
+            if (!getD()) {
+                setN(reg.a & 0x80);
+                setZ(reg.a == 0);
+                setC(reg.a & 0x40);
+                setV((reg.a & 0x40) ^ ((reg.a & 0x20) << 1));
+            } else {
+                int c_flag;
+                
+                setN(getC());
+                setZ(reg.a == 0);
+                setV((tmp2 ^ reg.a) & 0x40);
+                if ((tmp2 & 0x0f) + (tmp2 & 0x01) > 5)
+                    reg.a = (reg.a & 0xf0) | ((reg.a + 6) & 0x0f);
+                c_flag = (tmp2 + (tmp2 & 0x10)) & 0x1f0;
+                if (c_flag > 0x50) {
+                    setC(1);
+                    reg.a += 0x60;
+                } else {
+                    setC(0);
+                }
+            }
+            POLL_INT
+            DONE
+        }
+
+
+            // Instruction: AXS
+            //
+            // Operation:   X = (A & X) - op
+            //
+            // Flags:       N Z C I D V
+            //              / / / - - -
+
+        MICROCODE(AXS_imm):
+        {
+            READ_IMMEDIATE
+            
+            u8 op2  = reg.a & reg.x;
+            u8 tmp = op2 - reg.d;
+            
+            setC(op2 >= reg.d);
+            loadX(tmp);
+            POLL_INT
+            DONE
+        }
+
+
+            // Instruction: DCP
+            //
+            // Operation:   DEC followed by CMP
+            //
+            // Flags:       N Z C I D V
+            //              / / / - - -
+            
+        MICROCODE(DCP_zpg_3):
+        MICROCODE(DCP_zpg_x_4):
+            
+            WRITE_TO_ZERO_PAGE
+            reg.d--;
+            CONTINUE
+            
+        MICROCODE(DCP_zpg_4):
+        MICROCODE(DCP_zpg_x_5):
+            
+            WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
+            cmp(reg.a, reg.d);
+            POLL_INT
+            DONE
+            
+        MICROCODE(DCP_abs_4):
+        MICROCODE(DCP_abs_x_5):
+        MICROCODE(DCP_abs_y_5):
+        MICROCODE(DCP_ind_x_6):
+        MICROCODE(DCP_ind_y_6):
+            
+            WRITE_TO_ADDRESS
+            reg.d--;
+            CONTINUE
+            
+        MICROCODE(DCP_abs_5):
+        MICROCODE(DCP_abs_x_6):
+        MICROCODE(DCP_abs_y_6):
+        MICROCODE(DCP_ind_x_7):
+        MICROCODE(DCP_ind_y_7):
+            
+            WRITE_TO_ADDRESS_AND_SET_FLAGS
+            cmp(reg.a, reg.d);
+            POLL_INT
+            DONE
+
+
+            // Instruction: ISC
+            //
+            // Operation:   INC followed by SBC
+            //
+            // Flags:       N Z C I D V
+            //              / / / - - /
+            
+        MICROCODE(ISC_zpg_3):
+        MICROCODE(ISC_zpg_x_4):
+            
+            WRITE_TO_ZERO_PAGE
+            reg.d++;
+            CONTINUE
+            
+        MICROCODE(ISC_zpg_4):
+        MICROCODE(ISC_zpg_x_5):
+            
+            WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
+            sbc(reg.d);
+            POLL_INT
+            DONE
+
+        MICROCODE(ISC_abs_4):
+        MICROCODE(ISC_abs_x_5):
+        MICROCODE(ISC_abs_y_5):
+        MICROCODE(ISC_ind_x_6):
+        MICROCODE(ISC_ind_y_6):
+            
+            WRITE_TO_ADDRESS
+            reg.d++;
+            CONTINUE
+            
+        MICROCODE(ISC_abs_5):
+        MICROCODE(ISC_abs_x_6):
+        MICROCODE(ISC_abs_y_6):
+        MICROCODE(ISC_ind_x_7):
+        MICROCODE(ISC_ind_y_7):
+            
+            WRITE_TO_ADDRESS_AND_SET_FLAGS
+            sbc(reg.d);
+            POLL_INT
+            DONE
+
+
+            // Instruction: LAS
+            //
+            // Operation:   SP,X,A = op & SP
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+            
+        MICROCODE(LAS_abs_y_3):
+            
+            READ_FROM_ADDRESS
+            if (PAGE_BOUNDARY_CROSSED) {
+                FIX_ADDR_HI
+                CONTINUE
+            } else {
+                reg.d &= reg.sp;
+                reg.sp = reg.d;
+                reg.x = reg.d;
+                loadA(reg.d);
+                POLL_INT
+                DONE
+            }
+            
+        MICROCODE(LAS_abs_y_4):
+            
+            READ_FROM_ADDRESS
+            reg.d &= reg.sp;
+            reg.sp = reg.d;
+            reg.x = reg.d;
+            loadA(reg.d);
+            POLL_INT
+            DONE
+
+            
+            // Instruction: LAX
+            //
+            // Operation:   LDA, followed by LDX
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+            
+        MICROCODE(LAX_zpg_2):
+        MICROCODE(LAX_zpg_y_3):
+            
+            READ_FROM_ZERO_PAGE
+            loadA(reg.d);
+            loadX(reg.d);
+            POLL_INT
+            DONE
+            
+        MICROCODE(LAX_abs_y_3):
+        MICROCODE(LAX_ind_y_4):
+            
+            READ_FROM_ADDRESS
+            if (PAGE_BOUNDARY_CROSSED) {
+                FIX_ADDR_HI
+                CONTINUE
+            } else {
+                loadA(reg.d);
+                loadX(reg.d);
+                POLL_INT
+                DONE
+            }
+            
+        MICROCODE(LAX_abs_3):
+        MICROCODE(LAX_abs_y_4):
+        MICROCODE(LAX_ind_x_5):
+        MICROCODE(LAX_ind_y_5):
+            
+            READ_FROM_ADDRESS;
+            loadA(reg.d);
+            loadX(reg.d);
+            POLL_INT
+            DONE
+
+            
+            // Instruction: RLA
+            //
+            // Operation:   ROL, followed by AND
+            //
+            // Flags:       N Z C I D V
+            //              / / / - - -
+            
+        MICROCODE(RLA_zpg_3):
+        MICROCODE(RLA_zpg_x_4):
+            
+            WRITE_TO_ZERO_PAGE
+            DO_ROL
+            CONTINUE
+            
+        MICROCODE(RLA_zpg_4):
+        MICROCODE(RLA_zpg_x_5):
+            
+            WRITE_TO_ZERO_PAGE
+            loadA(reg.a & reg.d);
+            POLL_INT
+            DONE
+            
+        MICROCODE(RLA_abs_4):
+        MICROCODE(RLA_abs_x_5):
+        MICROCODE(RLA_abs_y_5):
+        MICROCODE(RLA_ind_x_6):
+        MICROCODE(RLA_ind_y_6):
+            
+            WRITE_TO_ADDRESS
+            DO_ROL
+            CONTINUE
+            
+        MICROCODE(RLA_abs_5):
+        MICROCODE(RLA_abs_x_6):
+        MICROCODE(RLA_abs_y_6):
+        MICROCODE(RLA_ind_x_7):
+        MICROCODE(RLA_ind_y_7):
+            
+            WRITE_TO_ADDRESS
+            loadA(reg.a & reg.d);
+            POLL_INT
+            DONE
+
+            // Instruction: RRA
+            //
+            // Operation:   ROR, followed by ADC
+            //
+            // Flags:       N Z C I D V
+            //              / / / - - /
+            
+        MICROCODE(RRA_zpg_3):
+        MICROCODE(RRA_zpg_x_4):
+            
+            WRITE_TO_ZERO_PAGE
+            DO_ROR
+            CONTINUE
+            
+        MICROCODE(RRA_zpg_4):
+        MICROCODE(RRA_zpg_x_5):
+            
+            WRITE_TO_ZERO_PAGE
+            adc(reg.d);
+            POLL_INT
+            DONE
+
+        MICROCODE(RRA_abs_4):
+        MICROCODE(RRA_abs_x_5):
+        MICROCODE(RRA_abs_y_5):
+        MICROCODE(RRA_ind_x_6):
+        MICROCODE(RRA_ind_y_6):
+            
+            WRITE_TO_ADDRESS
+            DO_ROR
+            CONTINUE
+            
+        MICROCODE(RRA_abs_5):
+        MICROCODE(RRA_abs_x_6):
+        MICROCODE(RRA_abs_y_6):
+        MICROCODE(RRA_ind_x_7):
+        MICROCODE(RRA_ind_y_7):
+            
+            WRITE_TO_ADDRESS
+            adc(reg.d);
+            POLL_INT
+            DONE
+
+            
+            // Instruction: SAX
+            //
+            // Operation:   Mem := A & X
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+            
+        MICROCODE(SAX_zpg_2):
+        MICROCODE(SAX_zpg_y_3):
+            
+            reg.d = reg.a & reg.x;
+            WRITE_TO_ZERO_PAGE
+            POLL_INT
+            DONE
+
+        MICROCODE(SAX_abs_3):
+        MICROCODE(SAX_ind_x_5):
+            
+            reg.d = reg.a & reg.x;
+            WRITE_TO_ADDRESS
+            POLL_INT
+            DONE
+
+
+            // Instruction: SHA
+            //
+            // Operation:   Mem := A & X & (M + 1)
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+            
+        MICROCODE(SHA_abs_y_3):
+            
+            IDLE_READ_FROM_ADDRESS
+            
+            /* "There are two unstable conditions, the first is when a DMA is
+             *  going on while the instruction executes (the CPU is halted by
+             *  the VIC-II) then the & M+1 part drops off."
+             */
+            
+            reg.d = reg.a & reg.x & (rdyLineUp == clock ? 0xFF : reg.adh + 1);
+            
+            /* "The other unstable condition is when the addressing/indexing
+             *  causes a page boundary crossing, in that case the highbyte of
+             *  the target address may become equal to the value stored."
+             */
+            
+            if (PAGE_BOUNDARY_CROSSED) {
+                FIX_ADDR_HI;
+                reg.adh = reg.a & reg.x & reg.adh;
+            }
+            
+            CONTINUE
+            
+        MICROCODE(SHA_abs_y_4):
+            
+            WRITE_TO_ADDRESS
+            POLL_INT
+            DONE
+            
+        MICROCODE(SHA_ind_y_4):
+            
+            IDLE_READ_FROM_ADDRESS
+            
+            /* "There are two unstable conditions, the first is when a DMA is
+             *  going on while the instruction executes (the CPU is halted by
+             *  the VIC-II) then the & M+1 part drops off."
+             */
+            
+            reg.d = reg.a & reg.x & (rdyLineUp == clock ? 0xFF : reg.adh + 1);
+            
+            /* "The other unstable condition is when the addressing/indexing
+             *  causes a page boundary crossing, in that case the highbyte of
+             *  the target address may become equal to the value stored."
+             */
+            
+            if (PAGE_BOUNDARY_CROSSED) {
+                FIX_ADDR_HI;
+                reg.adh = reg.a & reg.x & reg.adh;
+            }
+
+            CONTINUE
+            
+        MICROCODE(SHA_ind_y_5):
+            
+            WRITE_TO_ADDRESS
+            POLL_INT
+            DONE
+
+
+            // Instruction: SHX
+            //
+            // Operation:   Mem := X & (HI_BYTE(op) + 1)
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+
+        MICROCODE(SHX_abs_y_3):
+            
+            IDLE_READ_FROM_ADDRESS
+            
+            /* "There are two unstable conditions, the first is when a DMA is
+             *  going on while the instruction executes (the CPU is halted by
+             *  the VIC-II) then the & M+1 part drops off."
+             */
+            
+            reg.d = reg.x & (rdyLineUp == clock ? 0xFF : reg.adh + 1);
+            
+            /* "The other unstable condition is when the addressing/indexing
+             *  causes a page boundary crossing, in that case the highbyte of
+             *  the target address may become equal to the value stored."
+             */
+            
+            if (PAGE_BOUNDARY_CROSSED) {
+                FIX_ADDR_HI;
+                reg.adh = reg.x & reg.adh;
+            }
+            
+            CONTINUE
+
+        MICROCODE(SHX_abs_y_4):
+            
+            WRITE_TO_ADDRESS
+            POLL_INT
+            DONE
+
+
+            // Instruction: SHY
+            //
+            // Operation:   Mem := Y & (HI_BYTE(op) + 1)
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+            
+        MICROCODE(SHY_abs_x_3):
+            
+            IDLE_READ_FROM_ADDRESS
+            
+            /* "There are two unstable conditions, the first is when a DMA is
+             *  going on while the instruction executes (the CPU is halted by
+             *  the VIC-II) then the & M+1 part drops off."
+             */
+            
+            reg.d = reg.y & (rdyLineUp == clock ? 0xFF : reg.adh + 1);
+            
+            /* "The other unstable condition is when the addressing/indexing
+             *  causes a page boundary crossing, in that case the highbyte of
+             *  the target address may become equal to the value stored."
+             */
+            
+            if (PAGE_BOUNDARY_CROSSED) {
+                FIX_ADDR_HI;
+                reg.adh = reg.y & reg.adh;
+            }
+
+            CONTINUE
+            
+        MICROCODE(SHY_abs_x_4):
+            
+            WRITE_TO_ADDRESS
+            POLL_INT
+            DONE
+
+
+            // Instruction: SLO (ASO)
+            //
+            // Operation:   ASL memory location, followed by OR on accumulator
+            //
+            // Flags:       N Z C I D V
+            //              / / / - - -
+
+#define DO_SLO setC(reg.d & 128); reg.d <<= 1;
+
+        MICROCODE(SLO_zpg_3):
+        MICROCODE(SLO_zpg_x_4):
+            
+            WRITE_TO_ZERO_PAGE
+            DO_SLO
+            CONTINUE
+            
+        MICROCODE(SLO_zpg_4):
+        MICROCODE(SLO_zpg_x_5):
+            
+            WRITE_TO_ZERO_PAGE
+            loadA(reg.a | reg.d);
+            POLL_INT
+            DONE
+            
+        MICROCODE(SLO_abs_4):
+        MICROCODE(SLO_abs_x_5):
+        MICROCODE(SLO_abs_y_5):
+        MICROCODE(SLO_ind_x_6):
+        MICROCODE(SLO_ind_y_6):
+            
+            WRITE_TO_ADDRESS
+            DO_SLO
+            CONTINUE
+            
+        MICROCODE(SLO_abs_5):
+        MICROCODE(SLO_abs_x_6):
+        MICROCODE(SLO_abs_y_6):
+        MICROCODE(SLO_ind_x_7):
+        MICROCODE(SLO_ind_y_7):
+            
+            WRITE_TO_ADDRESS
+            loadA(reg.a | reg.d);
+            POLL_INT
+            DONE
+            
+
+            // Instruction: SRE (LSE)
+            //
+            // Operation:   LSR, followed by EOR
+            //
+            // Flags:       N Z C I D V
+            //              / / / - - -
+
+#define DO_SRE setC(reg.d & 1); reg.d >>= 1;
+
+        MICROCODE(SRE_zpg_3):
+        MICROCODE(SRE_zpg_x_4):
+            
+            WRITE_TO_ZERO_PAGE
+            DO_SRE
+            CONTINUE
+            
+        MICROCODE(SRE_zpg_4):
+        MICROCODE(SRE_zpg_x_5):
+            
+            WRITE_TO_ZERO_PAGE
+            loadA(reg.a ^ reg.d);
+            POLL_INT
+            DONE
+            
+        MICROCODE(SRE_abs_4):
+        MICROCODE(SRE_abs_x_5):
+        MICROCODE(SRE_abs_y_5):
+        MICROCODE(SRE_ind_x_6):
+        MICROCODE(SRE_ind_y_6):
+            
+            WRITE_TO_ADDRESS
+            DO_SRE
+            CONTINUE
+            
+        MICROCODE(SRE_abs_5):
+        MICROCODE(SRE_abs_x_6):
+        MICROCODE(SRE_abs_y_6):
+        MICROCODE(SRE_ind_x_7):
+        MICROCODE(SRE_ind_y_7):
+            
+            WRITE_TO_ADDRESS
+            loadA(reg.a ^ reg.d);
+            POLL_INT
+            DONE
+
+
+            // Instruction: TAS (SHS)
+            //
+            // Operation:   SP := A & X,  Mem := SP & (HI_BYTE(op) + 1)
+            //
+            // Flags:       N Z C I D V
+            //              - - - - - -
+            
+        MICROCODE(TAS_abs_y_3):
+            
+            IDLE_READ_FROM_ADDRESS
+            
+            reg.sp = reg.a & reg.x;
+            
+            /* "There are two unstable conditions, the first is when a DMA is
+             *  going on while the instruction executes (the CPU is halted by
+             *  the VIC-II) then the & M+1 part drops off."
+             */
+            
+            reg.d = reg.a & reg.x & (rdyLineUp == clock ? 0xFF : reg.adh + 1);
+            
+            /* "The other unstable condition is when the addressing/indexing
+             *  causes a page boundary crossing, in that case the highbyte of
+             *  the target address may become equal to the value stored."
+             */
+            
+            if (PAGE_BOUNDARY_CROSSED) {
+                FIX_ADDR_HI;
+                reg.adh = reg.a & reg.x & reg.adh;
+            }
+
+            CONTINUE
+            
+        MICROCODE(TAS_abs_y_4):
+            
+            WRITE_TO_ADDRESS
+            POLL_INT
+            DONE
+
+            // Instruction: ANE
+            //
+            // Operation:   A = X & op & (A | 0xEE) (taken from Frodo)
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+
+        MICROCODE(ANE_imm):
+            
+            READ_IMMEDIATE
+            loadA(reg.x & reg.d & (reg.a | 0xEE));
+            POLL_INT
+            DONE
+
+
+            // Instruction: LXA
+            //
+            // Operation:   A = X = op & (A | 0xEE) (taken from Frodo)
+            //
+            // Flags:       N Z C I D V
+            //              / / - - - -
+
+        MICROCODE(LXA_imm):
+            
+            READ_IMMEDIATE
+            reg.x = reg.d & (reg.a | 0xEE);
+            loadA(reg.x);
+            POLL_INT
+            DONE
@@ -0,0 +1,108 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "C64Types.h"
+#include <algorithm>
+#include <bit>
+
+namespace vc64 {
+
+/* Priority queue over the event slots First ... Last.
+ *
+ * The queue is a binary min-heap with a fixed shape: the leaves hold the
+ * trigger cycles of all slots in slot order and each inner node holds the
+ * minimum of its two children (a tournament tree). The root thus contains
+ * the trigger cycle of the next pending event. Because the leaves stay in
+ * slot order, due events are enumerated in the same order as by a linear
+ * scan over all slots, but without visiting slots that are not due.
+ *
+ * The trigger array of the scheduler remains the authoritative source. It is
+ * serialized as before and the tree is rebuilt from it after a reset or after
+ * a snapshot has been loaded. Whenever the trigger cycle of a slot changes,
+ * update() has to be called.
+ *
+ * Complexity: O(1) for looking up the next trigger cycle, O(log n) for
+ * updating a slot, and O(log n) for locating the next due slot.
+ */
+template <isize First, isize Last> class EventQueue {
+
+    static constexpr isize capacity = Last - First + 1;
+    static constexpr isize leaves = isize(std::bit_ceil(usize(capacity)));
+
+    // Tree nodes (tree[1] is the root, the leaves start at tree[leaves])
+    Cycle tree[2 * leaves];
+
+public:
+
+    EventQueue() { for (auto &node : tree) node = INT64_MAX; }
+
+    // Returns the smallest trigger cycle
+    Cycle next() const { return tree[1]; }
+
+    // Assigns a new trigger cycle to a slot
+    void update(isize slot, Cycle cycle)
+    {
+        auto i = leaves + slot - First;
+        tree[i] = cycle;
+
+        // Propagate the change until a node keeps its value
+        for (i >>= 1; i; i >>= 1) {
+
+            auto min = std::min(tree[2 * i], tree[2 * i + 1]);
+            if (tree[i] == min) break;
+            tree[i] = min;
+        }
+    }
+
+    // Rebuilds the tree from the trigger array of the scheduler
+    void rebuild(const Cycle *trigger)
+    {
+        for (isize i = 0; i < leaves; i++) {
+            tree[leaves + i] = i < capacity ? trigger[First + i] : INT64_MAX;
+        }
+        for (isize i = leaves - 1; i; i--) tree[i] = std::min(tree[2 * i], tree[2 * i + 1]);
+    }
+
+    /* Returns the smallest slot number greater than 'after' whose event is due
+     * at the specified cycle, or -1 if no such slot exists.
+     */
+    isize nextDue(Cycle cycle, isize after) const
+    {
+        if (tree[1] > cycle) return -1;
+
+        // Descend to the leftmost due slot (the common case)
+        isize i = 1;
+        while (i < leaves) i = 2 * i + (tree[2 * i] > cycle);
+        if (First + i - leaves > after) return First + i - leaves;
+
+        // A slot in front of 'after' is still due. Search the slots behind it.
+        i = leaves + (after + 1 - First);
+        if (i >= leaves + capacity) return -1;
+
+        // Move right until we reach a subtree containing a due slot
+        while (tree[i] > cycle) {
+
+            while (i & 1) i >>= 1;
+            if (i == 0) return -1;
+            i++;
+        }
+
+        // Descend to the leftmost due slot inside this subtree
+        while (i < leaves) i = 2 * i + (tree[2 * i] > cycle);
+
+        return First + i - leaves;
+    }
+};
+
+}
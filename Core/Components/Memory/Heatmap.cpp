@@ -12,8 +12,9 @@
 
 #include "config.h"
 #include "Heatmap.h"
-#include "Memory.h"
-#include "VICII.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
 
 namespace vc64 {
 
@@ -39,45 +40,51 @@ Heatmap::Heatmap()
     }
     */
 
+    /* The heat of a cell decays by 10% in each frame without an access until
+     * it reaches zero or a fixed point in the denormal range.
+     */
+    for (float heat = 1.0; decay.empty() || heat < decay.back(); heat *= 0.9f) {
+        decay.push_back(heat);
+    }
+
+    /* Addresses are mapped to coordinates along a Z curve. The odd bits of an
+     * address make up the y coordinate and the even bits the x coordinate.
+     */
+    for (isize i = 0; i < 256; i++) {
+
+        spread[i] = 0;
+        for (isize bit = 0; bit < 8; bit++) {
+            if (i & (1 << bit)) spread[i] |= u16(1 << (2 * bit));
+        }
+    }
 }
 
 void
-Heatmap::update(const class Memory &mem)
+Heatmap::update()
 {
-    for (isize i = 0; i < 65536; i++) {
-        
-        // isize x = i % 256, y = i / 256;
-
-        isize x = 0, y = 0;
-        if (i & (1 << 15)) y += 128;
-        if (i & (1 << 14)) x += 128;
-        if (i & (1 << 13)) y += 64;
-        if (i & (1 << 12)) x += 64;
-        if (i & (1 << 11)) y += 32;
-        if (i & (1 << 10)) x += 32;
-        if (i & (1 << 9)) y += 16;
-        if (i & (1 << 8)) x += 16;
-        if (i & (1 << 7)) y += 8;
-        if (i & (1 << 6)) x += 8;
-        if (i & (1 << 5)) y += 4;
-        if (i & (1 << 4)) x += 4;
-        if (i & (1 << 3)) y += 2;
-        if (i & (1 << 2)) x += 2;
-        if (i & (1 << 1)) y += 1;
-        if (i & (1 << 0)) x += 1;
-
-        auto totalAccesses = mem.stats.reads[i] + mem.stats.writes[i];
-        auto accesses = totalAccesses - history[i];
-        history[i] = totalAccesses;
-
-        if (accesses) {
-            heatmap[y][x] = 1.0;
-        } else {
-            heatmap[y][x] = 0.9f * heatmap[y][x] + 0.1f * accesses;
+    if (!stamps) stamps = std::make_unique<u32[]>(65536);
+
+    frame++;
+
+    // Only visit the cells that have been accessed
+    for (isize w = 0; w < 1024; w++) {
+
+        for (u64 mask = cells[w]; mask; mask &= mask - 1) {
+            stamps[64 * w + std::countr_zero(mask)] = frame;
         }
+        cells[w] = 0;
     }
 }
 
+void
+Heatmap::clear()
+{
+    std::memset(cells, 0, sizeof(cells));
+
+    if (stamps) std::fill_n(stamps.get(), 65536, 0);
+    frame = 0;
+}
+
 void 
 Heatmap::draw(u32 *buffer, isize width, isize height) const
 {
@@ -87,9 +94,17 @@ Heatmap::draw(u32 *buffer, isize width, isize height) const
     float values[32][64] = { }, max = 0;
 
     // Accumulate values
-    for (usize y = 0; y < 256; y++) {
-        for (usize x = 0; x < 256; x++) {
-            values[y / 8][x / 4] += heatmap[y][x];
+    if (stamps) {
+
+        for (usize y = 0; y < 256; y++) {
+            for (usize x = 0; x < 256; x++) {
+
+                if (auto stamp = stamps[spread[x] | spread[y] << 1]; stamp) {
+
+                    auto age = std::min(usize(frame - stamp), decay.size() - 1);
+                    values[y / 8][x / 4] += decay[age];
+                }
+            }
         }
     }
 
@@ -13,18 +13,35 @@
 #pragma once
 
 #include "MemoryTypes.h"
+#include <memory>
+#include <vector>
 
 namespace vc64 {
 
 class Heatmap final {
 
-public:
+    friend class Benchmarks;
+
+    /* Access bitmap. The peek and poke functions set a bit for each accessed
+     * memory cell. The bitmap is evaluated and cleared at the end of each
+     * frame.
+     */
+    u64 cells[1024] = { };
+
+    // Number of evaluated frames
+    u32 frame = 0;
+
+    /* Frame of the most recent access to each memory cell (0 = never). The
+     * buffer is allocated when the first frame is evaluated. The heat of a
+     * cell is derived from its age when the heatmap is drawn.
+     */
+    std::unique_ptr<u32[]> stamps;
 
-    // Heapmap data
-    float heatmap[256][256] = { };
+    // Heat of a memory cell, indexed by the number of frames since its access
+    std::vector<float> decay;
 
-    // Cached accesses
-    isize history[65536] = { };
+    // Spreads the bits of a coordinate to the even bits of an address
+    u16 spread[256];
 
     // Color palette
     u32 palette[256];
@@ -35,11 +52,20 @@ public:
     //
 
 public:
-    
+
     Heatmap();
 
-    // Updates heatmap data
-    void update(const class Memory &mem);
+    // Records a memory access
+    void record(u16 addr) {
+
+        cells[addr >> 6] |= u64(1) << (addr & 63);
+    }
+
+    // Evaluates the accesses recorded in the current frame
+    void update();
+
+    // Discards all recorded accesses
+    void clear();
 
     // Draws a heatmap
     void draw(u32 *buffer, isize width, isize height) const;
@@ -97,6 +97,7 @@ Memory::Memory(C64 &ref) : SubComponent(ref)
     for (isize i = 0x1; i <= 0xF; i++) {
         peekSrc[i] = pokeTarget[i] = MemType::RAM;
     }
+    updateDirectAccessTables();
 }
 
 void
@@ -129,6 +130,10 @@ Memory::operator << (SerReader &worker)
 {
     serialize(worker);
     if (config.saveRoms) worker << rom;
+
+    updateDirectAccessTables();
+    ramPages.markAll();
+    romPages.markAll();
 }
 
 void 
@@ -203,6 +208,8 @@ Memory::eraseWithPattern(RamPattern pattern)
         default:
             fatalError;
     }
+
+    ramPages.markAll();
 }
 
 void 
@@ -223,12 +230,50 @@ Memory::updatePeekPokeLookupTables()
     
     // Call the Cartridge's delegation method
     expansionPort.updatePeekPokeLookupTables();
+
+    // Update the fast access paths
+    updateDirectAccessTables();
+}
+
+void
+Memory::updateDirectAccessTables()
+{
+    for (isize page = 0; page < 16; page++) {
+
+        peekPtr[page] = pokePtr[page] = nullptr;
+
+        // Recording the heatmap requires all accesses to take the slow path
+        if (config.heatmap) continue;
+
+        switch (peekSrc[page]) {
+
+            case MemType::PP:
+            case MemType::RAM:      peekPtr[page] = ram + (page << 12); break;
+            case MemType::BASIC:
+            case MemType::CHAR:
+            case MemType::KERNAL:   peekPtr[page] = rom + (page << 12); break;
+
+            default:
+                break;
+        }
+        switch (pokeTarget[page]) {
+
+            case MemType::PP:
+            case MemType::RAM:
+            case MemType::BASIC:
+            case MemType::CHAR:
+            case MemType::KERNAL:   pokePtr[page] = ram + (page << 12); break;
+
+            default:
+                break;
+        }
+    }
 }
 
 u8
 Memory::peek(u16 addr, MemType source)
 {
-    if (config.heatmap) stats.reads[addr]++;
+    if (config.heatmap) heatmap.record(addr);
 
     switch(source) {
             
@@ -281,7 +326,7 @@ Memory::peek(u16 addr, bool gameLine, bool exromLine)
 u8
 Memory::peekZP(u8 addr)
 {
-    if (config.heatmap) stats.reads[addr]++;
+    if (config.heatmap) heatmap.record(addr);
 
     if (likely(addr >= 0x02)) {
         return ram[addr];
@@ -293,7 +338,7 @@ Memory::peekZP(u8 addr)
 u8
 Memory::peekStack(u8 sp)
 {
-    if (config.heatmap) stats.reads[sp]++;
+    if (config.heatmap) heatmap.record(u16(0x100 + sp));
 
     return ram[0x100 + sp];
 }
@@ -303,7 +348,7 @@ Memory::peekIO(u16 addr)
 {
     assert(addr >= 0xD000 && addr <= 0xDFFF);
     
-    if (config.heatmap) stats.reads[addr]++;
+    if (config.heatmap) heatmap.record(addr);
 
     switch ((addr >> 8) & 0xF) {
             
@@ -453,7 +498,7 @@ Memory::spypeekColor(u16 addr) const
 void
 Memory::poke(u16 addr, u8 value, MemType target)
 {
-    if (config.heatmap) stats.writes[addr]++;
+    if (config.heatmap) heatmap.record(addr);
 
     switch(target) {
             
@@ -463,6 +508,7 @@ Memory::poke(u16 addr, u8 value, MemType target)
         case MemType::KERNAL:
             
             ram[addr] = value;
+            ramPages.mark(addr);
             return;
             
         case MemType::IO:
@@ -480,6 +526,7 @@ Memory::poke(u16 addr, u8 value, MemType target)
             
             if (likely(addr >= 0x02)) {
                 ram[addr] = value;
+                ramPages.mark(addr);
             } else {
                 addr ? cpu.writePort(value) : cpu.writePortDir(value);
             }
@@ -507,10 +554,11 @@ Memory::poke(u16 addr, u8 value, bool gameLine, bool exromLine)
 void
 Memory::pokeZP(u8 addr, u8 value)
 {
-    if (config.heatmap) stats.writes[addr]++;
+    if (config.heatmap) heatmap.record(addr);
 
     if (likely(addr >= 0x02)) {
         ram[addr] = value;
+        ramPages.mark(addr);
     } else if (addr == 0x00) {
         cpu.writePortDir(value);
     } else {
@@ -521,9 +569,10 @@ Memory::pokeZP(u8 addr, u8 value)
 void
 Memory::pokeStack(u8 sp, u8 value)
 {
-    if (config.heatmap) stats.writes[sp]++;
+    if (config.heatmap) heatmap.record(u16(0x100 + sp));
 
     ram[0x100 + sp] = value;
+    ramPages.mark(0x100);
 }
 
 void
@@ -531,7 +580,7 @@ Memory::pokeIO(u16 addr, u8 value)
 {
     assert(addr >= 0xD000 && addr <= 0xDFFF);
  
-    if (config.heatmap) stats.writes[addr]++;
+    if (config.heatmap) heatmap.record(addr);
 
     switch ((addr >> 8) & 0xF) {
             
@@ -789,8 +838,8 @@ Memory::sprint16b(char *s, u16 value)
 void
 Memory::endFrame()
 {
-    if (config.heatmap) {
-        heatmap.update(*this);
+    if (config.heatmap && !c64.getConfig().skipDebug && !c64.isRunAheadInstance()) {
+        heatmap.update();
     }
 }
 
@@ -16,12 +16,11 @@
 #include "MemoryDebugger.h"
 #include "SubComponent.h"
 #include "Heatmap.h"
+#include "utl/storage/DirtyMap.h"
 
 namespace vc64 {
 
-class Memory final : public SubComponent, public Inspectable<MemInfo, MemStats> {
-
-    friend class Heatmap;
+class Memory final : public SubComponent, public Inspectable<MemInfo> {
 
     Descriptions descriptions = {{
 
@@ -79,9 +78,30 @@ public:
     // Poke target lookup table
     MemType pokeTarget[16];
 
+    /* Direct access tables. For each 4KB page that is mapped to plain RAM or
+     * ROM, these tables point to the first byte of the page in the backing
+     * array. All other pages store a nullptr and are served by the switch in
+     * peek(u16, MemType) and poke(u16, u8, MemType). The first page is
+     * mapped to RAM, too. Its only two special cells, the processor port
+     * registers, are filtered out by an additional address check.
+     */
+    u8 *peekPtr[16] = { };
+    u8 *pokePtr[16] = { };
+
     // Indicates if watchpoints should be checked
     bool checkWatchpoints = false;
 
+    /* Dirty page maps for RAM (256 byte pages) and ROM (4 KB pages). They
+     * record all modifications since the last run-ahead synchronization and
+     * are cleared by the assignment operator in both instances. The RAM map
+     * also provides the RAM checksum.
+     */
+    mutable utl::DirtyMap<256> ramPages = utl::DirtyMap<256>(8);
+    mutable utl::DirtyMap<16> romPages = utl::DirtyMap<16>(12);
+
+    // Number of bytes copied by the latest assignment
+    isize clonedBytes = 0;
+
     // Debugging
     Heatmap heatmap;
 
@@ -96,8 +116,11 @@ public:
 
     Memory& operator= (const Memory& other) {
 
-        CLONE_ARRAY(ram)
-        CLONE_ARRAY(rom)
+        clonedBytes = 0;
+        clonedBytes += ramPages.sync(ram, other.ramPages, other.ram, sizeof(ram));
+        clonedBytes += romPages.sync(rom, other.romPages, other.rom, sizeof(rom));
+        clonedBytes += sizeof(colorRam);
+
         CLONE_ARRAY(colorRam)
 
         CLONE_ARRAY(peekSrc)
@@ -105,6 +128,8 @@ public:
 
         CLONE(config)
 
+        updateDirectAccessTables();
+
         return *this;
     }
 
@@ -120,9 +145,18 @@ public:
     {
         if (isSoftResetter(worker)) return;
 
+        if constexpr (std::is_same_v<T, SerChecker>) {
+
+            // Incorporate the cached page hashes instead of the RAM contents
+            worker << ramPages.fnv64(ram, sizeof(ram));
+
+        } else {
+
+            worker << ram;
+        }
+
         worker
 
-        << ram
         << colorRam;
 
         if (isResetter(worker)) return;
@@ -137,7 +171,7 @@ public:
 
     }
 
-    void operator << (SerResetter &worker) override { serialize(worker); }
+    void operator << (SerResetter &worker) override { serialize(worker); ramPages.markAll(); }
     void operator << (SerChecker &worker) override { serialize(worker); }
     void operator << (SerCounter &worker) override;
     void operator << (SerReader &worker) override;
@@ -194,6 +228,13 @@ public:
      */
     void updatePeekPokeLookupTables();
 
+private:
+
+    // Derives the direct access tables from the peek and poke lookup tables
+    void updateDirectAccessTables();
+
+public:
+
     // Returns the current peek source of the specified memory address
     MemType getPeekSource(u16 addr) { return peekSrc[addr >> 12]; }
 
@@ -203,7 +244,10 @@ public:
     // Reads a value from memory
     u8 peek(u16 addr, MemType source);
     u8 peek(u16 addr, bool gameLine, bool exromLine);
-    u8 peek(u16 addr) { return peek(addr, peekSrc[addr >> 12]); }
+    u8 peek(u16 addr) {
+        if (auto *p = peekPtr[addr >> 12]; likely(p && addr > 1)) return p[addr & 0xFFF];
+        return peek(addr, peekSrc[addr >> 12]);
+    }
     u8 peekZP(u8 addr);
     u8 peekStack(u8 sp);
     u8 peekIO(u16 addr);
@@ -223,7 +267,14 @@ public:
     // Writing a value into memory
     void poke(u16 addr, u8 value, MemType target);
     void poke(u16 addr, u8 value, bool gameLine, bool exromLine);
-    void poke(u16 addr, u8 value) { poke(addr, value, pokeTarget[addr >> 12]); }
+    void poke(u16 addr, u8 value) {
+        if (auto *p = pokePtr[addr >> 12]; likely(p && addr > 1)) {
+            p[addr & 0xFFF] = value;
+            ramPages.mark(addr);
+        } else {
+            poke(addr, value, pokeTarget[addr >> 12]);
+        }
+    }
     void pokeZP(u8 addr, u8 value);
     void pokeStack(u8 sp, u8 value);
     void pokeIO(u16 addr, u8 value);
@@ -125,6 +125,8 @@ Memory::setOption(Opt opt, i64 value)
         case Opt::MEM_HEATMAP:
 
             config.heatmap = (bool)value;
+            heatmap.clear();
+            updateDirectAccessTables();
             return;
 
         case Opt::MEM_SAVE_ROMS:
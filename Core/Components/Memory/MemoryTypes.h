@@ -193,13 +193,6 @@ typedef struct
 }
 MemInfo;
 
-typedef struct
-{
-    isize reads[65536];
-    isize writes[65536];
-}
-MemStats;
-
 typedef struct {
 
     u64 fnv;
@@ -0,0 +1,231 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "AudioKernels.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace vc64::audio {
+
+void
+accumulate(const short *src, isize n, float gainL, float gainR, float *l, float *r)
+{
+    isize i = 0;
+
+#if defined(__AVX2__)
+
+    auto gl = _mm256_set1_ps(gainL);
+    auto gr = _mm256_set1_ps(gainR);
+
+    for (; i + 8 <= n; i += 8) {
+
+        auto v = _mm_loadu_si128((const __m128i *)(src + i));
+        auto s = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(v));
+
+        _mm256_storeu_ps(l + i, _mm256_add_ps(_mm256_loadu_ps(l + i), _mm256_mul_ps(s, gl)));
+        _mm256_storeu_ps(r + i, _mm256_add_ps(_mm256_loadu_ps(r + i), _mm256_mul_ps(s, gr)));
+    }
+
+#elif defined(__SSE2__)
+
+    auto gl = _mm_set1_ps(gainL);
+    auto gr = _mm_set1_ps(gainR);
+
+    for (; i + 8 <= n; i += 8) {
+
+        auto v = _mm_loadu_si128((const __m128i *)(src + i));
+
+        // Sign-extend the 16-bit samples to 32 bit
+        auto lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+        auto hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16));
+
+        _mm_storeu_ps(l + i, _mm_add_ps(_mm_loadu_ps(l + i), _mm_mul_ps(lo, gl)));
+        _mm_storeu_ps(l + i + 4, _mm_add_ps(_mm_loadu_ps(l + i + 4), _mm_mul_ps(hi, gl)));
+        _mm_storeu_ps(r + i, _mm_add_ps(_mm_loadu_ps(r + i), _mm_mul_ps(lo, gr)));
+        _mm_storeu_ps(r + i + 4, _mm_add_ps(_mm_loadu_ps(r + i + 4), _mm_mul_ps(hi, gr)));
+    }
+
+#elif defined(__ARM_NEON)
+
+    auto gl = vdupq_n_f32(gainL);
+    auto gr = vdupq_n_f32(gainR);
+
+    for (; i + 8 <= n; i += 8) {
+
+        auto v = vld1q_s16(src + i);
+        auto lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(v)));
+        auto hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(v)));
+
+        vst1q_f32(l + i, vaddq_f32(vld1q_f32(l + i), vmulq_f32(lo, gl)));
+        vst1q_f32(l + i + 4, vaddq_f32(vld1q_f32(l + i + 4), vmulq_f32(hi, gl)));
+        vst1q_f32(r + i, vaddq_f32(vld1q_f32(r + i), vmulq_f32(lo, gr)));
+        vst1q_f32(r + i + 4, vaddq_f32(vld1q_f32(r + i + 4), vmulq_f32(hi, gr)));
+    }
+
+#endif
+
+    for (; i < n; i++) {
+
+        auto s = float(src[i]);
+        l[i] += s * gainL;
+        r[i] += s * gainR;
+    }
+}
+
+void
+modulate(float *samples, const float *volume, isize n)
+{
+    isize i = 0;
+
+#if defined(__AVX2__)
+
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(samples + i, _mm256_mul_ps(_mm256_loadu_ps(samples + i), _mm256_loadu_ps(volume + i)));
+    }
+
+#elif defined(__SSE2__)
+
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(samples + i, _mm_mul_ps(_mm_loadu_ps(samples + i), _mm_loadu_ps(volume + i)));
+    }
+
+#elif defined(__ARM_NEON)
+
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(samples + i, vmulq_f32(vld1q_f32(samples + i), vld1q_f32(volume + i)));
+    }
+
+#endif
+
+    for (; i < n; i++) samples[i] *= volume[i];
+}
+
+void
+interleave(const float *l, const float *r, isize n, float *dst)
+{
+    isize i = 0;
+
+#if defined(__AVX2__)
+
+    for (; i + 8 <= n; i += 8) {
+
+        auto a = _mm256_loadu_ps(l + i);
+        auto b = _mm256_loadu_ps(r + i);
+
+        // The unpack instructions operate on each 128-bit lane separately
+        auto lo = _mm256_unpacklo_ps(a, b);
+        auto hi = _mm256_unpackhi_ps(a, b);
+
+        _mm256_storeu_ps(dst + 2 * i, _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(dst + 2 * i + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+
+#elif defined(__SSE2__)
+
+    for (; i + 4 <= n; i += 4) {
+
+        auto a = _mm_loadu_ps(l + i);
+        auto b = _mm_loadu_ps(r + i);
+
+        _mm_storeu_ps(dst + 2 * i, _mm_unpacklo_ps(a, b));
+        _mm_storeu_ps(dst + 2 * i + 4, _mm_unpackhi_ps(a, b));
+    }
+
+#elif defined(__ARM_NEON)
+
+    for (; i + 4 <= n; i += 4) {
+        vst2q_f32(dst + 2 * i, (float32x4x2_t { vld1q_f32(l + i), vld1q_f32(r + i) }));
+    }
+
+#endif
+
+    for (; i < n; i++) {
+
+        dst[2 * i] = l[i];
+        dst[2 * i + 1] = r[i];
+    }
+}
+
+void
+deinterleave(const float *src, isize n, float *l, float *r)
+{
+    isize i = 0;
+
+#if defined(__SSE2__)
+
+    for (; i + 4 <= n; i += 4) {
+
+        auto a = _mm_loadu_ps(src + 2 * i);
+        auto b = _mm_loadu_ps(src + 2 * i + 4);
+
+        _mm_storeu_ps(l + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(r + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+
+#elif defined(__ARM_NEON)
+
+    for (; i + 4 <= n; i += 4) {
+
+        auto v = vld2q_f32(src + 2 * i);
+        vst1q_f32(l + i, v.val[0]);
+        vst1q_f32(r + i, v.val[1]);
+    }
+
+#endif
+
+    for (; i < n; i++) {
+
+        l[i] = src[2 * i];
+        r[i] = src[2 * i + 1];
+    }
+}
+
+void
+downmix(const float *src, isize n, float *dst)
+{
+    isize i = 0;
+
+#if defined(__SSE2__)
+
+    auto half = _mm_set1_ps(0.5f);
+
+    for (; i + 4 <= n; i += 4) {
+
+        auto a = _mm_loadu_ps(src + 2 * i);
+        auto b = _mm_loadu_ps(src + 2 * i + 4);
+        auto l = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        auto r = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+
+        _mm_storeu_ps(dst + i, _mm_mul_ps(half, _mm_add_ps(l, r)));
+    }
+
+#elif defined(__ARM_NEON)
+
+    for (; i + 4 <= n; i += 4) {
+
+        auto v = vld2q_f32(src + 2 * i);
+        vst1q_f32(dst + i, vmulq_n_f32(vaddq_f32(v.val[0], v.val[1]), 0.5f));
+    }
+
+#endif
+
+    for (; i < n; i++) dst[i] = 0.5f * (src[2 * i] + src[2 * i + 1]);
+}
+
+}
@@ -0,0 +1,43 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "BasicTypes.h"
+
+namespace vc64::audio {
+
+/* Block-based kernels of the audio pipeline.
+ *
+ * The kernels operate on plain arrays and are vectorized with AVX2, SSE2, or
+ * NEON, depending on the instruction sets enabled at compile time. On all
+ * other platforms, a scalar implementation is used. All implementations
+ * produce identical results, as none of them fuses multiplications and
+ * additions.
+ */
+
+// Adds n SID samples to the left and right channel, scaled by the given gains
+void accumulate(const short *src, isize n, float gainL, float gainR, float *l, float *r);
+
+// Multiplies n samples with a volume ramp
+void modulate(float *samples, const float *volume, isize n);
+
+// Combines n left and right channel samples to n stereo pairs
+void interleave(const float *l, const float *r, isize n, float *dst);
+
+// Splits n stereo pairs into n left and right channel samples
+void deinterleave(const float *src, isize n, float *l, float *r);
+
+// Downmixes n stereo pairs to n mono samples
+void downmix(const float *src, isize n, float *dst);
+
+}
@@ -12,7 +12,9 @@
 
 #include "config.h"
 #include "AudioStream.h"
+#include "AudioKernels.h"
 #include <algorithm>
+#include <cstring>
 
 namespace vc64 {
 
@@ -85,10 +87,14 @@ AudioStream::copyMono(float *buffer, isize n)
         }
 
         // The standard case: The buffer contains enough samples
-        for (isize i = 0; i < n; i++) {
+        for (isize i = 0; i < n; ) {
 
-            auto sample = read();
-            buffer[i] = 0.5f * (sample.l + sample.r);
+            auto span = readSpan();
+            auto cnt = std::min(n - i, isize(span.size()));
+
+            audio::downmix(&span[0].l, cnt, buffer + i);
+            skip(cnt);
+            i += cnt;
         }
 
         return n;
@@ -119,11 +125,14 @@ AudioStream::copyStereo(float *left, float *right, isize n)
         }
 
         // The standard case: The buffer contains enough samples
-        for (isize i = 0; i < n; i++) {
+        for (isize i = 0; i < n; ) {
+
+            auto span = readSpan();
+            auto cnt = std::min(n - i, isize(span.size()));
 
-            auto sample = read();
-            left[i] = sample.l;
-            right[i] = sample.r;
+            audio::deinterleave(&span[0].l, cnt, left + i, right + i);
+            skip(cnt);
+            i += cnt;
         }
 
         return n;
@@ -154,17 +163,37 @@ AudioStream::copyInterleaved(float *buffer, isize n)
         }
         
         // The standard case: The buffer contains enough samples
-        for (isize i = 0; i < n; i++) {
-            
-            auto sample = read();
-            *buffer++ = sample.l;
-            *buffer++ = sample.r;
-        }
+        consume(n, [&](const float *samples, isize cnt) {
+
+            std::memcpy(buffer, samples, 2 * cnt * sizeof(float));
+            buffer += 2 * cnt;
+        });
         
         return n;
     }
 }
 
+isize
+AudioStream::consume(isize n, const std::function<void(const float *, isize)> &consumer)
+{
+    {   SYNCHRONIZED
+
+        n = std::min(n, count());
+
+        for (isize i = 0; i < n; ) {
+
+            auto span = readSpan();
+            auto cnt = std::min(n - i, isize(span.size()));
+
+            consumer(&span[0].l, cnt);
+            skip(cnt);
+            i += cnt;
+        }
+
+        return n;
+    }
+}
+
 void
 AudioStream::drawL(u32 *buffer, isize width, isize height, u32 color) const
 {
@@ -35,6 +35,9 @@ struct SamplePair
     float r;
 };
 
+// Sample pairs are handed out as interleaved float arrays
+static_assert(sizeof(SamplePair) == 2 * sizeof(float));
+
 
 //
 // AudioStream
@@ -76,6 +79,14 @@ public:
     isize copyStereo(float *left, float *right, isize n);
     isize copyInterleaved(float *buffer, isize n);
 
+    /* Hands n audio samples over to a consumer without copying them. The
+     * consumer is called with a pointer to interleaved stereo samples and
+     * the number of sample pairs. It is called twice if the samples wrap
+     * around the end of the ring buffer. The function returns the number of
+     * consumed samples, which is smaller than n if a buffer underflow occurs.
+     */
+    isize consume(isize n, const std::function<void(const float *, isize)> &consumer);
+
 
     //
     // Visualizing the waveform
@@ -284,32 +284,32 @@ ReSID::poke(u16 addr, u8 value)
 isize
 ReSID::executeCycles(isize numCycles, SampleStream &stream)
 {
-    short buf[2048];
-    isize buflength = 2047;
+    // The caller resyncs the SID if it is too far behind (may run on a worker)
+    assert(numCycles <= PAL::CYCLES_PER_SECOND);
 
-    if (numCycles > PAL::CYCLES_PER_SECOND) {
-        logwarn("Number of missing SID cycles is far too large\n");
-        numCycles = PAL::CYCLES_PER_SECOND;
-    }
-    
-    // Let reSID compute sound samples
-    isize samples = 0;
+    // Let reSID compute sound samples (at most two chunks due to wrap-around)
     reSID::cycle_count cycles = (reSID::cycle_count)numCycles;
-    while (cycles && samples < buflength) {
-        int resid = sid->clock(cycles, buf + samples, int(buflength) - int(samples));
-        samples += (isize)resid;
-    }
-    
-    // Check for a buffer overflow
-    if (unlikely(samples > stream.free())) {
-        logwarn("SID %ld: SAMPLE BUFFER OVERFLOW", objid);
-        stream.clear();
+    while (cycles) {
+
+        auto span = stream.writeSpan();
+
+        // If the ring buffer is full, the chip is clocked without sound
+        if (unlikely(span.empty())) {
+
+            sid->clock_silent(cycles);
+            return isize(cycles);
+        }
+
+        stream.commit(sid->clock(cycles, span.data(), int(span.size())));
     }
-    
-    // Write samples into ringbuffer
-    if (samples) { for (isize i = 0; i < samples; i++) stream.write(buf[i]); }
-    
-    return samples;
+
+    return 0;
+}
+
+void
+ReSID::executeCycles(isize numCycles)
+{
+    sid->clock_silent(reSID::cycle_count(numCycles));
 }
 
 }
@@ -222,11 +222,17 @@ public:
     //
     
     /* Runs SID for the specified amount of CPU cycles. The generated sound
-     * samples are written into the provided ring buffer. The fuction returns
-     * the number of written audio samples.
+     * samples are written directly into the provided ring buffer. If the ring
+     * buffer runs full, the remaining cycles are executed without generating
+     * samples. The function returns the number of these cycles.
      */
     isize executeCycles(isize numCycles, SampleStream &stream);
-    isize executeCycles(isize numCycles);
+
+    /* Runs SID for the specified amount of CPU cycles without generating
+     * sound samples. Only the voices are clocked, which keeps the readable
+     * registers (OSC3 and ENV3) exact.
+     */
+    void executeCycles(isize numCycles);
 };
 
 }
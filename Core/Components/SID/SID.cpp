@@ -26,6 +26,7 @@ SID::operator << (SerReader &worker)
 {
     serialize(worker);
     stream.clear(0);
+    writes.clear();
 }
 
 u8
@@ -60,27 +61,103 @@ SID::poke(u16 addr, u8 value)
     }
 }
 
-void 
+void
+SID::deferredPoke(u16 addr, u8 value, Cycle cycle)
+{
+    sidreg[addr & 0x1F] = value;
+    writes.push_back({ cycle, u8(addr & 0x1F), value });
+}
+
+void
 SID::executeUntil(Cycle targetCycle)
 {
-    if (isEnabled() && !powerSave()) {
+    executeUntil(targetCycle, mode());
+    reportDrift();
+}
+
+void
+SID::executeUntil(Cycle targetCycle, const Mode &mode)
+{
+    executeWrites(mode);
+    synthesize(targetCycle, mode);
+}
+
+void
+SID::executeWrites()
+{
+    executeWrites(mode());
+    reportDrift();
+}
+
+void
+SID::executeWrites(const Mode &mode)
+{
+    // Replay the writes exactly as SIDBridge::poke() would have done
+    for (auto &write : writes) {
+
+        synthesize(write.cycle, mode);
+
+        switch (config.engine) {
+
+            case SIDEngine::RESID:   resid.poke(write.addr, write.value); break;
+
+            default:
+                fatalError;
+        }
+    }
+    writes.clear();
+}
+
+void
+SID::reportDrift()
+{
+    if (drift) {
+
+        logwarn("Resyncing SID %ld (%lld cycles off)\n", objid, drift);
+        drift = 0;
+    }
+}
+
+void
+SID::reportMuted()
+{
+    if (muted) {
+
+        logwarn("SID %ld: Sample buffer full (%lld cycles muted)\n", objid, muted);
+        muted = 0;
+    }
+}
+
+void
+SID::synthesize(Cycle targetCycle, const Mode &mode)
+{
+    if (isEnabled() && !mode.powerSave) {
 
         // Compute the number of missing cycles
         Cycle missing = targetCycle - clock;
 
-        // Check if SID is in sync with the CPU
-        if (missing < -1000 || missing > 1000000) {
+        // Check if SID is in sync with the CPU (the warning is issued later)
+        if (missing < -1000 || missing > PAL::CYCLES_PER_SECOND) {
 
-            logwarn("Resyncing SID %ld (%lld cycles off)\n", objid, missing);
+            drift = missing;
 
         } else {
 
             // Make sure to run for at least one cycle to make pipelined writes worke
             if (missing < 1) missing = 1;
 
-            // Compute the missing samples
-            auto numSamples = resid.executeCycles(isize(missing), stream);
-            loginfo(SID_EXEC, "%ld: target: %lld missing: %lld generated: %ld", objid, targetCycle, missing, numSamples);
+            // Only clock the readable registers if no samples are needed
+            if (mode.silent) {
+
+                resid.executeCycles(isize(missing));
+
+            } else {
+
+                // Compute the missing samples (the chip is never left behind)
+                auto count = stream.count();
+                muted += resid.executeCycles(isize(missing), stream);
+                loginfo(SID_EXEC, "%ld: target: %lld missing: %lld generated: %ld", objid, targetCycle, missing, stream.count() - count);
+            }
         }
     } else {
 
@@ -90,10 +167,16 @@ SID::executeUntil(Cycle targetCycle)
     clock = targetCycle;
 }
 
+bool
+SID::silent() const
+{
+    return c64.getConfig().skipAudio && !emulator.isRecording();
+}
+
 bool
 SID::powerSave() const
 {
-    if (emulator.isWarping() && config.powerSave) {
+    if (emulator.isWarping() && config.powerSave && !emulator.isRecording()) {
 
         /* https://sourceforge.net/p/vice-emu/bugs/1374/
          *
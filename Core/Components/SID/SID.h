@@ -23,6 +23,8 @@ class SID final : public SubComponent, public Inspectable<SIDInfo>
 {
     friend class SIDBridge;
     friend class AudioPort;
+    friend class Benchmarks;
+    friend class Checks;
 
     Descriptions descriptions = {
         {
@@ -74,6 +76,18 @@ class SID final : public SubComponent, public Inspectable<SIDInfo>
     // The audio stream
     SampleStream stream;
 
+    // A register write that has been recorded for later execution
+    struct RegWrite { Cycle cycle; u8 addr; u8 value; };
+
+    // Register writes that have not yet been passed to the backend
+    std::vector<RegWrite> writes;
+
+    // Number of cycles the backend was off when it was last resynced
+    Cycle drift = 0;
+
+    // Number of cycles executed without sound due to a full sample buffer
+    Cycle muted = 0;
+
 public:
 
     // Backends
@@ -92,6 +106,7 @@ public:
 
         CLONE_ARRAY(sidreg)
         CLONE(clock)
+        CLONE(writes)
         CLONE(resid)
 
         CLONE(config)
@@ -128,7 +143,7 @@ public:
         << config.sampling;
     }
 
-    void operator << (SerResetter &worker) override { serialize(worker); }
+    void operator << (SerResetter &worker) override { serialize(worker); writes.clear(); }
     void operator << (SerChecker &worker) override { serialize(worker); }
     void operator << (SerCounter &worker) override { serialize(worker); }
     void operator << (SerReader &worker) override;
@@ -189,19 +204,51 @@ public:
     // Writes a SID register
     void poke(u16 addr, u8 value);
 
+    // Records a register write which is passed to the backend later
+    void deferredPoke(u16 addr, u8 value, Cycle cycle);
+
 
     //
     // Computing audio samples
     //
 
-    /* Executes SID until a certain cycle is reached. The function returns the
-     * number of produced sound samples (not yet).
+    // Execution mode of the backend, determined on the emulator thread
+    struct Mode { bool powerSave; bool silent; };
+
+    /* Executes SID until a certain cycle is reached. Recorded register writes
+     * are passed to the backend at the cycles they were issued. The second
+     * variant is safe to call from a worker thread. It neither queries the
+     * emulator state nor writes to the log.
      */
     void executeUntil(Cycle targetCycle);
+    void executeUntil(Cycle targetCycle, const Mode &mode);
+
+    // Passes all recorded register writes to the backend
+    void executeWrites();
+    void executeWrites(const Mode &mode);
+
+    // Reports a resync that happened in a prior call to executeUntil()
+    void reportDrift();
+
+    // Reports the cycles that have been executed without sound
+    void reportMuted();
+
+private:
+
+    // Runs the backend until a certain cycle is reached
+    void synthesize(Cycle targetCycle, const Mode &mode);
+
+public:
+
+    // Returns the current execution mode
+    Mode mode() const { return { powerSave(), silent() }; }
 
     // Indicates if sample synthesis should be skipped
     bool powerSave() const;
 
+    // Indicates if only the readable registers need to be emulated
+    bool silent() const;
+
     
     //
     // Bridge functions
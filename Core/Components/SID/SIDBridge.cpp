@@ -111,6 +111,13 @@ SIDBridge::readPotY() const
     return result;
 }
 
+void
+SIDBridge::_willSave()
+{
+    // Bring the backends in sync with the SID registers
+    for (isize i = 0; i < 4; i++) sid[i].executeWrites();
+}
+
 void 
 SIDBridge::poke(u16 addr, u8 value)
 {
@@ -119,6 +126,13 @@ SIDBridge::poke(u16 addr, u8 value)
     // Select the target SID
     isize sidNr = mappedSID(addr);
 
+    // In parallel mode, the write is executed at the end of the frame
+    if (audioPort.config.parallel) {
+
+        sid[sidNr].deferredPoke(addr, value, cpu.clock);
+        return;
+    }
+
     // Get the target SID up to date
     sid[sidNr].executeUntil(cpu.clock);
 
@@ -159,15 +173,60 @@ void
 SIDBridge::endFrame()
 {
     // Execute all remaining SID cycles
-    sid0.executeUntil(cpu.clock);
-    sid1.executeUntil(cpu.clock);
-    sid2.executeUntil(cpu.clock);
-    sid3.executeUntil(cpu.clock);
+    if (audioPort.config.parallel) {
+
+        executeParallel();
+
+    } else {
+
+        sid0.executeUntil(cpu.clock);
+        sid1.executeUntil(cpu.clock);
+        sid2.executeUntil(cpu.clock);
+        sid3.executeUntil(cpu.clock);
+    }
+
+    // Report SIDs that were unable to store their samples (once per frame)
+    for (isize i = 0; i < 4; i++) sid[i].reportMuted();
 
     // Generate sound sampes
     audioPort.generateSamples();
 }
 
+void
+SIDBridge::executeParallel()
+{
+    isize active[4], count = 0;
+
+    for (isize i = 0; i < 4; i++) {
+
+        if (sid[i].isEnabled()) {
+            active[count++] = i;
+        } else {
+            sid[i].executeUntil(cpu.clock);
+        }
+    }
+
+    // A single SID is executed on the emulator thread
+    if (count <= 1) {
+
+        if (count) sid[active[0]].executeUntil(cpu.clock);
+        return;
+    }
+
+    if (!pool) pool = std::make_unique<utl::WorkerPool>(3);
+
+    // The emulator state is queried here, before the workers are started
+    auto target = cpu.clock;
+    SID::Mode mode[4];
+    for (isize i = 0; i < count; i++) mode[i] = sid[active[i]].mode();
+
+    // The SIDs share no state, so each one can be executed on its own thread
+    pool->run(count, [&](isize i) { sid[active[i]].executeUntil(target, mode[i]); });
+
+    // Issue the warnings the workers have recorded
+    for (isize i = 0; i < count; i++) sid[active[i]].reportDrift();
+}
+
 float
 SIDBridge::draw(u32 *buffer, isize width, isize height,
             float maxAmp, u32 color, isize nr) const
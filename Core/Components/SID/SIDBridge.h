@@ -19,6 +19,8 @@
 #include "AudioPort.h"
 #include "SID.h"
 #include "utl/chrono.h"
+#include "utl/concurrency/WorkerPool.h"
+#include <memory>
 
 namespace vc64 {
 
@@ -76,6 +78,11 @@ public:
         SID(c64, 3)
     };
 
+private:
+
+    // Worker threads for synthesizing multiple SIDs in parallel (lazily created)
+    std::unique_ptr<utl::WorkerPool> pool;
+
 
     //
     // Methods
@@ -111,6 +118,10 @@ public:
 
     const Descriptions &getDescriptions() const override { return descriptions; }
 
+private:
+
+    void _willSave() override;
+
 
     //
     // Methods from Configurable
@@ -146,6 +157,11 @@ public:
     // Finishes the current frame
     void endFrame();
 
+private:
+
+    // Runs all enabled SIDs until the current CPU cycle on the worker pool
+    void executeParallel();
+
     
     //
     // Accessig memory
@@ -734,8 +734,6 @@ void SID::adjust_sampling_frequency(double sample_freq)
 // ----------------------------------------------------------------------------
 void SID::clock(cycle_count delta_t)
 {
-  int i;
-
   // Pipelined writes on the MOS8580.
   if (unlikely(write_pipeline) && likely(delta_t > 0)) {
     // Step one cycle by a recursive call to ourselves.
@@ -749,6 +747,109 @@ void SID::clock(cycle_count delta_t)
     return;
   }
 
+  clock_voices(delta_t);
+
+  // Clock filter.
+  filter.clock(delta_t, voice[0].output(), voice[1].output(), voice[2].output());
+
+  // Clock external filter.
+  extfilt.clock(delta_t, filter.output());
+}
+
+
+// ----------------------------------------------------------------------------
+// SID clocking without audio output.
+// Only the parts affecting the readable registers (OSC3, ENV3, and the data
+// bus) are clocked. To keep these registers identical to clocking with audio
+// sampling, the chip is clocked in the same steps the sampling method takes.
+// The filters keep their state.
+// ----------------------------------------------------------------------------
+void SID::clock_silent(cycle_count delta_t)
+{
+  if (sampling != SAMPLE_FAST) {
+    for (; delta_t > 0; delta_t--) {
+      clock_voices();
+    }
+    return;
+  }
+
+  // Same steps as in clock_fast()
+  while (delta_t) {
+    cycle_count next_sample_offset = sample_offset + cycles_per_sample + (1 << (FIXP_SHIFT - 1));
+    cycle_count delta_t_sample = next_sample_offset >> FIXP_SHIFT;
+
+    if (delta_t_sample > delta_t) {
+      delta_t_sample = delta_t;
+    }
+
+    // Pipelined writes on the MOS8580.
+    cycle_count delta_t_voices = delta_t_sample;
+    if (unlikely(write_pipeline) && likely(delta_t_voices > 0)) {
+      write_pipeline = 0;
+      clock_voices(1);
+      write();
+      delta_t_voices -= 1;
+    }
+    if (likely(delta_t_voices > 0)) {
+      clock_voices(delta_t_voices);
+    }
+
+    if ((delta_t -= delta_t_sample) == 0) {
+      sample_offset -= delta_t_sample << FIXP_SHIFT;
+      break;
+    }
+
+    sample_offset = (next_sample_offset & FIXP_MASK) - (1 << (FIXP_SHIFT - 1));
+  }
+}
+
+
+// ----------------------------------------------------------------------------
+// SID clocking without audio output - 1 cycle.
+// ----------------------------------------------------------------------------
+void SID::clock_voices()
+{
+  int i;
+
+  // Clock amplitude modulators.
+  for (i = 0; i < 3; i++) {
+    voice[i].envelope.clock();
+  }
+
+  // Clock oscillators.
+  for (i = 0; i < 3; i++) {
+    voice[i].wave.clock();
+  }
+
+  // Synchronize oscillators.
+  for (i = 0; i < 3; i++) {
+    voice[i].wave.synchronize();
+  }
+
+  // Calculate waveform output.
+  for (i = 0; i < 3; i++) {
+    voice[i].wave.set_waveform_output();
+  }
+
+  // Pipelined writes on the MOS8580.
+  if (unlikely(write_pipeline)) {
+    write();
+  }
+
+  // Age bus value.
+  if (unlikely(!--bus_value_ttl)) {
+    bus_value = 0;
+  }
+}
+
+
+// ----------------------------------------------------------------------------
+// SID clocking without audio output - delta_t cycles.
+// ----------------------------------------------------------------------------
+void SID::clock_voices(cycle_count delta_t)
+{
+  int i;
+
   // Age bus value.
   bus_value_ttl -= delta_t;
   if (unlikely(bus_value_ttl <= 0)) {
@@ -813,12 +914,6 @@ void SID::clock(cycle_count delta_t)
   for (i = 0; i < 3; i++) {
     voice[i].wave.set_waveform_output(delta_t);
   }
-
-  // Clock filter.
-  filter.clock(delta_t, voice[0].output(), voice[1].output(), voice[2].output());
-
-  // Clock external filter.
-  extfilt.clock(delta_t, filter.output());
 }
 
 
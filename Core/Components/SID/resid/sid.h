@@ -55,6 +55,7 @@ public:
   void clock();
   void clock(cycle_count delta_t);
   int clock(cycle_count& delta_t, short* buf, int n, int interleave = 1);
+  void clock_silent(cycle_count delta_t);
   void reset();
 
   // Read/write registers.
@@ -105,6 +106,8 @@ public:
 
  public:
   static double I0(double x);
+  void clock_voices();
+  void clock_voices(cycle_count delta_t);
   int clock_fast(cycle_count& delta_t, short* buf, int n, int interleave);
   int clock_interpolate(cycle_count& delta_t, short* buf, int n, int interleave);
   int clock_resample(cycle_count& delta_t, short* buf, int n, int interleave);
@@ -140,6 +140,9 @@ DmaDebugger::cutLayers()
     
     // Only proceed if at least one channel is enabled
     if (!(config.cutLayers & 0x0F00)) return;
+
+    // Skip the current frame if it is drawn into a paletted texture
+    if (vic.paletted) return;
     
     u32 *emuTexturePtr = vic.emuTexturePtr;
     u8 *zBuffer = vic.zBuffer;
@@ -12,6 +12,13 @@
 
 #include "config.h"
 #include "Texture.h"
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 namespace vc64 {
 
@@ -20,12 +27,61 @@ Texture::Texture()
     pixels.alloc(texels);
 }
 
+void
+Texture::setPaletted(bool value)
+{
+    if (paletted == value) return;
+
+    // Swap the pixel buffer for a buffer of the other format
+    if (value) {
+
+        pixels.dealloc();
+        indices.alloc(texels);
+
+    } else {
+
+        indices.dealloc();
+        pixels.alloc(texels);
+    }
+
+    paletted = value;
+    clear();
+}
+
+Texture::Area
+Texture::visibleArea(bool pal)
+{
+    if (pal) {
+        return { PAL::FIRST_VISIBLE_PIXEL, PAL::FIRST_VISIBLE_LINE, PAL::LAST_VISIBLE_PIXEL, PAL::LAST_VISIBLE_LINE };
+    } else {
+        return { NTSC::FIRST_VISIBLE_PIXEL, NTSC::FIRST_VISIBLE_LINE, NTSC::LAST_VISIBLE_PIXEL, NTSC::LAST_VISIBLE_LINE };
+    }
+}
+
 void
 Texture::clear(Texel col1, Texel col2)
 {
-    auto *ptr = pixels.ptr;
+    for (isize row = 0; row < height; row++) clear(row, col1, col2);
+}
+
+void
+Texture::clear(isize row, Texel col1, Texel col2)
+{
+    changed.set(row);
+
+    if (paletted) {
+
+        auto *ptr = indices.ptr + row * width;
+        auto idx1 = index(col1), idx2 = index(col2);
+
+        for (isize col = 0; col < width; col++) {
+            ptr[col] = ((row >> 2) & 1) == ((col >> 3) & 1) ? idx1 : idx2;
+        }
+
+    } else {
+
+        auto *ptr = pixels.ptr + row * width;
 
-    for (isize row = 0; row < height; row++, ptr += width) {
         for (isize col = 0; col < width; col++) {
             ptr[col] = ((row >> 2) & 1) == ((col >> 3) & 1) ? col1 : col2;
         }
@@ -33,23 +89,101 @@ Texture::clear(Texel col1, Texel col2)
 }
 
 void
-Texture::clear(isize row, Texel col1, Texel col2)
+Texture::clear(isize row, isize cycle, Texel col1, Texel col2)
+{
+    changed.set(row);
+
+    if (paletted) {
+
+        auto *ptr = indices.ptr + row * width + 4 * cycle;
+        auto idx1 = index(col1), idx2 = index(col2);
+
+        for (isize col = 0; col < 4; col++) {
+            ptr[col] = ((row >> 2) & 1) == ((col >> 3) & 1) ? idx1 : idx2;
+        }
+
+    } else {
+
+        auto *ptr = pixels.ptr + row * width + 4 * cycle;
+
+        for (isize col = 0; col < 4; col++) {
+            ptr[col] = ((row >> 2) & 1) == ((col >> 3) & 1) ? col1 : col2;
+        }
+    }
+}
+
+void
+Texture::compare(isize row, const Texture &other)
 {
-    auto *ptr = pixels.ptr + row * width;
+    if (changed[row]) return;
+
+    if (paletted != other.paletted) {
+
+        changed.set(row);
+
+    } else if (paletted) {
+
+        auto *p1 = indices.ptr + row * width;
+        auto *p2 = other.indices.ptr + row * width;
+        if (std::memcmp(p1, p2, width) != 0) changed.set(row);
+
+    } else {
 
-    for (isize col = 0; col < width; col++) {
-        ptr[col] = ((row >> 2) & 1) == ((col >> 3) & 1) ? col1 : col2;
+        auto *p1 = pixels.ptr + row * width;
+        auto *p2 = other.pixels.ptr + row * width;
+        if (std::memcmp(p1, p2, width * sizeof(Texel)) != 0) changed.set(row);
     }
 }
 
 void
-Texture::clear(isize row, isize cycle, Texel col1, Texel col2)
+Texture::colorize(const u8 *src, isize n, const Texel *palette, Texel *dst)
 {
-    auto *ptr = pixels.ptr + row * width + 4 * cycle;
+    isize i = 0;
+
+#if defined(__AVX2__)
+
+    for (; i + 8 <= n; i += 8) {
+
+        auto idx = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(src + i)));
+        auto rgba = _mm256_i32gather_epi32((const int *)palette, idx, 4);
+        _mm256_storeu_si256((__m256i *)(dst + i), rgba);
+    }
+
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+
+    // Split the palette into byte planes which serve as lookup tables
+    u8 planes[4][32] = { };
+    for (isize c = 0; c < colors; c++) {
+        for (isize k = 0; k < 4; k++) planes[k][c] = u8(palette[c] >> (8 * k));
+    }
+    auto p0 = vld1q_u8_x2(planes[0]);
+    auto p1 = vld1q_u8_x2(planes[1]);
+    auto p2 = vld1q_u8_x2(planes[2]);
+    auto p3 = vld1q_u8_x2(planes[3]);
 
-    for (isize col = 0; col < 4; col++) {
-        ptr[col] = ((row >> 2) & 1) == ((col >> 3) & 1) ? col1 : col2;
+    for (; i + 16 <= n; i += 16) {
+
+        auto idx = vld1q_u8(src + i);
+        uint8x16x4_t rgba = {{
+
+            vqtbl2q_u8(p0, idx), vqtbl2q_u8(p1, idx),
+            vqtbl2q_u8(p2, idx), vqtbl2q_u8(p3, idx)
+        }};
+        vst4q_u8((u8 *)(dst + i), rgba);
     }
+
+#endif
+
+    for (; i < n; i++) dst[i] = palette[src[i]];
+}
+
+u8
+Texture::index(Texel col)
+{
+    // Paletted textures only support the colors of the checkerboard pattern
+    assert(col == grey2 || col == grey4);
+
+    return col == grey2 ? grey2Index : grey4Index;
 }
 
 }
@@ -14,6 +14,7 @@
 
 #include "utl/storage/Buffer.h"
 #include "Constants.h"
+#include <bitset>
 
 namespace vc64 {
 
@@ -45,18 +46,63 @@ public:
     // static constexpr Texel vblank   = grey4;    // VBLANK area
     // static constexpr Texel hblank   = grey4;    // HBLANK area
 
+    /* Color indices used in paletted textures. Indices 0 to 15 refer to the
+     * C64 colors, the remaining two to the colors of the checkerboard pattern.
+     */
+    static constexpr u8 grey2Index  = 16;
+    static constexpr u8 grey4Index  = 17;
+    static constexpr isize colors   = 18;
+
+    // Set of texture rows
+    typedef std::bitset<height> Rows;
+
+    // A rectangular texture area (given by its first and its last texel)
+    struct Area {
+
+        isize x1, y1, x2, y2;
+
+        isize width() const { return x2 - x1 + 1; }
+        isize height() const { return y2 - y1 + 1; }
+    };
+
     // Frame number
     i64 nr = 0;
 
-    // Pixel buffer
+    // Pixel buffer (RGBA textures)
     utl::Buffer <u32> pixels;
 
+    // Color index buffer (paletted textures)
+    utl::Buffer <u8> indices;
+
+    // Indicates which of the two buffers is in use
+    bool paletted = false;
+
+    // Rows that differ from the texture of the previous frame
+    Rows changed;
+
     Texture();
 
+    // Switches between RGBA and color index storage
+    void setPaletted(bool value);
+
     // Initializes (a portion of) the frame buffer with a checkerboard pattern
     void clear(Texel col1 = grey2, Texel col2 = grey4);
     void clear(isize row, Texel col1 = grey2, Texel col2 = grey4);
     void clear(isize row, isize cycle, Texel col1 = grey2, Texel col2 = grey4);
+
+    // Compares a row with the same row of another texture
+    void compare(isize row, const Texture &other);
+
+    // Translates n color indices to RGBA texels
+    static void colorize(const u8 *src, isize n, const Texel *palette, Texel *dst);
+
+    // Returns the texture area that is visible on a PAL or NTSC monitor
+    static Area visibleArea(bool pal);
+
+private:
+
+    // Returns the color index of a checkerboard color
+    static u8 index(Texel col);
 };
 
 }
@@ -73,8 +73,10 @@ VICII::_didReset(bool hard)
         lowerComparisonVal = lowerComparisonValue();
         
         // Reset the screen buffer pointers
-        emuTexture = getWorkingBuffer().pixels.ptr;
-        dmaTexture = getWorkingDmaBuffer().pixels.ptr;
+        selectTextures();
+
+        // Frame numbers start over, so old textures can't be compared anymore
+        for (isize i = 0; i < NUM_TEXTURES; i++) emuTex[i].changed.set();
     }
 }
 
@@ -136,6 +138,34 @@ VICII::resetTexture(u32 *p)
     }
 }
 
+void
+VICII::selectTextures()
+{
+    auto &texture = getWorkingBuffer();
+
+    /* Color indices are only stored if the user asks for it. The DMA debugger
+     * blends RGBA values into the emulator texture and therefore requires the
+     * RGBA format.
+     */
+    paletted = videoPort.getConfig().paletted &&
+    !dmaDebugger.config.dmaDebug && !(dmaDebugger.config.cutLayers & 0x1000);
+
+    // Start to record the rows that differ from the previous frame if needed
+    if (videoPort.tracksChangedRows()) {
+        texture.changed.reset();
+    } else {
+        texture.changed.set();
+    }
+    texture.setPaletted(paletted);
+
+    // Switch to the drawing routines writing the selected pixel format
+    updateVicFunctionTable();
+
+    emuTexture = texture.pixels.ptr;
+    colorTexture = texture.indices.ptr;
+    dmaTexture = getWorkingDmaBuffer().pixels.ptr;
+}
+
 void 
 VICII::updateRevision()
 {
@@ -189,6 +219,13 @@ VICII::setRevision(VICIIRev revision)
     msgQueue.put(isPAL ? Msg::PAL : Msg::NTSC);
 }
 
+void
+VICII::_didLoad()
+{
+    // The frame number has changed, so old textures can't be compared anymore
+    for (isize i = 0; i < NUM_TEXTURES; i++) emuTex[i].changed.set();
+}
+
 void
 VICII::_trackOn()
 {
@@ -302,6 +339,8 @@ VICII::updatePalette()
     for (isize i = 0; i < 16; i++) {
         rgbaTable[i] = monitor.getColor(i);
     }
+    rgbaTable[Texture::grey2Index] = Texture::grey2;
+    rgbaTable[Texture::grey4Index] = Texture::grey4;
 }
 
 u32 
@@ -695,14 +734,23 @@ VICII::beginFrame()
 
     lpIrqHasOccurred = false;
 
+    // Keep collision detection alive if video output is skipped
+    headlessSprites = c64.getHeadless() && c64.getConfig().skipVideo;
+
     // Clear statistics
     clearStats();
 }
 
+bool
+VICII::dmaDebug() const
+{
+    return dmaDebugger.config.dmaDebug && !c64.getConfig().skipDebug;
+}
+
 void
 VICII::endFrame()
 {
-    bool debug = dmaDebugger.config.dmaDebug;
+    bool debug = dmaDebug();
 
     // Update the VICII revision if requested
     updateRevision();
@@ -711,7 +759,11 @@ VICII::endFrame()
     if (c64.getHeadless()) return;
 
     // Run the DMA debugger if enabled
-    if (debug) dmaDebugger.computeOverlay(emuTexture, dmaTexture);
+    if (debug && !paletted) {
+
+        dmaDebugger.computeOverlay(emuTexture, dmaTexture);
+        getWorkingBuffer().changed.set();
+    }
 
     // Switch texture buffers
     emulator.lockTexture();
@@ -721,8 +773,7 @@ VICII::endFrame()
     activeBuffer = (activeBuffer + 1) % NUM_TEXTURES;
     emuTex[activeBuffer].nr = c64.frame;
     dmaTex[activeBuffer].nr = c64.frame;
-    emuTexture = emuTex[activeBuffer].pixels.ptr;
-    dmaTexture = dmaTex[activeBuffer].pixels.ptr;
+    selectTextures();
 
     if (debug) {
 
@@ -790,7 +841,11 @@ VICII::beginScanline()
     verticalFrameFFsetCond = false;
 
     // Adjust the texture pointers
-    emuTexturePtr = emuTexture + line * Texture::width;
+    if (paletted) {
+        indexLine = colorTexture + line * Texture::width;
+    } else {
+        emuTexturePtr = emuTexture + line * Texture::width;
+    }
     dmaTexturePtr = dmaTexture + line * Texture::width;
 
     // Determine if we're inside the VBLANK area
@@ -818,6 +873,9 @@ VICII::endScanline()
     // Cut out layers if requested
     dmaDebugger.cutLayers();
 
+    // Record if the line differs from the previous frame (if not known yet)
+    if (!c64.getHeadless()) getWorkingBuffer().compare(scanline(), getStableBuffer());
+
     // Prepare buffers for the next line
     for (isize i = 0; i < Texture::width; i++) { zBuffer[i] = 0; }
 }
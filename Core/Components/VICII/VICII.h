@@ -151,6 +151,7 @@ class VICII final : public SubComponent, public Inspectable<VICIIInfo, VICIIStat
     friend class DmaDebugger;
     friend class VideoPort;
     friend class Reu;
+    friend class Benchmarks;
     
     // REMOVE ASAP
     friend class Heatmap;
@@ -278,14 +279,16 @@ public:
      *     CYCLE_PAL       : Emulates a PAL cycle, NTSC otherwise
      *     CYCLE_DMA       : Runs the DMA debugger code for the specific cycle
      *     CYLCE_HEADLESS  : Skips all pixel-drawing related code
+     *     CYCLE_PALETTED  : Draws color indices instead of RGBA values
      *
      *   cycle: 1 .. 65 (cycle 0 is a stub and never called)
      *
      *   CYCLE_DMA and CYCLE_HEADLESS must be be set simultaneously as this
-     *   combination does not make sense.
+     *   combination does not make sense. The same holds for CYCLE_DMA and
+     *   CYCLE_PALETTED, as the DMA debugger requires RGBA values.
      */
     typedef void (VICII::*ViciiFunc)(void);
-    ViciiFunc functable[6][8][66] = {};
+    ViciiFunc functable[6][16][66] = {};
 
     // Function pointers currently in use
     ViciiFunc vicfunc[66] = {};
@@ -609,6 +612,13 @@ private:
     // Value of spriteDisplay, delayed by one cycle
     u8 spriteDisplayDelayed;
 
+    /* Indicates if sprites are drawn in headless frames. If set, the sprite
+     * sequencer keeps running and the canvas is drawn whenever a sprite is
+     * displayed. This keeps the collision registers up to date when video
+     * output is skipped.
+     */
+    bool headlessSprites = false;
+
     // Sprite DMA on off register
     u8 spriteDmaOnOff;
     
@@ -733,8 +743,11 @@ private:
 
     static constexpr isize NUM_TEXTURES = 9;
 
-    // C64 colors in RGBA format (updated in updatePalette())
-    u32 rgbaTable[16];
+    /* C64 colors in RGBA format (updated in updatePalette()). The table is
+     * extended by the checkerboard colors to serve as the palette of paletted
+     * textures.
+     */
+    Texel rgbaTable[Texture::colors];
 
     /* The emulator manages textures in ring buffers to allow access to older
      * frames ("run-behind" feature). At any time, one texture serves as the
@@ -760,6 +773,16 @@ private:
     u32 *emuTexture;
     u32 *dmaTexture;
 
+    /* Color index buffer of the current working texture. This buffer is used
+     * instead of emuTexture if the texture is paletted. In this mode, the
+     * drawing routines store C64 color indices which are translated to RGBA
+     * by the video port when a texture is requested.
+     */
+    u8 *colorTexture;
+
+    // Indicates if the current working texture is paletted
+    bool paletted = false;
+
     /* Pointer to the beginning of the current scanline inside the current
      * working textures. These pointers are used by all rendering methods to
      * write pixels. It always points to the beginning of a scanline, either
@@ -769,6 +792,12 @@ private:
     u32 *emuTexturePtr;
     u32 *dmaTexturePtr;
 
+    /* Pointer to the color indices of the current scanline. In paletted
+     * mode, the drawing routines write into this line instead of the RGBA
+     * line emuTexturePtr points to.
+     */
+    u8 *indexLine;
+
     /* VICII utilizes a depth buffer to determine pixel priority. The render
      * routines only write a color value, if it is closer to the view point.
      * The depth of the closest pixel is kept in this buffer. The lower the
@@ -999,6 +1028,7 @@ private:
     void _dump(Category category, std::ostream &os) const override;
     void _initialize() override;
     void _didReset(bool hard) override;
+    void _didLoad() override;
     void _trackOn() override;
     void _trackOff() override;
 
@@ -1030,7 +1060,8 @@ public:
     void checkOption(Opt opt, i64 value) override;
     void setOption(Opt opt, i64 value) override;
 
-    bool dmaDebug() const { return dmaDebugger.config.dmaDebug; }
+    // Indicates if the DMA debugger is active in the current frame
+    bool dmaDebug() const;
 
 private:
     
@@ -1050,6 +1081,9 @@ private:
     void resetDmaTextures();
     void resetTexture(u32 *p);
 
+    // Selects the working textures and decides about their format
+    void selectTextures();
+
     void initFuncTable(VICIIRev revision);
     void initFuncTable(VICIIRev revision, u16 flags);
     ViciiFunc getViciiFunc(u16 flags, isize cycle);
@@ -1120,6 +1154,9 @@ public:
     u32 getColor(isize nr) const { return rgbaTable[nr]; }
     u32 getColor(isize nr, Palette palette) const;
 
+    // Returns the palette used to translate paletted textures
+    const Texel *getPalette() const { return rgbaTable; }
+
     // Updates the RGBA values for all 16 C64 colors
     void updatePalette();
 
@@ -1498,26 +1535,41 @@ public:
     template <u16 flags> void cycle64();
     template <u16 flags> void cycle65();
 
+    // Checks if sprites are drawn in the current cycle
+    template <u16 flags> bool drawsSprites() const {
+        if constexpr (!(flags & HEADLESS_CYCLE)) return true;
+        return headlessSprites;
+    }
+
+    // Checks if the canvas and the border are drawn in the current cycle
+    template <u16 flags> bool drawsCanvas() const {
+        if constexpr (!(flags & HEADLESS_CYCLE)) return true;
+        return headlessSprites && (spriteDisplay | spriteDisplayDelayed | spriteSrActive);
+    }
+
+// Indicates if color indices are drawn in the current cycle
+#define DRAW_INDEXED bool(flags & PALETTED_CYCLE)
+
 #define DRAW_SPRITES_DMA1 \
 assert(isFirstDMAcycle); assert(!isSecondDMAcycle); \
-if constexpr (!(flags & HEADLESS_CYCLE)) { drawSpritesSlowPath(); }
+if (drawsSprites<flags>()) { drawSpritesSlowPath <DRAW_INDEXED> (); }
 
 #define DRAW_SPRITES_DMA2 \
 assert(!isFirstDMAcycle); assert(isSecondDMAcycle); \
-if constexpr (!(flags & HEADLESS_CYCLE)) { drawSpritesSlowPath(); }
+if (drawsSprites<flags>()) { drawSpritesSlowPath <DRAW_INDEXED> (); }
 
 #define DRAW_SPRITES \
 assert(!isFirstDMAcycle && !isSecondDMAcycle); \
-if (spriteDisplay && !(flags & HEADLESS_CYCLE)) { drawSprites(); }
+if (spriteDisplay && drawsSprites<flags>()) { drawSprites <DRAW_INDEXED> (); }
 
 #define DRAW_SPRITES59 \
-if ((spriteDisplayDelayed || spriteDisplay || isSecondDMAcycle) && !(flags & HEADLESS_CYCLE)) \
-{ drawSpritesSlowPath(); }
+if ((spriteDisplayDelayed || spriteDisplay || isSecondDMAcycle) && drawsSprites<flags>()) \
+{ drawSpritesSlowPath <DRAW_INDEXED> (); }
     
-#define DRAW   if (!vblank && !(flags & HEADLESS_CYCLE)) { drawCanvas(); drawBorder(); };
-#define DRAW17 if (!vblank && !(flags & HEADLESS_CYCLE)) { drawCanvas(); drawBorder17(); };
-#define DRAW55 if (!vblank && !(flags & HEADLESS_CYCLE)) { drawCanvas(); drawBorder55(); };
-#define DRAW59 if (!vblank && !(flags & HEADLESS_CYCLE)) { drawCanvas(); drawBorder(); };
+#define DRAW   if (!vblank && drawsCanvas<flags>()) { drawCanvas <DRAW_INDEXED> (); drawBorder <DRAW_INDEXED> (); };
+#define DRAW17 if (!vblank && drawsCanvas<flags>()) { drawCanvas <DRAW_INDEXED> (); drawBorder17 <DRAW_INDEXED> (); };
+#define DRAW55 if (!vblank && drawsCanvas<flags>()) { drawCanvas <DRAW_INDEXED> (); drawBorder55 <DRAW_INDEXED> (); };
+#define DRAW59 if (!vblank && drawsCanvas<flags>()) { drawCanvas <DRAW_INDEXED> (); drawBorder <DRAW_INDEXED> (); };
 
 #define END_CYCLE \
 dataBusPhi2 = 0xFF; \
@@ -1537,22 +1589,33 @@ END_CYCLE
     
 private:
 
+    /* All drawing routines are templated by the pixel format. If indexed is
+     * true, color indices are written into indexLine. Otherwise, RGBA values
+     * are written into emuTexturePtr.
+     */
+
     // Draws 8 border pixels. Invoked inside draw().
-    void drawBorder();
+    template <bool indexed> void drawBorder();
     
     // Draws the border pixels in cycle 17
-    void drawBorder17();
+    template <bool indexed> void drawBorder17();
     
     // Draws the border pixels in cycle 55
-    void drawBorder55();
+    template <bool indexed> void drawBorder55();
     
     // Draws 8 canvas pixels
-    void drawCanvas();
-    void drawCanvasFastPath();
-    void drawCanvasSlowPath();
+    template <bool indexed> void drawCanvas();
+    template <bool indexed> void drawCanvasFastPath();
+    template <bool indexed> void drawCanvasSlowPath();
 
     // Draws a single canvas pixel
-    void drawCanvasPixel(u8 pixel, u8 mode, u8 d016);
+    template <bool indexed> void drawCanvasPixel(u8 pixel, u8 mode, u8 d016);
+
+    /* Synthesizes a sequence of canvas pixels in the fast path. The colors and
+     * depths of count pixels are computed from the shift register contents
+     * and stored in bytes first to first + count - 1.
+     */
+    void synthesizeCanvas(isize first, isize count, u64 &colors, u64 &depths);
     
     // Reloads the sequencer shift register with the gAccess result
     void loadShiftRegister();
@@ -1564,14 +1627,14 @@ private:
 private:
     
     // Draws 8 sprite pixels (see draw())
-    void drawSprites();
-    void drawSpritesFastPath();
-    void drawSpritesSlowPath();
+    template <bool indexed> void drawSprites();
+    template <bool indexed> void drawSpritesFastPath();
+    template <bool indexed> void drawSpritesSlowPath();
     
     /* Draws all sprite pixels for a single sprite. This function is used when
      * the fast path is taken.
      */
-    template <bool multicolor> void drawSpriteNr(isize nr, bool enable, bool active);
+    template <bool indexed, bool multicolor> void drawSpriteNr(isize nr, bool enable, bool active);
 
     /* Draws a single sprite pixel for all sprites. This function is used when
      * the slow path is taken.
@@ -1580,7 +1643,7 @@ private:
      *    enableBits : the spriteDisplay bits
      *    freezeBits : forces the sprites shift register to freeze temporarily
      */
-    void drawSpritePixel(isize pixel, u8 enableBits, u8 freezeBits);
+    template <bool indexed> void drawSpritePixel(isize pixel, u8 enableBits, u8 freezeBits);
 
     // Performs collision detection
     void checkCollisions();
@@ -1591,8 +1654,9 @@ private:
     //
     
     // Writes a single color value into the screenbuffer
-#define COLORIZE(index,color) \
-emuTexturePtr[index] = rgbaTable[color];
+#define COLORIZE(index,color) { \
+if constexpr (indexed) indexLine[index] = color; \
+else emuTexturePtr[index] = rgbaTable[color]; }
     
     // Sets a single frame pixel
 #define SET_FRAME_PIXEL(pixel,color) { \
@@ -49,7 +49,7 @@ VICII::cycle1()
     }
     
     // Phi1.2 Draw sprites (invisible area)
-    if constexpr (!(flags & HEADLESS_CYCLE)) drawSpritesSlowPath();
+    if (drawsSprites<flags>()) drawSpritesSlowPath <DRAW_INDEXED> ();
 
     // Phi1.3 Fetch
     PAL  { sFinalize(2); pAccess <flags> (3); }
@@ -1134,5 +1134,9 @@ VICIIFUNCS(HEADLESS_CYCLE)
 VICIIFUNCS(PAL_CYCLE)
 VICIIFUNCS(PAL_CYCLE | DEBUG_CYCLE)
 VICIIFUNCS(PAL_CYCLE | HEADLESS_CYCLE)
+VICIIFUNCS(PALETTED_CYCLE)
+VICIIFUNCS(HEADLESS_CYCLE | PALETTED_CYCLE)
+VICIIFUNCS(PAL_CYCLE | PALETTED_CYCLE)
+VICIIFUNCS(PAL_CYCLE | HEADLESS_CYCLE | PALETTED_CYCLE)
 
 }
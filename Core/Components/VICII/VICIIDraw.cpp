@@ -16,7 +16,7 @@
 
 namespace vc64 {
 
-void
+template <bool indexed> void
 VICII::drawBorder()
 {
     if (flipflops.delayed.main) {
@@ -29,7 +29,7 @@ VICII::drawBorder()
     }
 }
 
-void
+template <bool indexed> void
 VICII::drawBorder17()
 {
     if (flipflops.delayed.main && !flipflops.current.main) {
@@ -43,11 +43,11 @@ VICII::drawBorder17()
     } else {
         
         // 40 column mode (all eight pixels are drawn)
-        drawBorder();
+        drawBorder <indexed> ();
     }
 }
 
-void
+template <bool indexed> void
 VICII::drawBorder55()
 {
     if (!flipflops.delayed.main && flipflops.current.main) {
@@ -57,146 +57,195 @@ VICII::drawBorder55()
         
     } else {
         
-        drawBorder();
+        drawBorder <indexed> ();
     }
 }
 
-void
+template <bool indexed> void
 VICII::drawCanvas()
 {
     if ((delay & VICUpdateRegisters) || debug::VICII_SAFE_MODE == 1) {
-        drawCanvasSlowPath();
+        drawCanvasSlowPath <indexed> ();
     } else {
-        drawCanvasFastPath();
+        drawCanvasFastPath <indexed> ();
+    }
+}
+
+namespace {
+
+/* Lookup tables translating the shift register contents into color codes.
+ * Byte i of each entry holds the code of pixel i. In hires mode, each pixel
+ * is determined by a single bit. In multicolor mode, two bits are read if
+ * the mc flipflop is set and repeated in the following pixel. The entries of
+ * the multicolor table are indexed by the flipflop state of the first pixel.
+ * If the flipflop is cleared, the first pixel repeats the color bits of the
+ * previous cycle which are added by the caller.
+ */
+struct CanvasTables {
+
+    u64 hires[256] = { };
+    u64 multi[2][256] = { };
+
+    constexpr CanvasTables()
+    {
+        for (isize data = 0; data < 256; data++) {
+
+            for (isize i = 0; i < 8; i++) {
+
+                hires[data] |= u64((data >> (7 - i)) & 1) << (8 * i);
+            }
+            for (isize flop = 0; flop < 2; flop++) {
+
+                u64 bits = 0;
+                for (isize i = 0; i < 8; i++) {
+
+                    if (bool(flop) != bool(i & 1)) bits = ((data << i) & 0xFF) >> 6;
+                    multi[flop][data] |= bits << (8 * i);
+                }
+            }
+        }
     }
+};
+
+constexpr CanvasTables canvasTables;
+
+// Picks one of four values for each byte, controlled by the color codes
+u64 pick(u64 codes, const u8 (&values)[4])
+{
+    constexpr u64 ones = 0x0101010101010101;
+
+    u64 lo = (codes & ones) * 0xFF;
+    u64 hi = ((codes >> 1) & ones) * 0xFF;
+
+    return
+    (~hi & ((~lo & (values[0] * ones)) | (lo & (values[1] * ones)))) |
+    (hi & ((~lo & (values[2] * ones)) | (lo & (values[3] * ones))));
+}
+
 }
 
 void
-VICII::drawCanvasFastPath()
+VICII::synthesizeCanvas(isize first, isize count, u64 &colors, u64 &depths)
 {
-    if (debug::VICII_STATS) stats.canvasFastPath++;
-    
-    u8 xscroll = reg.delayed.xscroll;
-    
+    if (count == 0) return;
+
+    auto bg0 = reg.delayed.colors[VICIIColorReg::BG_0];
+    auto bg1 = reg.delayed.colors[VICIIColorReg::BG_1];
+    auto bg2 = reg.delayed.colors[VICIIColorReg::BG_2];
+    auto lo = LO_NIBBLE(sr.latchedChr);
+    auto hi = HI_NIBBLE(sr.latchedChr);
+    auto col = sr.latchedCol;
+
+    // Determine the colors and depths of all color codes
+    bool multicolor = false;
+    u8 palette[4], depth[4] = { DEPTH_BG, DEPTH_FG, DEPTH_BG, DEPTH_FG };
+
     switch (reg.delayed.mode) {
-            
+
         case DisplayMode::STANDARD_TEXT:
-            
-            for (isize i = 0; i < 8; i++) {
-                
-                if (i == xscroll) loadShiftRegister();
-                sr.colorbits = (sr.data >> 7);
-                
-                if (sr.colorbits) {
-                    SET_FG_PIXEL(i, sr.latchedCol);
-                } else {
-                    SET_BG_PIXEL(i, reg.delayed.colors[VICIIColorReg::BG_0]);
-                }
-                
-                sr.data <<= 1;
-                sr.mcFlop = !sr.mcFlop;
-            }
-            return;
-            
+
+            palette[0] = palette[2] = bg0;
+            palette[1] = palette[3] = col;
+            break;
+
         case DisplayMode::MULTICOLOR_TEXT:
-            
-            for (isize i = 0; i < 8; i++) {
-                
-                if (i == xscroll) loadShiftRegister();
-                bool mc = sr.latchedCol & 0x8;
-                
-                if (mc) {
-                    
-                    if (sr.mcFlop) sr.colorbits = sr.data >> 6;
-                    
-                    switch (sr.colorbits) {
-                        case 0: SET_BG_PIXEL(i, reg.delayed.colors[VICIIColorReg::BG_0]); break;
-                        case 1: SET_BG_PIXEL(i, reg.delayed.colors[VICIIColorReg::BG_1]); break;
-                        case 2: SET_FG_PIXEL(i, reg.delayed.colors[VICIIColorReg::BG_2]); break;
-                        case 3: SET_FG_PIXEL(i, sr.latchedCol & 0x07); break;
-                    }
-                    
-                } else {
-                    
-                    sr.colorbits = (sr.data >> 7);
-                    
-                    if (sr.colorbits) {
-                        SET_FG_PIXEL(i, sr.latchedCol);
-                    } else {
-                        SET_BG_PIXEL(i, reg.delayed.colors[VICIIColorReg::BG_0]);
-                    }
-                }
-                
-                sr.data <<= 1;
-                sr.mcFlop = !sr.mcFlop;
+
+            if ((multicolor = col & 0x8)) {
+
+                palette[0] = bg0; palette[1] = bg1; palette[2] = bg2; palette[3] = col & 0x07;
+
+            } else {
+
+                palette[0] = palette[2] = bg0;
+                palette[1] = palette[3] = col;
             }
-            return;
-            
+            break;
+
         case DisplayMode::STANDARD_BITMAP:
-            
-            for (isize i = 0; i < 8; i++) {
-                
-                if (i == xscroll) loadShiftRegister();
-                sr.colorbits = (sr.data >> 7);
-                
-                if (sr.colorbits) {
-                    SET_FG_PIXEL(i, HI_NIBBLE(sr.latchedChr));
-                } else {
-                    SET_BG_PIXEL(i, LO_NIBBLE(sr.latchedChr));
-                }
-                
-                sr.data <<= 1;
-                sr.mcFlop = !sr.mcFlop;
-            }
-            return;
-            
+
+            palette[0] = palette[2] = lo;
+            palette[1] = palette[3] = hi;
+            break;
+
         case DisplayMode::MULTICOLOR_BITMAP:
-            
-            for (isize i = 0; i < 8; i++) {
-                
-                if (i == xscroll) loadShiftRegister();
-                if (sr.mcFlop) sr.colorbits = sr.data >> 6;
-                
-                switch (sr.colorbits) {
-                    case 0: SET_BG_PIXEL(i, reg.delayed.colors[VICIIColorReg::BG_0]); break;
-                    case 1: SET_BG_PIXEL(i, HI_NIBBLE(sr.latchedChr)); break;
-                    case 2: SET_FG_PIXEL(i, LO_NIBBLE(sr.latchedChr)); break;
-                    case 3: SET_FG_PIXEL(i, sr.latchedCol); break;
-                }
-                
-                sr.data <<= 1;
-                sr.mcFlop = !sr.mcFlop;
-            }
-            return;
-            
+
+            multicolor = true;
+            palette[0] = bg0; palette[1] = hi; palette[2] = lo; palette[3] = col;
+            break;
+
         case DisplayMode::EXTENDED_BG_COLOR:
-            
-            for (isize i = 0; i < 8; i++) {
-                
-                if (i == xscroll) loadShiftRegister();
-                sr.colorbits = (sr.data >> 7);
-                
-                if (sr.colorbits) {
-                    SET_FG_PIXEL(i, sr.latchedCol);
-                } else {
-                    isize regnr = VICIIColorReg::BG_0 + (sr.latchedChr >> 6);
-                    SET_BG_PIXEL(i, reg.delayed.colors[regnr]);
-                }
-                
-                sr.data <<= 1;
-                sr.mcFlop = !sr.mcFlop;
-            }
-            return;
-            
-        default:
-            
-            // Invalid color modes (no speedup necessary)
-            drawCanvasSlowPath();
+
+            palette[0] = palette[2] = reg.delayed.colors[VICIIColorReg::BG_0 + (sr.latchedChr >> 6)];
+            palette[1] = palette[3] = col;
             break;
+
+        default:
+            fatalError;
     }
+
+    // Translate the shift register contents into color codes
+    u64 codes;
+    if (multicolor) {
+
+        codes = canvasTables.multi[sr.mcFlop][sr.data] | (sr.mcFlop ? 0 : sr.colorbits);
+        depth[1] = DEPTH_BG;
+        depth[2] = DEPTH_FG;
+
+    } else {
+
+        codes = canvasTables.hires[sr.data];
+    }
+
+    // Only keep the pixels of this segment
+    u64 mask = (count == 8 ? ~0ULL : (1ULL << (8 * count)) - 1) << (8 * first);
+    colors |= (pick(codes, palette) << (8 * first)) & mask;
+    depths |= (pick(codes, depth) << (8 * first)) & mask;
+
+    // Advance the shift register
+    sr.colorbits = u8(codes >> (8 * (count - 1)));
+    sr.data = u8(sr.data << count);
+    sr.mcFlop = sr.mcFlop != bool(count & 1);
 }
 
-void
+template <bool indexed> void
+VICII::drawCanvasFastPath()
+{
+    if (debug::VICII_STATS) stats.canvasFastPath++;
+
+    // Invalid color modes (no speedup necessary)
+    if (reg.delayed.mode > DisplayMode::EXTENDED_BG_COLOR) {
+
+        drawCanvasSlowPath <indexed> ();
+        return;
+    }
+
+    u8 xscroll = reg.delayed.xscroll;
+    u64 colors = 0, depths = 0;
+
+    // Synthesize the pixels in front of and behind the shift register reload
+    synthesizeCanvas(0, xscroll, colors, depths);
+    loadShiftRegister();
+    synthesizeCanvas(xscroll, 8 - xscroll, colors, depths);
+
+    // Write all eight pixels at once
+    if constexpr (indexed) {
+
+        for (isize i = 0; i < 8; i++, colors >>= 8) {
+            indexLine[bufferoffset + i] = u8(colors);
+        }
+
+    } else {
+
+        for (isize i = 0; i < 8; i++, colors >>= 8) {
+            emuTexturePtr[bufferoffset + i] = rgbaTable[u8(colors)];
+        }
+    }
+    for (isize i = 0; i < 8; i++, depths >>= 8) {
+        zBuffer[bufferoffset + i] = u8(depths);
+    }
+}
+
+template <bool indexed> void
 VICII::drawCanvasSlowPath()
 {
     if (debug::VICII_STATS) stats.canvasSlowPath++;
@@ -215,7 +264,7 @@ VICII::drawCanvasSlowPath()
     // Pixel 0
     //
     
-    drawCanvasPixel(0, mode, d016);
+    drawCanvasPixel <indexed> (0, mode, d016);
     
     // After the first pixel, color register changes show up
     reg.delayed.colors[VICIIColorReg::BG_0] = reg.current.colors[VICIIColorReg::BG_0];
@@ -227,9 +276,9 @@ VICII::drawCanvasSlowPath()
     // Pixel 1, 2, 3
     //
     
-    drawCanvasPixel(1, mode, d016);
-    drawCanvasPixel(2, mode, d016);
-    drawCanvasPixel(3, mode, d016);
+    drawCanvasPixel <indexed> (1, mode, d016);
+    drawCanvasPixel <indexed> (2, mode, d016);
+    drawCanvasPixel <indexed> (3, mode, d016);
     
     /* After pixel 4, a change in D016 affects the display mode. In older
      * VICIIs, the one bits of D011 show up, too.
@@ -242,8 +291,8 @@ VICII::drawCanvasSlowPath()
     // Pixel 4, 5
     //
     
-    drawCanvasPixel(4, mode, d016);
-    drawCanvasPixel(5, mode, d016);
+    drawCanvasPixel <indexed> (4, mode, d016);
+    drawCanvasPixel <indexed> (5, mode, d016);
     
     // In older VICIIs, the zero bits of D011 show up here.
     if (is656x) {
@@ -255,7 +304,7 @@ VICII::drawCanvasSlowPath()
     // Pixel 6
     //
     
-    drawCanvasPixel(6, mode, d016);
+    drawCanvasPixel <indexed> (6, mode, d016);
     
     /* Before the last pixel is drawn, a change in D016 is fully detected.
      * If the multicolor bit is set, the mc flip flop resets immediately.
@@ -269,10 +318,10 @@ VICII::drawCanvasSlowPath()
     // Pixel 7
     //
     
-    drawCanvasPixel(7, mode, d016);
+    drawCanvasPixel <indexed> (7, mode, d016);
 }
 
-void
+template <bool indexed> void
 VICII::drawCanvasPixel(u8 pixel, u8 mode, u8 d016)
 {
     /* "The heart of the sequencer is a 8 bit shift register that is shifted
@@ -375,4 +424,17 @@ VICII::loadShiftRegister()
     }
 }
 
+template void VICII::drawBorder<false>();
+template void VICII::drawBorder17<false>();
+template void VICII::drawBorder55<false>();
+template void VICII::drawCanvas<false>();
+template void VICII::drawCanvasFastPath<false>();
+template void VICII::drawCanvasSlowPath<false>();
+template void VICII::drawBorder<true>();
+template void VICII::drawBorder17<true>();
+template void VICII::drawBorder55<true>();
+template void VICII::drawCanvas<true>();
+template void VICII::drawCanvasFastPath<true>();
+template void VICII::drawCanvasSlowPath<true>();
+
 }
@@ -15,16 +15,16 @@
 
 namespace vc64 {
 
-void
+template <bool indexed> void
 VICII::drawSprites()
 {
     assert(!isFirstDMAcycle);
     assert(!isSecondDMAcycle);
     
     if ((delay & VICUpdateRegisters) || debug::VICII_SAFE_MODE == 1) {
-        drawSpritesSlowPath();
+        drawSpritesSlowPath <indexed> ();
     } else {
-        drawSpritesFastPath();
+        drawSpritesFastPath <indexed> ();
     }
 }
 
@@ -32,7 +32,7 @@ VICII::drawSprites()
 // Fast path
 //
 
-void
+template <bool indexed> void
 VICII::drawSpritesFastPath()
 {    
     if (debug::VICII_STATS) stats.spriteFastPath++;
@@ -52,12 +52,12 @@ VICII::drawSpritesFastPath()
         if (GET_BIT(reg.delayed.sprMC, i)) {
             
             // Draw multicolor sprite
-            drawSpriteNr <true> (i, enable, active);
+            drawSpriteNr <indexed, true> (i, enable, active);
             
         } else {
             
             // Draw monocolor sprite
-            drawSpriteNr <false> (i, enable, active);
+            drawSpriteNr <indexed, false> (i, enable, active);
         }
     }
 
@@ -65,7 +65,7 @@ VICII::drawSpritesFastPath()
     checkCollisions();
 }
 
-template <bool multicolor> void
+template <bool indexed, bool multicolor> void
 VICII::drawSpriteNr(isize nr, bool enable, bool active)
 {
     bool xExp = GET_BIT(reg.delayed.sprExpandX, nr);
@@ -141,7 +141,7 @@ VICII::drawSpriteNr(isize nr, bool enable, bool active)
 // Slow path
 //
 
-void
+template <bool indexed> void
 VICII::drawSpritesSlowPath()
 {
     if (debug::VICII_STATS) stats.spriteSlowPath++;
@@ -156,7 +156,7 @@ VICII::drawSpritesSlowPath()
     // Pixel 0
     //
     
-    drawSpritePixel(0, spriteDisplayDelayed, secondDMA);
+    drawSpritePixel <indexed> (0, spriteDisplayDelayed, secondDMA);
     
     // After the first pixel, color register changes show up
     reg.delayed.colors[VICIIColorReg::SPR_EX1] = reg.current.colors[VICIIColorReg::SPR_EX1];
@@ -169,13 +169,13 @@ VICII::drawSpritesSlowPath()
     // Pixel 1, 2, 3
     //
 
-    drawSpritePixel(1, spriteDisplayDelayed, secondDMA);
+    drawSpritePixel <indexed> (1, spriteDisplayDelayed, secondDMA);
     
     // Stop shift register on the second DMA cycle
     spriteSrActive &= ~secondDMA;
     
-    drawSpritePixel(2, spriteDisplayDelayed, secondDMA);
-    drawSpritePixel(3, spriteDisplayDelayed, firstDMA | secondDMA);
+    drawSpritePixel <indexed> (2, spriteDisplayDelayed, secondDMA);
+    drawSpritePixel <indexed> (3, spriteDisplayDelayed, firstDMA | secondDMA);
     
     // If a shift register is loaded, the new data appears here
     updateSpriteShiftRegisters();
@@ -184,8 +184,8 @@ VICII::drawSpritesSlowPath()
     // Pixel 4, 5
     //
 
-    drawSpritePixel(4, spriteDisplay, firstDMA | secondDMA);
-    drawSpritePixel(5, spriteDisplay, firstDMA | secondDMA);
+    drawSpritePixel <indexed> (4, spriteDisplay, firstDMA | secondDMA);
+    drawSpritePixel <indexed> (5, spriteDisplay, firstDMA | secondDMA);
     
     // Changes of the X expansion bits and the priority bits show up here
     reg.delayed.sprExpandX = reg.current.sprExpandX;
@@ -212,7 +212,7 @@ VICII::drawSpritesSlowPath()
     // Pixel 6
     //
 
-    drawSpritePixel(6, spriteDisplay, firstDMA | secondDMA);
+    drawSpritePixel <indexed> (6, spriteDisplay, firstDMA | secondDMA);
     
     // Update multicolor bits if an old VICII is emulated
     if (toggle && is656x) {
@@ -225,13 +225,13 @@ VICII::drawSpritesSlowPath()
     }
     
     // Pixel 7
-    drawSpritePixel(7, spriteDisplay, firstDMA);
+    drawSpritePixel <indexed> (7, spriteDisplay, firstDMA);
     
     // Perform collision checks
     checkCollisions();
 }
 
-void
+template <bool indexed> void
 VICII::drawSpritePixel(isize pixel, u8 enableBits, u8 freezeBits)
 {
     if (!enableBits && !spriteSrActive) return;
@@ -350,4 +350,9 @@ VICII::checkCollisions()
     }
 }
 
+template void VICII::drawSprites<false>();
+template void VICII::drawSpritesSlowPath<false>();
+template void VICII::drawSprites<true>();
+template void VICII::drawSpritesSlowPath<true>();
+
 }
@@ -22,6 +22,8 @@ VICII::initFuncTable(VICIIRev revision)
     initFuncTable(revision, 0);
     initFuncTable(revision, DEBUG_CYCLE);
     initFuncTable(revision, HEADLESS_CYCLE);
+    initFuncTable(revision, PALETTED_CYCLE);
+    initFuncTable(revision, HEADLESS_CYCLE | PALETTED_CYCLE);
 }
 
 void
@@ -70,6 +72,7 @@ VICII::updateVicFunctionTable()
     logdebug(VICII_DEBUG, "updateVicFunctionTable\n");
     
     u16 flags = c64.getHeadless() ? HEADLESS_CYCLE : dmaDebug() ? DEBUG_CYCLE : 0;
+    if (paletted) flags |= PALETTED_CYCLE;
     
     for (isize i = 1; i < 66; i++) {
 
@@ -100,6 +103,18 @@ VICII::getViciiFunc(u16 flags, isize cycle)
 
         case PAL_CYCLE | HEADLESS_CYCLE:
             return getViciiFunc <PAL_CYCLE | HEADLESS_CYCLE> (cycle);
+
+        case PALETTED_CYCLE:
+            return getViciiFunc <PALETTED_CYCLE> (cycle);
+
+        case HEADLESS_CYCLE | PALETTED_CYCLE:
+            return getViciiFunc <HEADLESS_CYCLE | PALETTED_CYCLE> (cycle);
+
+        case PAL_CYCLE | PALETTED_CYCLE:
+            return getViciiFunc <PAL_CYCLE | PALETTED_CYCLE> (cycle);
+
+        case PAL_CYCLE | HEADLESS_CYCLE | PALETTED_CYCLE:
+            return getViciiFunc <PAL_CYCLE | HEADLESS_CYCLE | PALETTED_CYCLE> (cycle);
             
         default:
             fatalError;
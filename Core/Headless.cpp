@@ -15,6 +15,9 @@
 #include "Headless.h"
 #include "C64.h"
 #include "Script.h"
+#include "BatchRunner.h"
+#include "Benchmarks.h"
+#include "Checks.h"
 #include <chrono>
 
 int main(int argc, char *argv[])
@@ -25,13 +28,27 @@ int main(int argc, char *argv[])
 
     } catch (vc64::SyntaxError &e) {
 
-        std::cout << "Usage: VirtualC64Headless [-fsdvm] [<script>]" << std::endl;
+        std::cout << "Usage: VirtualC64Headless [-fsdcpvmt] [<script>]" << std::endl;
+        std::cout << "       VirtualC64Headless [--video <file>] [--audio <file>] [--size <w>x<h>] <script>" << std::endl;
+        std::cout << "       VirtualC64Headless -b [-t] [-j <n>] [--frames <n>] [--cycles <n>] <file>..." << std::endl;
+        std::cout << "       VirtualC64Headless -p [--baseline <file>]" << std::endl;
         std::cout << std::endl;
         std::cout << "       -f or --footprint   Report the size of objects" << std::endl;
         std::cout << "       -s or --smoke       Run smoke tests to test the build" << std::endl;
         std::cout << "       -d or --diagnose    Launch the emulator thread" << std::endl;
+        std::cout << "       -c or --check       Run regression checks" << std::endl;
+        std::cout << "       -p or --perf        Run micro benchmarks" << std::endl;
         std::cout << "       -v or --verbose     Print the executed script lines" << std::endl;
         std::cout << "       -m or --messages    Observe the message queue" << std::endl;
+        std::cout << "       -b or --batch       Run all files on independent C64 instances" << std::endl;
+        std::cout << "       -t or --turbo       Skip drawing, sound synthesis, and debug overlays" << std::endl;
+        std::cout << "       -j or --jobs        Number of worker threads in batch mode" << std::endl;
+        std::cout << "       --frames            Frame budget per file in batch mode" << std::endl;
+        std::cout << "       --cycles            Cycle budget per file in batch mode" << std::endl;
+        std::cout << "       --video             Record video (Y4M if the file ends with .y4m, else raw RGBA)" << std::endl;
+        std::cout << "       --audio             Record audio (WAV)" << std::endl;
+        std::cout << "       --size              Apply the monitor effects to the recorded frames" << std::endl;
+        std::cout << "       --baseline          Compare the benchmarks with a file (created if missing)" << std::endl;
         std::cout << "       <script>            Execute a custom script" << std::endl;
         std::cout << std::endl;
 
@@ -75,6 +92,9 @@ Headless::main(int argc, char *argv[])
     if (keys.find("footprint") != keys.end())   { reportSize(); }
     if (keys.find("smoke") != keys.end())       { runScript(smokeTestScript); }
     if (keys.find("diagnose") != keys.end())    { runScript(selfTestScript); }
+    if (keys.find("check") != keys.end())       { if (Checks::run()) returnCode = 1; }
+    if (keys.find("perf") != keys.end())        { Benchmarks::run(keys["baseline"]); }
+    if (keys.find("batch") != keys.end())       { runBatch(); return returnCode; }
     if (keys.find("arg1") != keys.end())        { runScript(keys["arg1"]); }
 
     return returnCode;
@@ -96,8 +116,23 @@ Headless::parseArguments(int argc, char *argv[])
             if (arg == "-f" || arg == "--footprint") { keys["footprint"] = "1"; continue; }
             if (arg == "-s" || arg == "--smoke")     { keys["smoke"] = "1"; continue; }
             if (arg == "-d" || arg == "--diagnose")  { keys["diagnose"] = "1"; continue; }
+            if (arg == "-c" || arg == "--check")     { keys["check"] = "1"; continue; }
+            if (arg == "-p" || arg == "--perf")      { keys["perf"] = "1"; continue; }
             if (arg == "-v" || arg == "--verbose")   { keys["verbose"] = "1"; continue; }
             if (arg == "-m" || arg == "--messages")  { keys["messages"] = "1"; continue; }
+            if (arg == "-b" || arg == "--batch")     { keys["batch"] = "1"; continue; }
+            if (arg == "-t" || arg == "--turbo")     { keys["turbo"] = "1"; continue; }
+
+            // Options with an argument
+            if (arg == "-j" || arg == "--jobs" || arg == "--frames" || arg == "--cycles" ||
+                arg == "--video" || arg == "--audio" || arg == "--size" || arg == "--baseline") {
+
+                if (i + 1 >= argc) throw SyntaxError("Missing argument for '" + arg + "'");
+
+                auto key = arg == "-j" ? "jobs" : arg.substr(2);
+                keys[key] = string(argv[++i]);
+                continue;
+            }
 
             throw SyntaxError("Invalid option '" + arg + "'");
         }
@@ -113,6 +148,48 @@ Headless::parseArguments(int argc, char *argv[])
 void
 Headless::checkArguments()
 {
+    // Numeric arguments must be valid
+    for (auto key : { "jobs", "frames", "cycles" }) {
+
+        if (keys.contains(key)) {
+
+            try { if (std::stoll(keys[key]) < 0) throw std::invalid_argument(""); }
+            catch (...) { throw SyntaxError("Invalid value for '" + string(key) + "'"); }
+        }
+    }
+
+    // The frame size is given as <width>x<height>
+    if (keys.contains("size")) {
+
+        isize width, height;
+        if (!parseSize(keys["size"], width, height)) throw SyntaxError("Invalid value for 'size'");
+    }
+
+    // A baseline is only used by the benchmarks
+    if (keys.contains("baseline") && !keys.contains("perf")) {
+        throw SyntaxError("A baseline requires option 'perf'");
+    }
+
+    // Recordings are made while a script is running
+    if (keys.contains("video") || keys.contains("audio")) {
+
+        if (keys.contains("batch")) throw SyntaxError("Recordings are not supported in batch mode");
+        if (!keys.contains("arg1")) throw SyntaxError("No script is given");
+    }
+
+    // In batch mode, an arbitrary number of files can be specified
+    if (keys.contains("batch")) {
+
+        if (!keys.contains("arg1")) throw SyntaxError("No files are given");
+
+        for (isize i = 1; keys.contains("arg" + std::to_string(i)); i++) {
+
+            auto &file = keys["arg" + std::to_string(i)];
+            if (!utl::fileExists(file)) throw SyntaxError("File " + file + " does not exist");
+        }
+        return;
+    }
+
     // At most one file must be specified
     if (keys.find("arg2") != keys.end()) {
         throw SyntaxError("More than one script file is given");
@@ -127,10 +204,12 @@ Headless::checkArguments()
 
     } else {
 
-        // Either -f, -s, or -d needs to be specified
+        // Either -f, -s, -d, -c, or -p needs to be specified
         if (!keys.contains("footprint") &&
             !keys.contains("smoke") &&
-            !keys.contains("diagnose")) throw SyntaxError("");
+            !keys.contains("diagnose") &&
+            !keys.contains("check") &&
+            !keys.contains("perf")) throw SyntaxError("");
     }
 }
 
@@ -164,13 +243,124 @@ Headless::runScript(const fs::path &path)
     // Redirect shell output to the console in verbose mode
     if (keys.find("verbose") != keys.end()) c64.retroShell.setStream(std::cout);
 
+    // Skip all work that has no effect on the CPU-visible state
+    if (keys.contains("turbo")) {
+
+        c64.set(Opt::C64_SKIP_VIDEO, true);
+        c64.set(Opt::C64_SKIP_AUDIO, true);
+        c64.set(Opt::C64_SKIP_DEBUG, true);
+    }
+
     // Launch the emulator thread
     c64.launch(this, vc64::process);
 
+    // Start recording if requested
+    bool recording = keys.contains("video") || keys.contains("audio");
+    if (recording) startRecording(c64);
+
     // Execute script
     const auto timeout = utl::Time::seconds(500.0);
     c64.retroShell.execScript(path);
     waitForWakeUp(timeout);
+
+    // Wait for the pending frames to be written
+    if (recording) stopRecording(c64);
+}
+
+void
+Headless::startRecording(VirtualC64 &c64)
+{
+    RecorderConfig config = {
+
+        .video = keys.contains("video") ? fs::path(keys["video"]) : fs::path(),
+        .audio = keys.contains("audio") ? fs::path(keys["audio"]) : fs::path(),
+        .format = VideoFormat::RAW,
+        .width = 0,
+        .height = 0,
+        .queueSize = 64
+    };
+
+    if (utl::lowercased(config.video.extension().string()) == ".y4m") {
+        config.format = VideoFormat::Y4M;
+    }
+    if (keys.contains("size")) {
+        parseSize(keys["size"], config.width, config.height);
+    }
+
+    c64.recorder.start(config);
+}
+
+void
+Headless::stopRecording(VirtualC64 &c64)
+{
+    c64.recorder.stop();
+
+    auto stats = c64.recorder.getStats();
+
+    printf("\n");
+    printf("            Frames : %lld\n", stats.frames);
+    printf("           Samples : %lld\n", stats.samples);
+    printf("            Stalls : %lld (%.2f sec)\n", stats.stalls, stats.stalled);
+}
+
+bool
+Headless::parseSize(const string &value, isize &width, isize &height)
+{
+    auto x = value.find('x');
+    if (x == string::npos) return false;
+
+    try {
+
+        width = isize(std::stoll(value.substr(0, x)));
+        height = isize(std::stoll(value.substr(x + 1)));
+
+    } catch (...) { return false; }
+
+    return width > 0 && height > 0 && width <= 8192 && height <= 8192;
+}
+
+void
+Headless::runBatch()
+{
+    BatchConfig config = {
+
+        .workers = keys.contains("jobs") ? isize(std::stoll(keys["jobs"])) : 0,
+        .scheme = ConfigScheme::PAL,
+        .frames = keys.contains("frames") ? i64(std::stoll(keys["frames"])) : 0,
+        .cycles = keys.contains("cycles") ? i64(std::stoll(keys["cycles"])) : 0,
+        .timeout = 600.0,
+        .turbo = keys.contains("turbo")
+    };
+
+    BatchRunner runner(config);
+
+    for (isize i = 1; keys.contains("arg" + std::to_string(i)); i++) {
+        runner.add(keys["arg" + std::to_string(i)]);
+    }
+
+    // Report each job as soon as it has finished
+    runner.onCompletion = [](const BatchResult &result) {
+
+        printf("%3ld %s %10lld frames %8.2f sec %8.2f sec %8.2f MHz %s\n",
+               result.exitCode,
+               result.timedOut ? "TIMEOUT" : result.exhausted ? "BUDGET " : result.failed ? "FAILED " : "       ",
+               result.frames, result.emulated, result.elapsed,
+               result.elapsed > 0.0 ? 1e-6 * double(result.cycles) / result.elapsed : 0.0,
+               result.path.filename().string().c_str());
+    };
+
+    runner.run();
+
+    printf("\n");
+    printf("              Jobs : %zu\n", runner.getResults().size());
+    printf("          Failures : %ld\n", runner.failures());
+    printf("      Budget stops : %ld\n", runner.budgetStops());
+    printf("     Emulated time : %.2f sec\n", runner.emulatedTime());
+    printf("   Wall-clock time : %.2f sec\n", runner.elapsedTime());
+    printf("        Throughput : %.2f emulated sec / sec\n", runner.throughput());
+    printf("    Emulated speed : %.2f MHz per job\n", runner.speed());
+
+    if (runner.failures()) returnCode = 1;
 }
 
 void
@@ -294,6 +484,9 @@ Headless::smokeTestScript[] = {
     "c64 set VSYNC yes",
     "c64 set VSYNC no",
     "c64 set RUN_AHEAD 2",
+    "c64 set SKIP_VIDEO true",
+    "c64 set SKIP_AUDIO true",
+    "c64 set SKIP_DEBUG true",
     "c64 defaults",
     "c64 reset",
     "c64 init PAL",
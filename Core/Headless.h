@@ -57,6 +57,16 @@ private:
     // Runs a RetroShell script
     void runScript(const char **script);
     void runScript(const fs::path &path);
+
+    // Runs all specified files on independent emulator instances
+    void runBatch();
+
+    // Records video and audio while a script is running
+    void startRecording(VirtualC64 &c64);
+    void stopRecording(VirtualC64 &c64);
+
+    // Parses a frame size given as <width>x<height>
+    static bool parseSize(const string &value, isize &width, isize &height);
     
 
     //
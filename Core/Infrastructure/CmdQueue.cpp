@@ -18,33 +18,17 @@ namespace vc64 {
 void
 CmdQueue::put(const Command &cmd)
 {
-    {   SYNCHRONIZED
+    loginfo(CMD_DEBUG, "%s [%llx]\n", CmdEnum::key(cmd.type), cmd.value);
 
-        loginfo(CMD_DEBUG, "%s [%llx]\n", CmdEnum::key(cmd.type), cmd.value);
-
-        if (!queue.isFull()) {
-            queue.write(cmd);
-        } else {
-            logwarn("Command lost: %s [%llx]\n", CmdEnum::key(cmd.type), cmd.value);
-        }
-
-        empty = false;
+    if (!queue.put(cmd)) {
+        logwarn("Command lost: %s [%llx]\n", CmdEnum::key(cmd.type), cmd.value);
     }
 }
 
 bool
 CmdQueue::poll(Command &cmd)
 {
-    if (empty) return false;
-
-    {   SYNCHRONIZED
-
-        cmd = queue.read();
-        empty = queue.isEmpty();
-
-        return true;
-    }
+    return queue.poll(cmd);
 }
 
 }
-
@@ -15,22 +15,15 @@
 
 #include "CmdQueueTypes.h"
 #include "CoreObject.h"
-#include "utl/abilities/Synchronizable.h"
-#include "utl/storage/RingBuffer.h"
-#include <atomic>
+#include "utl/storage/MpscQueue.h"
 
 namespace vc64 {
 
 /// Command queue
-class CmdQueue final : CoreObject, utl::Synchronizable {
+class CmdQueue final : CoreObject {
 
-    /// Ring buffer storing all pending commands
-    utl::RingBuffer <Command, 256> queue;
-
-public:
-    
-    /// Indicates if the queue is empty
-    std::atomic<bool> empty = true;
+    /// Lock-free queue storing all pending commands
+    utl::MpscQueue <Command, 256> queue;
 
     //
     // Methods
@@ -47,10 +40,16 @@ private:
 
 public:
 
-    // Sends a command
+    /// Indicates if the queue is empty
+    bool isEmpty() const { return queue.isEmpty(); }
+
+    /// Returns the number of commands lost due to an overflow
+    i64 dropped() const { return queue.dropped(); }
+
+    // Sends a command (any thread)
     void put(const Command &cmd);
 
-    // Polls a command
+    // Polls a command (emulator thread only)
     bool poll(Command &cmd);
 };
 
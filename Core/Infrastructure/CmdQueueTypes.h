@@ -40,6 +40,7 @@ enum class Cmd : long
     WARP_ON,                ///< Switch on warp mode
     WARP_OFF,               ///< Switch off warp mode
     HALT,                   ///< Terminate the emulator thread
+    REWIND,                 ///< Revert to a recorded frame
 
     // C64
     ALARM_ABS,              ///< Schedule an alarm (absolute cycle)
@@ -137,6 +138,7 @@ struct CmdEnum : Reflectable<CmdEnum, Cmd> {
             case Cmd::WARP_ON:               return "WARP_ON";
             case Cmd::WARP_OFF:              return "WARP_OFF";
             case Cmd::HALT:                  return "HALT";
+            case Cmd::REWIND:                return "REWIND";
 
             case Cmd::ALARM_ABS:             return "ALARM_ABS";
             case Cmd::ALARM_REL:             return "ALARM_REL";
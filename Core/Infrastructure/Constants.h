@@ -53,6 +53,7 @@ static const long PIXELS_PER_LINE       = 504;      ///< 104 + 32 + 320 + 32 + 1
 
 // Vertical parameters
 static const long FIRST_VISIBLE_LINE    = 16;       ///< First line after VBLANK
+static const long LAST_VISIBLE_LINE     = 299;      ///< 16 + 284 - 1
 
 }
 
@@ -92,6 +93,7 @@ static const long PIXELS_PER_LINE       = 520;      ///< 104 + 32 + 320 + 32 + 3
 
 // Vertical parameters
 static const long FIRST_VISIBLE_LINE    = 16;       ///< First line after VBLANK
+static const long LAST_VISIBLE_LINE     = 249;      ///< 16 + 234 - 1 (shortest revision)
 
 }
 
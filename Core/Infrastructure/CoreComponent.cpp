@@ -255,20 +255,20 @@ CoreComponent::reset(bool hard)
 }
 
 isize
-CoreComponent::load(const u8 *buf)
+CoreComponent::load(const u8 *buf, SerFormat format)
 {
     isize result = 0;
 
-    postorderWalk([this, buf, &result](CoreComponent *c) {
+    postorderWalk([this, buf, format, &result](CoreComponent *c) {
 
-        const u8 *ptr = buf + result;
+        SerReader reader(buf + result, format);
 
         // Load the size and checksum for this component
-        auto size = read64(ptr);
-        auto hash = read64(ptr);
+        u64 size; reader << size;
+        u64 hash; reader << hash;
 
         // Load the internal state of this component
-        SerReader reader(ptr); *c << reader;
+        *c << reader;
 
         // Determine the number of loaded bytes
         auto count = u64(reader.ptr - (buf + result));
@@ -297,6 +297,8 @@ CoreComponent::save(u8 *buffer)
 {
     isize result = 0;
 
+    postorderWalk([](CoreComponent *c) { c->_willSave(); });
+
     postorderWalk([this, buffer, &result](CoreComponent *c) {
 
         u8 *ptr = buffer + result;
@@ -329,6 +331,37 @@ CoreComponent::save(u8 *buffer)
     return result;
 }
 
+isize
+CoreComponent::save(std::vector<u8> &buffer)
+{
+    auto start = isize(buffer.size());
+
+    postorderWalk([](CoreComponent *c) { c->_willSave(); });
+
+    {   SerWriter writer(buffer);
+
+        postorderWalk([&writer](CoreComponent *c) {
+
+            auto offset = writer.offset();
+
+            // Save a placeholder for the size and the checksum
+            writer << u64(0) << c->checksum(false);
+
+            // Save the internal state of this component
+            *c << writer;
+
+            // Fill in the number of written bytes
+            writer.patch(offset, u64(writer.offset() - offset));
+        });
+
+        writer.finish();
+    }
+
+    postorderWalk([](CoreComponent *c) { c->_didSave(); });
+
+    return isize(buffer.size()) - start;
+}
+
 std::vector<CoreComponent *>
 CoreComponent::collectComponents()
 {
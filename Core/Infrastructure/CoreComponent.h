@@ -190,11 +190,15 @@ public:
     void softReset() { reset(false); }
 
     // Loads the internal state from a memory buffer
-    isize load(const u8 *buf);
+    isize load(const u8 *buf, SerFormat format);
     virtual void _didLoad() { }
 
-    // Saves the internal state to a memory buffer
+    // Saves the internal state to a memory buffer in the legacy format
     isize save(u8 *buf);
+
+    // Appends the internal state to a memory buffer in the native format
+    isize save(std::vector<u8> &buf);
+    virtual void _willSave() { }
     virtual void _didSave() { }
 
 
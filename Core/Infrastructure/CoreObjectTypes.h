@@ -28,6 +28,7 @@ enum class Category : long
     Layout,
     Properties,
     Registers,
+    Rewind,
     RunAhead,
     Slots,
     State,
@@ -28,6 +28,10 @@ Defaults::Defaults()
     setFallback(Opt::C64_VSYNC,                  false);
     setFallback(Opt::C64_SPEED_BOOST,            100);
     setFallback(Opt::C64_RUN_AHEAD,              0);
+    setFallback(Opt::C64_REWIND,                 0);
+    setFallback(Opt::C64_SKIP_VIDEO,             false);
+    setFallback(Opt::C64_SKIP_AUDIO,             false);
+    setFallback(Opt::C64_SKIP_DEBUG,             false);
 
     setFallback(Opt::DASM_NUMBERS,               (i64)DasmNumbers::HEX0);
     
@@ -70,6 +74,7 @@ Defaults::Defaults()
     setFallback(Opt::USR_DEVICE,                 (i64)UserPortDevice::RS232);
 
     setFallback(Opt::VID_WHITE_NOISE,            true);
+    setFallback(Opt::VID_PALETTED,               false);
 
     setFallback(Opt::MON_PALETTE,                (i64)Palette::COLOR);
     setFallback(Opt::MON_BRIGHTNESS,             50);
@@ -107,6 +112,7 @@ Defaults::Defaults()
     setFallback(Opt::AUD_VOL_R,                  50);
     setFallback(Opt::AUD_BUFFER_SIZE,            4096);
     setFallback(Opt::AUD_ASR,                    true);
+    setFallback(Opt::AUD_PARALLEL,               false);
 
     setFallback(Opt::SID_ENABLE,                 true,                   {0});
     setFallback(Opt::SID_ENABLE,                 false,                  {1, 2, 3});
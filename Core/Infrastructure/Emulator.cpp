@@ -106,6 +106,20 @@ Emulator::_dump(Category category, std::ostream &os) const
         defaults.dump(category, os);
     }
 
+    if (category == Category::Rewind) {
+
+        os << tab("Budget");
+        os << dec(rewinder.getBudget() / 1_MB) << " MB" << std::endl;
+        os << tab("Used");
+        os << dec(rewinder.bytes()) << " bytes" << std::endl;
+        os << tab("Recorded frames");
+        os << dec(rewinder.count()) << std::endl;
+        os << tab("Oldest frame");
+        os << dec(rewinder.oldest()) << std::endl;
+        os << tab("Latest frame");
+        os << dec(rewinder.latest()) << std::endl;
+    }
+
     if (category == Category::RunAhead) {
 
         os << "Primary instance:" << std::endl << std::endl;
@@ -121,6 +135,10 @@ Emulator::_dump(Category category, std::ostream &os) const
 
         os << tab("Clone nr");
         os << dec(stats.clones) << std::endl;
+        os << tab("Cloned bytes");
+        os << dec(stats.cloneBytes) << std::endl;
+        os << tab("Clone time");
+        os << flt(stats.cloneTime * 1000000.0) << " usec" << std::endl;
         os << tab("Frame");
         os << dec(ahead.frame) << std::endl;
         os << tab("Beam");
@@ -231,7 +249,7 @@ Emulator::update()
     shouldWarp() ? warpOn() : warpOff();
 
     // Mark the run-ahead instance dirty when the command queue has entries
-    isDirty |= !cmdQueue.empty;
+    isDirty |= !cmdQueue.isEmpty();
 
     // Process all commands
     main.update(cmdQueue);
@@ -283,12 +301,18 @@ Emulator::computeFrame()
 {
     auto &config = main.getConfig();
 
+    // Adjust the size of the rewind buffer if the user has changed it
+    if (auto budget = config.rewind * 1024 * 1024; budget != rewinder.getBudget()) {
+        rewinder.setBudget(budget);
+    }
+
     if (config.runAhead > 0) {
 
         try {
 
             // Run the main instance
             main.computeFrame();
+            rewinder.record(main);
 
             // Recreate the run-ahead instance if necessary
             if (isDirty || debug::RUA_ON_STEROIDS) recreateRunAheadInstance();
@@ -306,6 +330,7 @@ Emulator::computeFrame()
 
         // Only run the main instance
         main.computeFrame();
+        rewinder.record(main);
     }
 }
 
@@ -321,7 +346,15 @@ Emulator::cloneRunAheadInstance()
     stats.clones++;
 
     // Recreate the runahead instance from scratch
+    utl::Clock clock;
     ahead = main; isDirty = false;
+    stats.cloneTime = clock.stop().asSeconds();
+
+    // Only modified memory pages are copied. Record how much data was moved
+    stats.cloneBytes = ahead.mem.clonedBytes;
+    stats.cloneBytes += ahead.drive8.mem.clonedBytes;
+    stats.cloneBytes += ahead.drive9.mem.clonedBytes;
+    stats.cloneBytes += ahead.expansionport.clonedBytes();
 
     if (debug::RUA_CHECKSUM && ahead != main) {
 
@@ -366,6 +399,15 @@ Emulator::softReset()
     main.softReset();
 }
 
+void
+Emulator::rewind(isize frames)
+{
+    if (rewinder.restore(main, frames) < 0) return;
+
+    markAsDirty();
+    main.msgQueue.put(Msg::SNAPSHOT_RESTORED);
+}
+
 void
 Emulator::stepInto()
 {
@@ -452,6 +494,50 @@ Emulator::getTexture() const
     return main.videoPort.getTexture();
 }
 
+Texture::Rows
+Emulator::getChangedRows(i64 frame) const
+{
+    if (isRunning()) {
+
+        /* In run-ahead mode, the run-ahead instance recomputes frames with
+         * the same number. Hence, frame numbers don't identify textures.
+         */
+        if (main.config.runAhead > 0) {
+            return Texture::Rows().set();
+        }
+
+        // In run-behind mode, compare with a texture from the texture buffer
+        if (main.config.runAhead < 0) {
+            return main.videoPort.getChangedRows(frame, main.config.runAhead);
+        }
+    }
+
+    return main.videoPort.getChangedRows(frame);
+}
+
+const u32 *
+Emulator::getFrame(isize width, isize height)
+{
+    return postProcessor.apply(getTexture(), main.monitor.getConfig(), main.vic.pal(), width, height);
+}
+
+void
+Emulator::startRecording(const RecorderConfig &config)
+{
+    recorder.start(main, config);
+
+    // Recordings are not muted, not even in warp mode
+    main.audioPort.unmute();
+}
+
+void
+Emulator::stopRecording()
+{
+    recorder.stop();
+
+    if (isWarping()) main.audioPort.mute();
+}
+
 /*
 u32 *
 Emulator::oldGetDmaTexture() const
@@ -18,6 +18,10 @@
 #include "Host.h"
 #include "Thread.h"
 #include "CmdQueue.h"
+#include "RewindBuffer.h"
+#include "PostProcessor.h"
+#include "Recorder.h"
+#include "SnapshotWorker.h"
 
 namespace vc64 {
 
@@ -25,6 +29,8 @@ class Emulator : public Thread, public utl::Synchronizable, public Inspectable<E
 
     friend struct API;
     friend struct VirtualC64;
+    friend class Benchmarks;
+    friend class Checks;
 
 public:
 
@@ -42,11 +48,28 @@ private:
     // Indicates if the run-ahead instance needs to be updated
     bool isDirty = true;
 
+    // Recorded states of the main instance
+    RewindBuffer rewinder;
+
     // Incoming external events
     CmdQueue cmdQueue;
 
-    // Texture lock
-    utl::Mutex textureLock;
+    /* Texture lock. The lock is reentrant, because internal consumers
+     * (recorder, snapshots) acquire it, too, and may be invoked by a thread
+     * that already owns it.
+     */
+    utl::ReentrantMutex textureLock;
+
+    // Software renderer for the monitor effects
+    PostProcessor postProcessor;
+
+public:
+
+    // Video and audio recorder
+    Recorder recorder;
+
+    // Background compressor for auto-snapshots
+    SnapshotWorker snapshotWorker;
 
 
     //
@@ -162,6 +185,7 @@ public:
 
     void hardReset();
     void softReset();
+    void rewind(isize frames);
     void stepInto();
     void stepOver();
     void stepCycle();
@@ -175,11 +199,24 @@ public:
 
     const Texture &getTexture() const;
     const Texture &getDmaTexture() const;
+    Texture::Rows getChangedRows(i64 frame) const;
+    const u32 *getFrame(isize width, isize height);
 
     void lockTexture() { textureLock.lock(); }
     void unlockTexture() { textureLock.unlock(); }
 
 
+    //
+    // Recording
+    //
+
+public:
+
+    void startRecording(const RecorderConfig &config);
+    void stopRecording();
+    bool isRecording() const { return recorder.isRecording(); }
+
+
     //
     // Command queue
     //
@@ -333,6 +333,8 @@ typedef struct
     double fps;             ///< Measured frames per seconds
     isize resyncs;          ///< Number of out-of-sync conditions
     isize clones;           ///< Number of created run-ahead instances
+    isize cloneBytes;       ///< Number of bytes copied by the latest clone
+    double cloneTime;       ///< Duration of the latest clone in seconds
 }
 EmulatorStats;
 
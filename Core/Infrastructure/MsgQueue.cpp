@@ -18,32 +18,22 @@ namespace vc64 {
 void
 MsgQueue::setListener(const void *listener, Callback *callback)
 {
-    {   SYNCHRONIZED
+    this->listener = listener;
+    this->callback = callback;
 
-        this->listener = listener;
-        this->callback = callback;
+    // Send all pending messages
+    Message msg;
+    while (queue.poll(msg)) callback(listener, msg);
 
-        // Send all pending messages
-        while (!queue.isEmpty()) {
-
-            Message &msg = queue.read();
-            callback(listener, msg);
-        }
-    }
+    connected.store(true, std::memory_order_release);
 }
 
 bool
 MsgQueue::get(Message &msg)
 {
-    if (!enabled) return false;
-
-    {   SYNCHRONIZED
-
-        if (queue.isEmpty()) return false;
+    if (!enabled || connected.load(std::memory_order_acquire)) return false;
 
-        msg = queue.read();
-        return true;
-    }
+    return queue.poll(msg);
 }
 
 void
@@ -51,27 +41,39 @@ MsgQueue::put(const Message &msg)
 {
     if (enabled) {
 
-        SYNCHRONIZED
-
         loginfo(MSG_DEBUG, "%s [%llx]\n", MsgEnum::key(msg.type), msg.value);
 
-        if (listener) {
-
-            // Send the message immediately if a lister has been registered
-            callback(listener, msg);
+        if (!queue.put(msg)) {
 
-        } else {
-
-            // Otherwise, store it in the ring buffer
-            if (!queue.isFull()) {
-                queue.write(msg);
-            } else {
-                logwarn("Message lost: %s [%llx]\n", MsgEnum::key(msg.type), msg.value);
-            }
+            logwarn("Message lost: %s [%llx]\n", MsgEnum::key(msg.type), msg.value);
+            return;
         }
+
+        // Send the message immediately if a lister has been registered
+        if (connected.load(std::memory_order_acquire)) deliver();
     }
 }
 
+void
+MsgQueue::deliver()
+{
+    // Only proceed if no other thread is delivering messages right now
+    if (undelivered.fetch_add(1, std::memory_order_acq_rel) != 0) return;
+
+    Message batch[16];
+    isize pending = 1;
+
+    do {
+
+        // Drain the queue in batches
+        isize count = queue.poll(batch, std::min(pending, isize(16)));
+        for (isize i = 0; i < count; i++) callback(listener, batch[i]);
+
+        pending = undelivered.fetch_sub(count, std::memory_order_acq_rel) - count;
+
+    } while (pending);
+}
+
 void
 MsgQueue::put(Msg type, i64 payload, i64 payload2)
 {
@@ -14,15 +14,14 @@
 
 #include "MsgQueueTypes.h"
 #include "CoreObject.h"
-#include "utl/abilities/Synchronizable.h"
-#include "utl/storage/RingBuffer.h"
+#include "utl/storage/MpscQueue.h"
 
 namespace vc64 {
 
-class MsgQueue final : CoreObject, utl::Synchronizable {
+class MsgQueue final : CoreObject {
 
-    // Ring buffer storing all pending messages
-    utl::RingBuffer <Message, 512> queue;
+    // Lock-free queue storing all pending messages
+    utl::MpscQueue <Message, 512> queue;
 
     // The registered listener
     const void *listener = nullptr;
@@ -30,6 +29,16 @@ class MsgQueue final : CoreObject, utl::Synchronizable {
     // The registered callback function
     Callback *callback = nullptr;
 
+    // Indicates whether a listener has been registered
+    std::atomic<bool> connected = false;
+
+    /* Number of messages waiting to be delivered to the listener. The thread
+     * that increments this counter from zero delivers all pending messages,
+     * including those sent by other threads in the meantime. This keeps the
+     * callbacks serialized without the need for a lock.
+     */
+    std::atomic<isize> undelivered = 0;
+
     // If disabled, no messages will be stored
     bool enabled = true;
 
@@ -52,13 +61,18 @@ public:
     
 public:
     
-    // Registers a listener together with it's callback function
+    /* Registers a listener together with it's callback function. The function
+     * must be called before any other thread sends messages.
+     */
     void setListener(const void *listener, Callback *func);
 
     // Disables the message queue
     void disable() { enabled = false; }
     
-    // Reads a message
+    // Returns the number of messages lost due to an overflow
+    i64 dropped() const { return queue.dropped(); }
+
+    // Reads a message (only if no listener is registered)
     bool get(Message &msg);
 
     // Sends a message
@@ -67,6 +81,11 @@ public:
     void put(Msg type, CpuMsg payload);
     void put(Msg type, DriveMsg payload);
     void put(Msg type, ScriptMsg payload);
+
+private:
+
+    // Passes all pending messages to the listener
+    void deliver();
 };
 
 }
@@ -38,6 +38,10 @@ OptionParser::create(Opt opt, i64 arg)
         case Opt::C64_VSYNC:                 return boolParser();
         case Opt::C64_SPEED_BOOST:           return numParser("%");
         case Opt::C64_RUN_AHEAD:             return numParser(" frames");
+        case Opt::C64_REWIND:                return numParser(" MB");
+        case Opt::C64_SKIP_VIDEO:            return boolParser();
+        case Opt::C64_SKIP_AUDIO:            return boolParser();
+        case Opt::C64_SKIP_DEBUG:            return boolParser();
 
         case Opt::DASM_NUMBERS:              return enumParser.template operator()<DasmNumbersEnum,DasmNumbers>();
             
@@ -72,6 +76,7 @@ OptionParser::create(Opt opt, i64 arg)
         case Opt::USR_DEVICE:                return enumParser.template operator()<UserPortDeviceEnum,UserPortDevice>();
 
         case Opt::VID_WHITE_NOISE:           return boolParser();
+        case Opt::VID_PALETTED:              return boolParser();
             
         case Opt::MON_PALETTE:               return enumParser.template operator()<PaletteEnum,Palette>();
         case Opt::MON_BRIGHTNESS:            return numParser("%");
@@ -123,6 +128,7 @@ OptionParser::create(Opt opt, i64 arg)
         case Opt::AUD_VOL_R:                 return numParser("%");
         case Opt::AUD_BUFFER_SIZE:           return numParser(" samples");
         case Opt::AUD_ASR:                   return boolParser();
+        case Opt::AUD_PARALLEL:              return boolParser();
 
         case Opt::MEM_INIT_PATTERN:          return enumParser.template operator()<RamPatternEnum,RamPattern>();
         case Opt::MEM_HEATMAP:               return boolParser();
@@ -36,6 +36,10 @@ enum class Opt : long
     C64_VSYNC,              ///< Derive the frame rate to the VSYNC signal
     C64_SPEED_BOOST,        ///< Speed adjustment in percent
     C64_RUN_AHEAD,          ///< Number of run-ahead frames
+    C64_REWIND,             ///< Size of the rewind buffer in MB
+    C64_SKIP_VIDEO,         ///< Skip pixel drawing and texture swaps
+    C64_SKIP_AUDIO,         ///< Skip sample synthesis
+    C64_SKIP_DEBUG,         ///< Skip DMA debugger and heatmap updates
 
     // CPU
     DASM_NUMBERS,           ///< Disassembler number format
@@ -76,6 +80,7 @@ enum class Opt : long
 
     // Video port
     VID_WHITE_NOISE,        ///< Generate white-noise when switched off
+    VID_PALETTED,           ///< Store color indices in the emulator texture
 
     // Monitor
     MON_PALETTE,            ///< Color palette
@@ -135,6 +140,7 @@ enum class Opt : long
     AUD_VOL_R,              ///< Master volume (right channel)
     AUD_BUFFER_SIZE,        ///< Size of the audio ringbuffer
     AUD_ASR,                ///< Adaptive Sample Rate
+    AUD_PARALLEL,           ///< Synthesize multiple SIDs in parallel
 
     // Memory
     MEM_INIT_PATTERN,       ///< Ram initialization pattern
@@ -213,6 +219,10 @@ struct OptEnum : Reflectable<OptEnum, Opt> {
             case Opt::C64_VSYNC:             return "C64.VSYNC";
             case Opt::C64_SPEED_BOOST:       return "C64.SPEED_BOOST";
             case Opt::C64_RUN_AHEAD:         return "C64.RUN_AHEAD";
+            case Opt::C64_REWIND:            return "C64.REWIND";
+            case Opt::C64_SKIP_VIDEO:        return "C64.SKIP_VIDEO";
+            case Opt::C64_SKIP_AUDIO:        return "C64.SKIP_AUDIO";
+            case Opt::C64_SKIP_DEBUG:        return "C64.SKIP_DEBUG";
 
             case Opt::DASM_NUMBERS:          return "CPU.DASM_NUMBERS";
                 
@@ -247,6 +257,7 @@ struct OptEnum : Reflectable<OptEnum, Opt> {
             case Opt::USR_DEVICE:            return "USR.DEVICE";
 
             case Opt::VID_WHITE_NOISE:       return "VID.WHITE_NOISE";
+            case Opt::VID_PALETTED:          return "VID.PALETTED";
 
             case Opt::MON_PALETTE:           return "MON.PALETTE";
             case Opt::MON_BRIGHTNESS:        return "MON.BRIGHTNESS";
@@ -299,6 +310,7 @@ struct OptEnum : Reflectable<OptEnum, Opt> {
             case Opt::AUD_VOL_R:             return "AUD.VOLR";
             case Opt::AUD_BUFFER_SIZE:       return "AUD.BUFFER_SIZE";
             case Opt::AUD_ASR:               return "AUD.ASR";
+            case Opt::AUD_PARALLEL:          return "AUD.PARALLEL";
 
             case Opt::MEM_INIT_PATTERN:      return "MEM.INIT_PATTERN";
             case Opt::MEM_HEATMAP:           return "MEM.HEATMAP";
@@ -365,6 +377,10 @@ struct OptEnum : Reflectable<OptEnum, Opt> {
             case Opt::C64_VSYNC:             return "VSYNC mode";
             case Opt::C64_SPEED_BOOST:      return "Speed adjustment";
             case Opt::C64_RUN_AHEAD:         return "Run-ahead frames";
+            case Opt::C64_REWIND:            return "Rewind buffer size";
+            case Opt::C64_SKIP_VIDEO:        return "Skip drawing";
+            case Opt::C64_SKIP_AUDIO:        return "Skip sound synthesis";
+            case Opt::C64_SKIP_DEBUG:        return "Skip debug overlays";
 
             case Opt::DASM_NUMBERS:          return "Disassembler number format";
                 
@@ -399,6 +415,7 @@ struct OptEnum : Reflectable<OptEnum, Opt> {
             case Opt::USR_DEVICE:            return "User port device";
 
             case Opt::VID_WHITE_NOISE:       return "White noise";
+            case Opt::VID_PALETTED:          return "Paletted texture";
 
             case Opt::MON_PALETTE:           return "Color palette";
             case Opt::MON_BRIGHTNESS:        return "Monitor brightness";
@@ -450,6 +467,7 @@ struct OptEnum : Reflectable<OptEnum, Opt> {
             case Opt::AUD_VOL_R:             return "Master volume (right)";
             case Opt::AUD_BUFFER_SIZE:       return "Audio buffer capacity";
             case Opt::AUD_ASR:               return "Adaptive Sample Rate";
+            case Opt::AUD_PARALLEL:          return "Parallel SID synthesis";
 
             case Opt::MEM_INIT_PATTERN:      return "Memory start-up pattern";
             case Opt::MEM_HEATMAP:           return "Heatmap";
@@ -15,7 +15,10 @@
 #include "BasicTypes.h"
 #include "utl/storage.h"
 #include "utl/abilities/Hashable.h"
+#include <algorithm>
 #include <concepts>
+#include <type_traits>
+#include <vector>
 
 namespace vc64 {
 
@@ -24,6 +27,22 @@ struct Serializable {
     ~Serializable() = default;
 };
 
+/* Serialization formats
+ *
+ * LEGACY: Numbers are widened to 64 bit and stored in big endian byte order.
+ *         Arrays and containers are stored element by element. The size of a
+ *         component is determined by a separate counting pass.
+ *
+ * NATIVE: Numbers are stored in their native width and byte order. Arrays
+ *         and containers of numbers are stored with a single memory
+ *         copy. The target buffer grows while the state is written.
+ */
+enum class SerFormat : u8 { LEGACY = 0, NATIVE = 2 };
+
+// Indicates if an array of T can be stored with a single memory copy
+template <class T> constexpr bool isMemcopyable =
+std::is_arithmetic_v<std::remove_all_extents_t<T>> || std::is_enum_v<std::remove_all_extents_t<T>>;
+
 
 //
 // Basic memory buffer I/O
@@ -372,7 +391,7 @@ public:
 #define DESERIALIZE(type,function) \
 SerReader& operator<<(type& v) \
 { \
-v = (type)function(ptr); \
+if (format == SerFormat::NATIVE) { get(v); } else { v = (type)function(ptr); } \
 return *this; \
 }
 
@@ -387,7 +406,17 @@ public:
 
     const u8 *ptr;
 
-    SerReader(const u8 *p) : ptr(p) { }
+    // Serialization format
+    SerFormat format;
+
+    SerReader(const u8 *p, SerFormat format = SerFormat::LEGACY) : ptr(p), format(format) { }
+
+    // Reads a value in native width and byte order
+    template <class T> void get(T &v)
+    {
+        std::memcpy((void *)&v, (const void *)ptr, sizeof(T));
+        ptr += sizeof(T);
+    }
 
     DESERIALIZE8(bool)
     DESERIALIZE8(char)
@@ -417,6 +446,14 @@ public:
     template <class T, isize N>
     auto& operator<<(utl::Array<T, N> &a)
     {
+        if constexpr (isMemcopyable<T>) {
+            if (format == SerFormat::NATIVE) {
+
+                copy(a.elements, N * sizeof(T));
+                *this << a.w;
+                return *this;
+            }
+        }
         for(isize i = 0; i < N; ++i) *this << a.elements[i];
         *this << a.elements << a.w;
         return *this;
@@ -425,6 +462,15 @@ public:
     template <class T, isize N>
     auto& operator<<(utl::SortedArray<T, N> &a)
     {
+        if constexpr (isMemcopyable<T>) {
+            if (format == SerFormat::NATIVE) {
+
+                copy(a.elements, N * sizeof(T));
+                copy(a.keys, N * sizeof(i64));
+                *this << a.w;
+                return *this;
+            }
+        }
         for(isize i = 0; i < N; ++i) *this << a.elements[i];
         for(isize i = 0; i < N; ++i) *this << a.keys[i];
         *this << a.w;
@@ -434,6 +480,14 @@ public:
     template <class T, isize N>
     auto& operator<<(utl::RingBuffer<T, N> &a)
     {
+        if constexpr (isMemcopyable<T>) {
+            if (format == SerFormat::NATIVE) {
+
+                copy(a.elements, N * sizeof(T));
+                *this << a.r << a.w;
+                return *this;
+            }
+        }
         for(isize i = 0; i < N; ++i) *this << a.elements[i];
         *this << a.r << a.w;
         return *this;
@@ -442,6 +496,15 @@ public:
     template <class T, isize N>
     auto& operator<<(utl::SortedRingBuffer<T, N> &a)
     {
+        if constexpr (isMemcopyable<T>) {
+            if (format == SerFormat::NATIVE) {
+
+                copy(a.elements, N * sizeof(T));
+                copy(a.keys, N * sizeof(i64));
+                *this << a.r << a.w;
+                return *this;
+            }
+        }
         for(isize i = 0; i < N; ++i) *this << a.elements[i];
         for(isize i = 0; i < N; ++i) *this << a.keys[i];
         *this << a.r << a.w;
@@ -473,6 +536,15 @@ public:
         i64 len;
         *this << len;
         v.clear();
+
+        if constexpr (isMemcopyable<T> && !std::is_same_v<T, bool>) {
+            if (format == SerFormat::NATIVE) {
+
+                v.resize(len);
+                copy(v.data(), isize(len * sizeof(T)));
+                return *this;
+            }
+        }
         v.reserve(len);
         for (isize i = 0; i < len; i++) {
             v.push_back(T());
@@ -484,6 +556,13 @@ public:
     template <class T, isize N>
     SerReader& operator<<(T (&v)[N])
     {
+        if constexpr (isMemcopyable<T>) {
+            if (format == SerFormat::NATIVE) {
+
+                copy(v, sizeof(v));
+                return *this;
+            }
+        }
         for(isize i = 0; i < N; ++i) {
             *this << v[i];
         }
@@ -493,7 +572,7 @@ public:
     template <class E, class = std::enable_if_t<std::is_enum<E>{}>>
     SerReader& operator<<(E &v)
     {
-        v = (E)read64(ptr);
+        if (format == SerFormat::NATIVE) { get(v); } else { v = (E)read64(ptr); }
         return *this;
     }
 
@@ -519,7 +598,7 @@ public:
 #define SERIALIZE(type,function,cast) \
 SerWriter& operator<<(type& v) \
 { \
-function(ptr, (cast)v); \
+if (format == SerFormat::NATIVE) { put(v); } else { function(ptr, (cast)v); } \
 return *this; \
 }
 
@@ -530,11 +609,62 @@ return *this; \
 
 class SerWriter
 {
+    // Target buffer (native format only)
+    std::vector<u8> *buffer = nullptr;
+
+    // End of the allocated part of the target buffer
+    u8 *end = nullptr;
+
 public:
 
     u8 *ptr;
 
-    SerWriter(u8 *p) : ptr(p) { }
+    // Serialization format
+    SerFormat format;
+
+    // Creates a writer for the legacy format (the buffer must be large enough)
+    SerWriter(u8 *p) : ptr(p), format(SerFormat::LEGACY) { }
+
+    // Creates a writer for the native format (data is appended to the buffer)
+    SerWriter(std::vector<u8> &buf) : buffer(&buf), format(SerFormat::NATIVE)
+    {
+        auto offset = buf.size();
+        buf.resize(std::max(buf.capacity(), offset + 1));
+        ptr = buf.data() + offset;
+        end = buf.data() + buf.size();
+    }
+
+    // Returns the number of bytes in the target buffer (native format only)
+    isize offset() const { return isize(ptr - buffer->data()); }
+
+    // Shrinks the target buffer to the written data (native format only)
+    void finish() { buffer->resize(usize(offset())); }
+
+    // Overwrites a previously written value (native format only)
+    template <class T> void patch(isize offset, const T &v)
+    {
+        std::memcpy((void *)(buffer->data() + offset), (const void *)&v, sizeof(T));
+    }
+
+    // Makes sure that n more bytes fit into the target buffer
+    void reserve(isize n)
+    {
+        if (buffer && ptr + n > end) {
+
+            auto offset = this->offset();
+            buffer->resize(std::max({ 2 * buffer->size(), usize(offset + n), usize(0x10000) }));
+            ptr = buffer->data() + offset;
+            end = buffer->data() + buffer->size();
+        }
+    }
+
+    // Writes a value in native width and byte order
+    template <class T> void put(const T &v)
+    {
+        reserve(sizeof(T));
+        std::memcpy((void *)ptr, (const void *)&v, sizeof(T));
+        ptr += sizeof(T);
+    }
 
     SERIALIZE8(const bool)
     SERIALIZE8(const char)
@@ -555,6 +685,7 @@ public:
     auto& operator<<(utl::Allocator<T> &a)
     {
         *this << i64(a.size);
+        reserve(a.size);
         a.copy(ptr);
         ptr += a.size;
         return *this;
@@ -563,6 +694,14 @@ public:
     template <class T, isize N>
     auto& operator<<(utl::Array<T, N> &a)
     {
+        if constexpr (isMemcopyable<T>) {
+            if (format == SerFormat::NATIVE) {
+
+                copy(a.elements, N * sizeof(T));
+                *this << a.w;
+                return *this;
+            }
+        }
         for(isize i = 0; i < N; ++i) *this << a.elements[i];
         *this << a.elements << a.w;
         return *this;
@@ -571,6 +710,15 @@ public:
     template <class T, isize N>
     auto& operator<<(utl::SortedArray<T, N> &a)
     {
+        if constexpr (isMemcopyable<T>) {
+            if (format == SerFormat::NATIVE) {
+
+                copy(a.elements, N * sizeof(T));
+                copy(a.keys, N * sizeof(i64));
+                *this << a.w;
+                return *this;
+            }
+        }
         for(isize i = 0; i < N; ++i) *this << a.elements[i];
         for(isize i = 0; i < N; ++i) *this << a.keys[i];
         *this << a.w;
@@ -580,6 +728,14 @@ public:
     template <class T, isize N>
     auto& operator<<(utl::RingBuffer<T, N> &a)
     {
+        if constexpr (isMemcopyable<T>) {
+            if (format == SerFormat::NATIVE) {
+
+                copy(a.elements, N * sizeof(T));
+                *this << a.r << a.w;
+                return *this;
+            }
+        }
         for(isize i = 0; i < N; ++i) *this << a.elements[i];
         *this << a.r << a.w;
         return *this;
@@ -588,6 +744,15 @@ public:
     template <class T, isize N>
     auto& operator<<(utl::SortedRingBuffer<T, N> &a)
     {
+        if constexpr (isMemcopyable<T>) {
+            if (format == SerFormat::NATIVE) {
+
+                copy(a.elements, N * sizeof(T));
+                copy(a.keys, N * sizeof(i64));
+                *this << a.r << a.w;
+                return *this;
+            }
+        }
         for(isize i = 0; i < N; ++i) *this << a.elements[i];
         for(isize i = 0; i < N; ++i) *this << a.keys[i];
         *this << a.r << a.w;
@@ -596,6 +761,7 @@ public:
 
     auto& operator<<(const string &v)
     {
+        reserve(1 + isize(v.length()));
         writeString(ptr, v);
         return *this;
     }
@@ -614,6 +780,14 @@ public:
     {
         auto len = v.size();
         *this << i64(len);
+
+        if constexpr (isMemcopyable<T> && !std::is_same_v<T, bool>) {
+            if (format == SerFormat::NATIVE) {
+
+                copy(v.data(), isize(len * sizeof(T)));
+                return *this;
+            }
+        }
         for (usize i = 0; i < len; i++) {
             *this << v[i];
         }
@@ -623,6 +797,13 @@ public:
     template <class T, isize N>
     SerWriter& operator<<(T (&v)[N])
     {
+        if constexpr (isMemcopyable<T>) {
+            if (format == SerFormat::NATIVE) {
+
+                copy(v, sizeof(v));
+                return *this;
+            }
+        }
         for(isize i = 0; i < N; ++i) {
             *this << v[i];
         }
@@ -632,7 +813,7 @@ public:
     template <class E, class = std::enable_if_t<std::is_enum<E>{}>>
     SerWriter& operator<<(E &v)
     {
-        write64(ptr, (long)v);
+        if (format == SerFormat::NATIVE) { put(v); } else { write64(ptr, (long)v); }
         return *this;
     }
 
@@ -645,6 +826,7 @@ public:
     
     void copy(const void *src, isize n)
     {
+        reserve(n);
         std::memcpy((void *)ptr, src, n);
         ptr += n;
     }
@@ -71,7 +71,7 @@ public:
     void clear() { reset((T)0); }
     
     // Checks if the pipeline is zeroed out
-    bool isClear() {
+    bool isClear() const {
         for (isize i = 0; i < capacity; i++) if (pipeline[i]) return false;
         return true;
     }
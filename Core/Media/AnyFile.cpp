@@ -139,16 +139,30 @@ AnyFile::init(const string &str)
 }
 
 void
-AnyFile::init(const fs::path &path)
+AnyFile::init(const fs::path &path, bool mapped)
 {
     if (!isCompatiblePath(path)) throw IOError(IOError::FILE_TYPE_MISMATCH, path);
-    
-    std::ifstream stream(path, std::ios::binary);
-    if (!stream.is_open()) throw IOError(IOError::FILE_NOT_FOUND, path);
 
-    std::ostringstream sstr(std::ios::binary);
-    sstr << stream.rdbuf();
-    init(sstr.str());
+    if (mapped) {
+
+        // Map the file into memory and parse it in place. Because the mapping
+        // is backed by the file, writeToFile() detaches it before overwriting.
+        if (!data.map(path)) throw IOError(IOError::FILE_NOT_FOUND, path);
+
+    } else {
+
+        // Read the file directly into the data buffer
+        std::error_code ec;
+        auto bytes = fs::file_size(path, ec);
+        if (ec) throw IOError(IOError::FILE_NOT_FOUND, path);
+
+        data.init(path);
+        if (data.empty() && bytes != 0) throw IOError(IOError::FILE_NOT_FOUND, path);
+    }
+
+    if (!isCompatibleBuffer(data)) { data.dealloc(); throw IOError(IOError::FILE_TYPE_MISMATCH); }
+    finalizeRead();
+
     this->path = path;
 }
 
@@ -245,6 +259,10 @@ AnyFile::writeToFile(const std::filesystem::path &path, isize offset, isize len)
         throw IOError(IOError::FILE_IS_DIRECTORY);
     }
 
+    // Detach the data from the file before it gets overwritten
+    std::error_code ec;
+    if (data.isMapped() && fs::equivalent(path, this->path, ec)) data.unmap();
+
     std::ofstream stream(path, std::ofstream::binary);
 
     if (!stream.is_open()) {
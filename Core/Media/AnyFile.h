@@ -96,7 +96,16 @@ public:
     void init(isize capacity);
     void init(const Buffer<u8> &buffer);
     void init(const string &str);
-    void init(const std::filesystem::path &path);
+
+    /* Initializes the file with the contents of a file on disk. By default,
+     * the file is read into memory. If mapped is true, large files are mapped
+     * into memory and parsed in place (see Buffer::map()). Mapping is meant
+     * for short-lived objects in scan jobs, as the data may change if another
+     * process modifies the file, and accessing it raises SIGBUS if the file
+     * is truncated.
+     */
+    void init(const std::filesystem::path &path, bool mapped = false);
+
     void init(const u8 *buf, isize len);
 
     
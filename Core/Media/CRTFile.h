@@ -55,7 +55,7 @@ public:
 
 public:
     
-    CRTFile(const fs::path &path) { init(path); }
+    CRTFile(const fs::path &path, bool mapped = false) { init(path, mapped); }
     CRTFile(const u8 *buf, isize len) { init(buf, len); }
     CRTFile(class ExpansionPort &expansion) { init(expansion); }
 
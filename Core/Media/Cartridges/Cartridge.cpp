@@ -240,16 +240,25 @@ Cartridge::cloneRomAndRam(const Cartridge& other)
     }
 
     // Clone RAM
+    clonedBytes = 0;
+
     if (other.ramCapacity) {
 
-        if (!externalRam) {
+        if (!externalRam || ramCapacity != other.ramCapacity) {
 
+            delete [] externalRam;
             externalRam = new u8[other.ramCapacity];
-            memcpy(externalRam, other.externalRam, ramCapacity);
+            memcpy(externalRam, other.externalRam, other.ramCapacity);
+            clonedBytes = other.ramCapacity;
+
+            ramPages.cover(other.ramCapacity);
+            ramPages.clear();
+            other.ramPages.clear();
 
-        } else if (writes != other.writes) {
+        } else {
 
-            memcpy(externalRam, other.externalRam, ramCapacity);
+            // Only copy the pages that have been modified in either instance
+            clonedBytes = ramPages.sync(externalRam, other.ramPages, other.externalRam, ramCapacity);
         }
     }
 }
@@ -365,7 +374,7 @@ Cartridge::poke(u16 addr, u8 value)
     }
 
     // Write to RAM if we don't run in Ultimax mode
-    if (!c64.getUltimax()) mem.ram[addr] = value;
+    if (!c64.getUltimax()) { mem.ram[addr] = value; mem.ramPages.mark(addr); }
 }
 
 void
@@ -384,6 +393,7 @@ Cartridge::setRamCapacity(isize size)
 
         externalRam = new u8[size];
         ramCapacity = (u64)size;
+        ramPages.cover(size);
         eraseRAM();
     }
 }
@@ -400,6 +410,7 @@ Cartridge::pokeRAM(u32 addr, u8 value)
 {
     assert(isize(addr) < ramCapacity);
     externalRam[addr] = value;
+    ramPages.mark(addr);
     writes++;
 }
 
@@ -409,6 +420,7 @@ Cartridge::eraseRAM(u8 value)
     if (externalRam) {
      
         memset(externalRam, value, ramCapacity);
+        ramPages.markAll();
         writes += ramCapacity;
     }
 }
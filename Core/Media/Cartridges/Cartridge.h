@@ -17,6 +17,7 @@
 #include "CartridgeRom.h"
 #include "CRTFile.h"
 #include "utl/types/Literals.h"
+#include "utl/storage/DirtyMap.h"
 
 namespace vc64 {
 
@@ -110,6 +111,16 @@ private:
     // Total number of write accesses
     i64 writes = 0;
 
+    // Dirty page map (the page size is adjusted to the RAM capacity)
+    mutable utl::DirtyMap<4096> ramPages;
+
+public:
+
+    // Number of bytes copied by the latest assignment
+    isize clonedBytes = 0;
+
+private:
+
 
     //
     // On-board registers
@@ -62,6 +62,7 @@ Cartridge::operator << (SerReader &worker)
         assert(externalRam == nullptr);
         externalRam = new u8[ramCapacity];
         worker.copy(externalRam, ramCapacity);
+        ramPages.cover(ramCapacity);
     }
 }
 
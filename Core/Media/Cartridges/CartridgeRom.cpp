@@ -52,7 +52,7 @@ CartridgeRom::operator << (SerReader &worker)
     rom = new u8[size];
     
     // Read packet data
-    for (int i = 0; i < size; i++) rom[i] = read8(worker.ptr);
+    worker.copy(rom, size);
 }
 
 void
@@ -61,7 +61,7 @@ CartridgeRom::operator << (SerWriter &worker)
     serialize(worker);
     
     // Write packet data
-    for (int i = 0; i < size; i++) write8(worker.ptr, rom[i]);
+    worker.copy(rom, size);
 }
 
 bool
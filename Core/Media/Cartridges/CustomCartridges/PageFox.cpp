@@ -120,6 +120,7 @@ PageFox::pokeRomL(u16 addr, u8 value)
         loginfo(CRT_DEBUG, "pokeRomL(%x, %x)\n", addr, value);
     }
     mem.ram[0x8000 + addr] = value;
+    mem.ramPages.mark(0x8000 + addr);
 }
 
 void
@@ -132,6 +133,7 @@ PageFox::pokeRomH(u16 addr, u8 value)
         loginfo(CRT_DEBUG, "pokeRomH(%x, %x)\n", addr, value);
     }
     mem.ram[0xA000 + addr] = value;
+    mem.ramPages.mark(0xA000 + addr);
 }
 
 u8
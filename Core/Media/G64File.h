@@ -36,7 +36,7 @@ public:
     
     G64File() { };
     G64File(isize capacity);
-    G64File(const fs::path &path) { init(path); }
+    G64File(const fs::path &path, bool mapped = false) { init(path, mapped); }
     G64File(const u8 *buf, isize len) { init(buf, len); }
     G64File(class FloppyDisk &disk) { init(disk); }
 
@@ -14,6 +14,7 @@
 #include "Snapshot.h"
 #include "MediaError.h"
 #include "C64.h"
+#include "Emulator.h"
 
 namespace vc64 {
 
@@ -32,21 +33,32 @@ Thumbnail::take(const C64 &c64, isize dx, isize dy)
     isize xStart = PAL::FIRST_VISIBLE_PIXEL;
     isize yStart = PAL::FIRST_VISIBLE_LINE;
 
-    width = i32(PAL::VISIBLE_PIXELS / dx);
-    height = i32(c64.vic.numVisibleLines() / dy);
+    c64.emulator.lockTexture();
 
-    u32 *target = screen;
-    u32 *source = (u32 *)c64.videoPort.getTexture().pixels.ptr; // oldGetTexture();
+    auto *source = (u32 *)c64.videoPort.getTexture().pixels.ptr; // oldGetTexture();
     source += xStart + yStart * Texture::width;
 
+    take(source, Texture::width, PAL::VISIBLE_PIXELS, c64.vic.numVisibleLines(), dx, dy);
+
+    c64.emulator.unlockTexture();
+}
+
+void
+Thumbnail::take(const u32 *source, isize pitch, isize w, isize h, isize dx, isize dy)
+{
+    width = i32(w / dx);
+    height = i32(h / dy);
+
+    u32 *target = screen;
+
     for (isize y = 0; y < height; y++) {
         for (isize x = 0; x < width; x++) {
             target[x] = source[x * dx];
         }
-        source += Texture::width * dy;
+        source += pitch * dy;
         target += width;
     }
-    
+
     timestamp = time(nullptr);
 }
 
@@ -71,6 +83,43 @@ Snapshot::isCompatible(const Buffer<u8> &buf)
 }
 
 Snapshot::Snapshot(isize capacity)
+{
+    alloc(capacity);
+}
+
+Snapshot::Snapshot(C64 &c64, SerFormat format)
+{
+    if (debug::SNP_DEBUG) c64.dump(Category::State);
+
+    if (format == SerFormat::LEGACY) {
+
+        // Determine the size of the state first and serialize it afterwards
+        alloc(c64.size());
+        c64.save(getSnapshotData());
+
+    } else {
+
+        // Serialize the state in a single pass
+        std::vector<u8> state;
+        c64.save(state);
+        adopt(state);
+    }
+
+    takeScreenshot(c64);
+}
+
+Snapshot::Snapshot(C64 &c64, Compressor compressor) : Snapshot(c64)
+{
+    compress(compressor);
+}
+
+Snapshot::Snapshot(const std::vector<u8> &state)
+{
+    adopt(state);
+}
+
+void
+Snapshot::alloc(isize capacity)
 {
     init(capacity + sizeof(SnapshotHeader));
 
@@ -87,17 +136,15 @@ Snapshot::Snapshot(isize capacity)
     header->rawSize = i32(data.size);
 }
 
-Snapshot::Snapshot(C64 &c64) : Snapshot(c64.size())
+void
+Snapshot::adopt(const std::vector<u8> &state)
 {
-    takeScreenshot(c64);
+    alloc(isize(state.size()));
+    std::memcpy(getSnapshotData(), state.data(), state.size());
 
-    if (debug::SNP_DEBUG) c64.dump(Category::State);
-    c64.save(getSnapshotData());
-}
-
-Snapshot::Snapshot(C64 &c64, Compressor compressor) : Snapshot(c64)
-{
-    compress(compressor);
+    getHeader()->format = u8(SerFormat::NATIVE);
+    getHeader()->byteOrder = 0x0102;
+    getHeader()->wordSize = u8(sizeof(long));
 }
 
 void
@@ -110,6 +157,26 @@ Snapshot::finalizeRead()
     if (isTooOld()) throw MediaError(MediaError::SNAP_TOO_OLD);
     if (isTooNew()) throw MediaError(MediaError::SNAP_TOO_NEW);
     if (isBeta() && !betaRelease) throw MediaError(MediaError::SNAP_IS_BETA);
+
+    // Check the serialization format
+    switch (format()) {
+
+        case SerFormat::LEGACY:
+
+            break;
+
+        case SerFormat::NATIVE:
+
+            // Snapshots in the native format can't be exchanged across byte orders
+            if (getHeader()->byteOrder != 0x0102) throw MediaError(MediaError::SNAP_CORRUPTED);
+
+            // Nor across data models with different sizes of long (LP64 vs. LLP64)
+            if (getHeader()->wordSize != sizeof(long)) throw MediaError(MediaError::SNAP_CORRUPTED);
+            break;
+
+        default:
+            throw MediaError(MediaError::SNAP_TOO_NEW);
+    }
 }
 
 std::pair <isize,isize> 
@@ -195,11 +262,13 @@ Snapshot::compress(Compressor compressor)
             
             switch (compressor) {
                     
-                case Compressor::NONE:  break;
-                case Compressor::GZIP:  data.gzip(sizeof(SnapshotHeader)); break;
-                case Compressor::LZ4:   data.lz4 (sizeof(SnapshotHeader)); break;
-                case Compressor::RLE2:  data.rle2(sizeof(SnapshotHeader)); break;
-                case Compressor::RLE3:  data.rle3(sizeof(SnapshotHeader)); break;
+                case Compressor::NONE:    break;
+                case Compressor::GZIP:    data.gzip(sizeof(SnapshotHeader)); break;
+                case Compressor::LZ4:     data.lz4 (sizeof(SnapshotHeader)); break;
+                case Compressor::RLE2:    data.rle2(sizeof(SnapshotHeader)); break;
+                case Compressor::RLE3:    data.rle3(sizeof(SnapshotHeader)); break;
+                case Compressor::ZSTD:    data.zstd(sizeof(SnapshotHeader)); break;
+                case Compressor::CHUNKED: data.chunk(sizeof(SnapshotHeader)); break;
             }
             
             getHeader()->compressor = u8(compressor);
@@ -234,11 +303,13 @@ Snapshot::uncompress()
         
             switch (compressor()) {
                     
-                case Compressor::NONE:  break;
-                case Compressor::GZIP:  data.gunzip(sizeof(SnapshotHeader), expectedSize); break;
-                case Compressor::LZ4:   data.unlz4 (sizeof(SnapshotHeader), expectedSize); break;
-                case Compressor::RLE2:  data.unrle2(sizeof(SnapshotHeader), expectedSize); break;
-                case Compressor::RLE3:  data.unrle3(sizeof(SnapshotHeader), expectedSize); break;
+                case Compressor::NONE:    break;
+                case Compressor::GZIP:    data.gunzip(sizeof(SnapshotHeader), expectedSize); break;
+                case Compressor::LZ4:     data.unlz4 (sizeof(SnapshotHeader), expectedSize); break;
+                case Compressor::RLE2:    data.unrle2(sizeof(SnapshotHeader), expectedSize); break;
+                case Compressor::RLE3:    data.unrle3(sizeof(SnapshotHeader), expectedSize); break;
+                case Compressor::ZSTD:    data.unzstd(sizeof(SnapshotHeader), expectedSize); break;
+                case Compressor::CHUNKED: data.unchunk(sizeof(SnapshotHeader), expectedSize); break;
             }
             
             getHeader()->compressor = u8(Compressor::NONE);
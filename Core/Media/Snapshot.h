@@ -14,6 +14,7 @@
 
 #include "AnyFile.h"
 #include "Constants.h"
+#include "Serializable.h"
 #include "Texture.h"
 
 namespace vc64 {
@@ -36,6 +37,9 @@ struct Thumbnail {
     
     // Takes a screenshot from the current texture
     void take(const C64 &c64, isize dx = 1, isize dy = 1);
+
+    // Takes a screenshot from a copy of the visible texture area
+    void take(const u32 *source, isize pitch, isize w, isize h, isize dx = 1, isize dy = 1);
 };
 
 struct SnapshotHeader {
@@ -55,6 +59,13 @@ struct SnapshotHeader {
     // Applied compression method
     u8 compressor;
 
+    /* Serialization format, byte order mark, and word size (sizeof(long)).
+     * All three fields are zero in snapshots of the legacy format.
+     */
+    u8 format;
+    u16 byteOrder;
+    u8 wordSize;
+
     // Preview image
     Thumbnail screenshot;
 };
@@ -80,8 +91,10 @@ public:
     Snapshot(const fs::path &path) { init(path); }
     Snapshot(const u8 *buf, isize len) { init(buf, len); }
     Snapshot(isize capacity);
-    Snapshot(C64 &c64);
+    Snapshot(C64 &c64) : Snapshot(c64, SerFormat::NATIVE) { }
+    Snapshot(C64 &c64, SerFormat format);
     Snapshot(C64 &c64, Compressor compressor);
+    Snapshot(const std::vector<u8> &state);
 
 
     //
@@ -124,9 +137,22 @@ public:
     // Returns pointer to the core data
     u8 *getSnapshotData() const { return data.ptr + sizeof(SnapshotHeader); }
 
+    // Returns the format of the core data
+    SerFormat format() const { return SerFormat(getHeader()->format); }
+
     // Records a screenshot
     void takeScreenshot(C64 &c64);
 
+private:
+
+    // Allocates memory for the header and the core data and sets up the header
+    void alloc(isize capacity);
+
+    // Sets up the snapshot with a state in native format
+    void adopt(const std::vector<u8> &state);
+
+public:
+
 
     //
     // Compressing
@@ -36,7 +36,7 @@ public:
     // Initializing
     //
     
-    TAPFile(const fs::path &path) { init(path); }
+    TAPFile(const fs::path &path, bool mapped = false) { init(path, mapped); }
     TAPFile(const u8 *buf, isize len) { init(buf, len); }
 
     
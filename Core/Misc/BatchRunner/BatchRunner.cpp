@@ -0,0 +1,270 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "BatchRunner.h"
+#include "VirtualC64.h"
+#include "utl/abilities/Wakeable.h"
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+namespace vc64 {
+
+namespace {
+
+// Bookkeeping for a single running job (lives in the worker thread)
+struct Job : utl::Wakeable {
+
+    std::atomic<bool> done = false;
+    std::atomic<isize> exitCode = 0;
+    std::atomic<bool> failed = false;
+    std::atomic<bool> exhausted = false;
+
+    void finish(isize code, bool error = false, bool budget = false) {
+
+        if (done.exchange(true)) return;
+        exitCode = code;
+        failed = error;
+        exhausted = budget;
+        wakeUp();
+    }
+};
+
+void
+process(const void *listener, Message msg)
+{
+    auto *job = (Job *)listener;
+
+    switch (msg.type) {
+
+        case Msg::ABORT:        job->finish(isize(msg.value), false, msg.value2 != 0); break;
+        case Msg::RSH_ERROR:    job->finish(1, true); break;
+        case Msg::CPU_JAMMED:   job->finish(1, true); break;
+
+        default:
+            break;
+    }
+}
+
+}
+
+void
+BatchRunner::run()
+{
+    auto count = isize(jobs.size());
+    auto workers = config.workers ? config.workers : isize(std::thread::hardware_concurrency());
+    workers = std::clamp(workers, isize(1), std::max(count, isize(1)));
+
+    results.assign(jobs.size(), BatchResult { });
+    for (isize i = 0; i < count; i++) results[i].path = jobs[i];
+
+    // Distribute the jobs round-robin among the worker queues
+    queues.clear();
+    for (isize i = 0; i < workers; i++) queues.push_back(std::make_unique<Queue>());
+    for (isize i = 0; i < count; i++) queues[i % workers]->jobs.push_back(i);
+
+    auto start = utl::Time::now();
+
+    // Launch the workers and wait for them to finish
+    std::vector<std::thread> threads;
+    for (isize i = 0; i < workers; i++) threads.emplace_back(&BatchRunner::work, this, i);
+    for (auto &thread : threads) thread.join();
+
+    elapsed = utl::Time::now() - start;
+}
+
+isize
+BatchRunner::failures() const
+{
+    isize result = 0;
+    for (auto &it : results) if (it.exitCode != 0 && !it.exhausted) result++;
+    return result;
+}
+
+isize
+BatchRunner::budgetStops() const
+{
+    isize result = 0;
+    for (auto &it : results) if (it.exhausted) result++;
+    return result;
+}
+
+double
+BatchRunner::emulatedTime() const
+{
+    double result = 0.0;
+    for (auto &it : results) result += it.emulated;
+    return result;
+}
+
+double
+BatchRunner::throughput() const
+{
+    auto wall = elapsedTime();
+    return wall > 0.0 ? emulatedTime() / wall : 0.0;
+}
+
+double
+BatchRunner::speed() const
+{
+    double cycles = 0.0, elapsed = 0.0;
+
+    for (auto &it : results) {
+
+        cycles += double(it.cycles);
+        elapsed += it.elapsed;
+    }
+    return elapsed > 0.0 ? 1e-6 * cycles / elapsed : 0.0;
+}
+
+void
+BatchRunner::work(isize nr)
+{
+    while (auto job = fetch(nr)) execute(*job);
+}
+
+std::optional<isize>
+BatchRunner::fetch(isize nr)
+{
+    auto workers = isize(queues.size());
+
+    // Take the next job from the front of the worker's own queue
+    {   auto &own = *queues[nr];
+        std::lock_guard<std::mutex> guard(own.mutex);
+
+        if (!own.jobs.empty()) {
+
+            auto result = own.jobs.front();
+            own.jobs.pop_front();
+            return result;
+        }
+    }
+
+    // Steal a job from the back of another queue
+    for (isize i = 1; i < workers; i++) {
+
+        auto &victim = *queues[(nr + i) % workers];
+        std::lock_guard<std::mutex> guard(victim.mutex);
+
+        if (!victim.jobs.empty()) {
+
+            auto result = victim.jobs.back();
+            victim.jobs.pop_back();
+            return result;
+        }
+    }
+
+    return { };
+}
+
+void
+BatchRunner::execute(isize nr)
+{
+    auto &result = results[nr];
+    auto &path = result.path;
+    auto start = utl::Time::now();
+
+    try {
+
+        Job job;
+        VirtualC64 emu;
+
+        // Connect the message listener and launch the emulator thread
+        emu.launch(&job, process);
+
+        // Fall back to the MEGA65 OpenROMs if no Roms are installed
+        try { emu.isReady(); } catch (...) { emu.c64.installOpenRoms(); }
+
+        // Determine the machine's frame geometry to translate the frame budget
+        emu.set(config.scheme);
+        auto cycles = budget(emu.vicii.getTraits().cyclesPerFrame);
+
+        // Skip all work that has no effect on the CPU-visible state
+        if (config.turbo) {
+
+            emu.set(Opt::C64_SKIP_VIDEO, true);
+            emu.set(Opt::C64_SKIP_AUDIO, true);
+            emu.set(Opt::C64_SKIP_DEBUG, true);
+        }
+
+        // Setup the job
+        auto ext = utl::lowercased(path.extension().string());
+        if (ext == ".retrosh" || ext == ".ini") {
+
+            emu.retroShell.execScript(path);
+
+        } else {
+
+            std::stringstream ss;
+
+            ss << "regression setup " << ConfigSchemeEnum::key(config.scheme) << "\n";
+            ss << "regression set DEBUGCART true\n";
+            if (cycles) ss << "regression set WATCHDOG " << cycles << "\n";
+            ss << "regression run \"" << path.string() << "\"\n";
+
+            emu.retroShell.execScript(ss);
+        }
+
+        // Wait until the job has finished
+        job.waitForWakeUp(utl::Time::seconds(config.timeout));
+
+        if (!job.done) {
+
+            result.timedOut = true;
+            job.finish(1, true);
+        }
+
+        // Record statistics
+        emu.suspend();
+
+        auto &info = emu.c64.getInfo();
+        auto freq = emu.vicii.getTraits().frequency;
+
+        result.frames = info.frame;
+        result.cycles = info.cpuProgress;
+        result.emulated = freq ? double(info.cpuProgress) / double(freq) : 0.0;
+
+        emu.resume();
+
+        result.exitCode = job.exitCode;
+        result.failed = job.failed;
+        result.exhausted = job.exhausted;
+        if (result.timedOut) result.error = "Timeout";
+
+    } catch (std::exception &e) {
+
+        result.exitCode = 1;
+        result.failed = true;
+        result.error = e.what();
+    }
+
+    result.elapsed = (utl::Time::now() - start).asSeconds();
+
+    if (onCompletion) {
+
+        std::lock_guard<std::mutex> guard(reportLock);
+        onCompletion(result);
+    }
+}
+
+Cycle
+BatchRunner::budget(i64 cyclesPerFrame) const
+{
+    auto byFrames = config.frames * cyclesPerFrame;
+    auto byCycles = config.cycles;
+
+    if (byFrames && byCycles) return std::min(byFrames, byCycles);
+    return byFrames ? byFrames : byCycles;
+}
+
+}
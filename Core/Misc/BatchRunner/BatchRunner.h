@@ -0,0 +1,128 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "BatchRunnerTypes.h"
+#include "utl/chrono.h"
+#include <deque>
+#include <functional>
+#include <mutex>
+
+namespace vc64 {
+
+/** Runs many independent emulator instances in parallel.
+ *
+ *  Each job is executed on a fully isolated VirtualC64 instance which runs
+ *  in warp mode until the debugcart is written, the watchdog fires, or the
+ *  RetroShell reports an error. A job stopped by the watchdog has used up its
+ *  frame or cycle budget. It is reported as a budget stop, not as a failure.
+ *  The jobs are distributed among a pool of worker threads. Each worker owns
+ *  a queue of pending jobs and steals jobs from the other queues once its own
+ *  queue has run dry.
+ *
+ *  A job is either a media file which is flashed into memory and started via
+ *  'run', or a RetroShell script (.retrosh or .ini). Scripts are responsible
+ *  for setting up the machine by themselves.
+ */
+class BatchRunner {
+
+    // Worker queue
+    struct Queue { std::mutex mutex; std::deque<isize> jobs; };
+
+    // The current configuration
+    BatchConfig config = {
+
+        .workers = 0,
+        .scheme = ConfigScheme::PAL,
+        .frames = 0,
+        .cycles = 0,
+        .timeout = 600.0,
+        .turbo = false
+    };
+
+    // Pending jobs
+    std::vector<fs::path> jobs;
+
+    // Execution results (one per job)
+    std::vector<BatchResult> results;
+
+    // One job queue per worker
+    std::vector<std::unique_ptr<Queue>> queues;
+
+    // Total wall-clock time of the latest run
+    utl::Time elapsed;
+
+    // Serializes the invocation of the progress callback
+    std::mutex reportLock;
+
+public:
+
+    // Called after a job has been completed (may be empty)
+    std::function<void(const BatchResult &)> onCompletion;
+
+
+    //
+    // Methods
+    //
+
+public:
+
+    BatchRunner() { };
+    BatchRunner(const BatchConfig &config) : config(config) { };
+
+    const BatchConfig &getConfig() const { return config; }
+    void setConfig(const BatchConfig &value) { config = value; }
+
+    // Adds a job
+    void add(const fs::path &path) { jobs.push_back(path); }
+
+    // Executes all jobs and blocks until all of them have finished
+    void run();
+
+    // Returns the results of the latest run (in the order the jobs were added)
+    const std::vector<BatchResult> &getResults() const { return results; }
+
+    // Returns the number of jobs with a non-zero return code (budget stops excluded)
+    isize failures() const;
+
+    // Returns the number of jobs that have been stopped by the watchdog
+    isize budgetStops() const;
+
+    // Returns the accumulated emulated time in seconds
+    double emulatedTime() const;
+
+    // Returns the wall-clock time of the latest run in seconds
+    double elapsedTime() const { return elapsed.asSeconds(); }
+
+    // Returns the throughput in emulated seconds per wall-clock second
+    double throughput() const;
+
+    // Returns the average emulation speed of a single job in MHz
+    double speed() const;
+
+private:
+
+    // Main entry point of a worker thread
+    void work(isize nr);
+
+    // Takes a job from the worker's own queue or steals one from another queue
+    std::optional<isize> fetch(isize nr);
+
+    // Executes a single job
+    void execute(isize nr);
+
+    // Returns the number of cycles the job is allowed to run
+    Cycle budget(i64 cyclesPerFrame) const;
+};
+
+}
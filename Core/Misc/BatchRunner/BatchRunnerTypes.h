@@ -0,0 +1,71 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+/// @file
+
+#pragma once
+
+#include "BasicTypes.h"
+#include "C64Types.h"
+
+namespace vc64 {
+
+//
+// Structures
+//
+
+typedef struct
+{
+    // Number of worker threads (0 = one per hardware thread)
+    isize workers;
+
+    // Machine model each instance is initialized with
+    ConfigScheme scheme;
+
+    // Execution budget (0 = no limit). The stricter budget wins.
+    i64 frames;
+    i64 cycles;
+
+    // Wall-clock timeout per job in seconds
+    double timeout;
+
+    // Skips drawing, sound synthesis, and debug overlays
+    bool turbo;
+}
+BatchConfig;
+
+typedef struct
+{
+    // The executed media file or RetroShell script
+    fs::path path;
+
+    // Return code (debugcart value, 1 on watchdog or error)
+    isize exitCode;
+
+    // Indicates if the job has been stopped by the wall-clock timeout
+    bool timedOut;
+
+    // Indicates if the job has been stopped by the watchdog (budget used up)
+    bool exhausted;
+
+    // Indicates if the job has failed with an error message
+    bool failed;
+    string error;
+
+    // Execution statistics
+    i64 frames;
+    Cycle cycles;
+    double emulated;
+    double elapsed;
+}
+BatchResult;
+
+}
@@ -0,0 +1,316 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "Recorder.h"
+#include "C64.h"
+#include "Emulator.h"
+#include "utl/chrono.h"
+#include <algorithm>
+#include <cstring>
+
+namespace vc64 {
+
+namespace {
+
+void
+writeU16(std::ostream &os, u16 value)
+{
+    os.put(char(value & 0xFF));
+    os.put(char(value >> 8));
+}
+
+void
+writeU32(std::ostream &os, u32 value)
+{
+    writeU16(os, u16(value & 0xFFFF));
+    writeU16(os, u16(value >> 16));
+}
+
+void
+writeU64(std::ostream &os, u64 value)
+{
+    writeU32(os, u32(value & 0xFFFFFFFF));
+    writeU32(os, u32(value >> 32));
+}
+
+}
+
+Recorder::~Recorder()
+{
+    stop();
+}
+
+RecorderStats
+Recorder::getStats()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+void
+Recorder::start(const C64 &c64, const RecorderConfig &config)
+{
+    stop();
+
+    this->config = config;
+
+    // Determine the recorded texture area
+    auto area = Texture::visibleArea(c64.vic.pal());
+    x1 = area.x1;
+    y1 = area.y1;
+    width = area.width();
+    height = area.height();
+
+    // Frames with monitor effects have a custom size
+    if (config.width > 0 && config.height > 0) {
+
+        width = config.width;
+        height = config.height;
+    }
+
+    // Open the output files
+    if (!config.video.empty()) {
+
+        video.open(config.video, std::ios::binary | std::ios::trunc);
+        if (!video.is_open()) throw IOError(IOError::FILE_CANT_CREATE, config.video);
+    }
+    if (!config.audio.empty()) {
+
+        audio.open(config.audio, std::ios::binary | std::ios::trunc);
+        if (!audio.is_open()) {
+
+            video.close();
+            throw IOError(IOError::FILE_CANT_CREATE, config.audio);
+        }
+    }
+    writeHeader(c64);
+
+    stats = { };
+
+    // Launch the pipeline thread
+    queue.start(config.queueSize, [this](Slot &slot) {
+
+        write(slot);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        stats.frames++;
+        stats.samples += isize(slot.samples.size());
+    });
+    recording = true;
+}
+
+void
+Recorder::stop()
+{
+    if (!recording) return;
+    recording = false;
+
+    // Wait until all pending frames are written
+    queue.stop();
+
+    updateWavHeader();
+    video.close();
+    audio.close();
+}
+
+void
+Recorder::capture(const C64 &c64)
+{
+    utl::Clock clock;
+    bool stall = queue.isFull();
+
+    // If the queue is full, wait for the pipeline to catch up
+    auto &slot = queue.acquire();
+
+    if (stall) {
+
+        std::lock_guard<std::mutex> lock(mutex);
+        stats.stalls++;
+        stats.stalled += clock.stop().asSeconds();
+    }
+
+    c64.emulator.lockTexture();
+    auto &texture = c64.videoPort.getTexture();
+    std::memcpy(slot.texture.pixels.ptr, texture.pixels.ptr, Texture::texels * sizeof(u32));
+    slot.texture.nr = texture.nr;
+    c64.emulator.unlockTexture();
+    slot.monitor = c64.monitor.getConfig();
+    slot.pal = c64.vic.pal();
+
+    if (audio.is_open()) c64.audioPort.copyLatest(slot.samples);
+
+    // Hand the slot over to the pipeline thread
+    queue.commit();
+}
+
+void
+Recorder::write(const Slot &slot)
+{
+    if (video.is_open()) writeVideo(slot);
+    if (audio.is_open()) writeAudio(slot);
+}
+
+void
+Recorder::writeVideo(const Slot &slot)
+{
+    const u32 *src;
+    isize pitch;
+
+    if (config.width > 0 && config.height > 0) {
+
+        src = postProcessor.apply(slot.texture, slot.monitor, slot.pal, width, height);
+        pitch = width;
+
+    } else {
+
+        src = slot.texture.pixels.ptr + y1 * Texture::width + x1;
+        pitch = Texture::width;
+    }
+
+    switch (config.format) {
+
+        case VideoFormat::RAW:
+
+            // Texels are stored as RGBA bytes
+            for (isize y = 0; y < height; y++) {
+                video.write((const char *)(src + y * pitch), width * sizeof(u32));
+            }
+            break;
+
+        case VideoFormat::Y4M:
+        {
+            // Convert to YCbCr (ITU-R BT.601, studio swing)
+            planes.resize(3 * width * height);
+            auto *py = planes.data();
+            auto *pu = py + width * height;
+            auto *pv = pu + width * height;
+
+            for (isize y = 0; y < height; y++) {
+
+                auto *row = src + y * pitch;
+
+                for (isize x = 0; x < width; x++) {
+
+                    auto texel = row[x];
+                    i32 R = texel & 0xFF;
+                    i32 G = (texel >> 8) & 0xFF;
+                    i32 B = (texel >> 16) & 0xFF;
+
+                    *py++ = u8(((66 * R + 129 * G + 25 * B + 128) >> 8) + 16);
+                    *pu++ = u8(((-38 * R - 74 * G + 112 * B + 128) >> 8) + 128);
+                    *pv++ = u8(((112 * R - 94 * G - 18 * B + 128) >> 8) + 128);
+                }
+            }
+
+            video << "FRAME\n";
+            video.write((const char *)planes.data(), planes.size());
+            break;
+        }
+    }
+}
+
+void
+Recorder::writeAudio(const Slot &slot)
+{
+    auto n = isize(slot.samples.size());
+    pcm.resize(2 * n);
+
+    // Convert to signed 16 bit integers
+    auto convert = [](float s) { return i16(std::lround(std::clamp(s, -1.0f, 1.0f) * 32767.0f)); };
+
+    for (isize i = 0; i < n; i++) {
+
+        pcm[2 * i]     = convert(slot.samples[i].l);
+        pcm[2 * i + 1] = convert(slot.samples[i].r);
+    }
+
+    audio.write((const char *)pcm.data(), pcm.size() * sizeof(i16));
+}
+
+void
+Recorder::writeHeader(const C64 &c64)
+{
+    if (video.is_open() && config.format == VideoFormat::Y4M) {
+
+        // The frame rate is given as a fraction (clock frequency / cycles per frame)
+        video << "YUV4MPEG2";
+        video << " W" << width << " H" << height;
+        video << " F" << c64.vic.getFrequency() << ":" << c64.vic.getCyclesPerFrame();
+        video << " Ip A1:1 C444\n";
+    }
+
+    if (audio.is_open()) {
+
+        auto rate = u32(std::lround(c64.audioPort.getSampleRate()));
+
+        // RIFF header with preliminary sizes (updated in updateWavHeader())
+        audio.write("RIFF", 4);
+        writeU32(audio, 72);
+        audio.write("WAVE", 4);
+
+        // Placeholder for the ds64 chunk of an RF64 file (EBU Tech 3306)
+        audio.write("JUNK", 4);
+        writeU32(audio, 28);
+        for (isize i = 0; i < 28; i++) audio.put(0);
+
+        // Format chunk (16 bit PCM, stereo)
+        audio.write("fmt ", 4);
+        writeU32(audio, 16);
+        writeU16(audio, 1);
+        writeU16(audio, 2);
+        writeU32(audio, rate);
+        writeU32(audio, rate * 4);
+        writeU16(audio, 4);
+        writeU16(audio, 16);
+
+        // Data chunk
+        audio.write("data", 4);
+        writeU32(audio, 0);
+    }
+}
+
+void
+Recorder::updateWavHeader()
+{
+    if (audio.is_open()) {
+
+        auto bytes = u64(stats.samples) * 4;
+        auto riff = bytes + 72;
+
+        if (riff <= 0xFFFFFFFF) {
+
+            audio.seekp(4);
+            writeU32(audio, u32(riff));
+            audio.seekp(76);
+            writeU32(audio, u32(bytes));
+
+        } else {
+
+            // Files exceeding 4 GB are written in RF64 format with 64 bit sizes
+            audio.seekp(0);
+            audio.write("RF64", 4);
+            writeU32(audio, 0xFFFFFFFF);
+            audio.seekp(12);
+            audio.write("ds64", 4);
+            writeU32(audio, 28);
+            writeU64(audio, riff);
+            writeU64(audio, bytes);
+            writeU64(audio, u64(stats.samples));
+            writeU32(audio, 0);
+            audio.seekp(76);
+            writeU32(audio, 0xFFFFFFFF);
+        }
+    }
+}
+
+}
@@ -0,0 +1,122 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "RecorderTypes.h"
+#include "MonitorTypes.h"
+#include "AudioStream.h"
+#include "PostProcessor.h"
+#include "Texture.h"
+#include "utl/concurrency/SlotQueue.h"
+#include <atomic>
+#include <fstream>
+#include <mutex>
+
+namespace vc64 {
+
+class C64;
+
+/** Records the video and audio output of the emulator.
+ *
+ *  At the end of each frame, the emulator thread hands over the finished
+ *  texture together with the audio samples generated in the same frame. The
+ *  data is copied into a slot of a bounded queue which is drained by a
+ *  separate pipeline thread. The pipeline thread applies the monitor effects
+ *  if requested, converts the frame into the output format, and writes video
+ *  and audio to disk.
+ *
+ *  If the queue runs full, the emulator thread waits until a slot becomes
+ *  available. Hence, no frame is ever dropped. Instead, the emulator slows
+ *  down to the speed of the pipeline, which matters in warp mode only.
+ */
+class Recorder {
+
+    // A captured frame
+    struct Slot {
+
+        Texture texture;
+        MonitorConfig monitor;
+        bool pal;
+        std::vector<SamplePair> samples;
+    };
+
+    // The current configuration
+    RecorderConfig config = { };
+
+    // The captured frames (drained by the pipeline thread)
+    utl::SlotQueue<Slot> queue;
+
+    // Indicates if frames are being recorded
+    std::atomic<bool> recording = false;
+
+    // Geometry of the recorded texture area
+    isize x1 = 0, y1 = 0, width = 0, height = 0;
+
+    // Output streams
+    std::ofstream video;
+    std::ofstream audio;
+
+    // Software renderer for the monitor effects
+    PostProcessor postProcessor;
+
+    // Conversion buffers (used by the pipeline thread)
+    std::vector<u8> planes;
+    std::vector<i16> pcm;
+
+    // Statistics
+    RecorderStats stats = { };
+
+    // Guards the statistics
+    std::mutex mutex;
+
+
+    //
+    // Methods
+    //
+
+public:
+
+    Recorder() { }
+    ~Recorder();
+
+    // Returns true if a recording is in progress
+    bool isRecording() const { return recording; }
+
+    // Returns statistical information about the current or latest recording
+    RecorderStats getStats();
+
+    /* Starts a recording. The geometry, frame rate, and sample rate are taken
+     * from the provided instance. The emulator thread must not execute any
+     * frame while this function or stop() is running.
+     */
+    void start(const C64 &c64, const RecorderConfig &config);
+
+    // Stops the recording and waits until all pending frames are written
+    void stop();
+
+    // Hands over the current frame (called by the emulator thread)
+    void capture(const C64 &c64);
+
+private:
+
+    // Writes a single frame (called by the pipeline thread)
+    void write(const Slot &slot);
+    void writeVideo(const Slot &slot);
+    void writeAudio(const Slot &slot);
+
+    // Writes or updates the file headers
+    void writeHeader(const C64 &c64);
+    void updateWavHeader();
+};
+
+}
@@ -0,0 +1,94 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "BasicTypes.h"
+
+namespace vc64 {
+
+//
+// Enumerations
+//
+
+enum class VideoFormat : long
+{
+    RAW,                        ///< Headerless RGBA frames
+    Y4M                         ///< YUV4MPEG2 stream (4:4:4)
+};
+
+struct VideoFormatEnum : Reflectable<VideoFormatEnum, VideoFormat>
+{
+    static constexpr long minVal = 0;
+    static constexpr long maxVal = long(VideoFormat::Y4M);
+
+    static const char *_key(VideoFormat value)
+    {
+        switch (value) {
+
+            case VideoFormat::RAW:  return "RAW";
+            case VideoFormat::Y4M:  return "Y4M";
+        }
+        return "???";
+    }
+    static const char *help(VideoFormat value)
+    {
+        switch (value) {
+
+            case VideoFormat::RAW:  return "Headerless RGBA frames";
+            case VideoFormat::Y4M:  return "YUV4MPEG2 stream";
+        }
+        return "???";
+    }
+};
+
+
+//
+// Structures
+//
+
+typedef struct
+{
+    // Output files (an empty path disables the corresponding stream)
+    fs::path video;
+    fs::path audio;
+
+    // Video container format
+    VideoFormat format;
+
+    /* Frame size. If both values are zero, the visible texture area is
+     * recorded as is. Otherwise, the monitor effects are applied and the
+     * frame is scaled to the specified size.
+     */
+    isize width;
+    isize height;
+
+    // Maximum number of frames waiting to be written
+    isize queueSize;
+}
+RecorderConfig;
+
+typedef struct
+{
+    // Number of written frames and sample pairs
+    i64 frames;
+    i64 samples;
+
+    // Number of times the emulator had to wait for the pipeline
+    i64 stalls;
+
+    // Accumulated waiting time of the emulator in seconds
+    double stalled;
+}
+RecorderStats;
+
+}
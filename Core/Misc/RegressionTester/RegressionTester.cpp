@@ -115,7 +115,9 @@ void
 RegressionTester::processEvent(EventID id)
 {
     loginfo(STDERR, "Watchdog triggerd: Shutting down the emulator\n");
-    msgQueue.put(Msg::ABORT, 1);
+
+    // The second payload value tells a watchdog abort from a debugcart abort
+    msgQueue.put(Msg::ABORT, 1, 1);
 }
 
 void
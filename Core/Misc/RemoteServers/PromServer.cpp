@@ -152,6 +152,9 @@ PromServer::didReceive(const httplib::Request &req, httplib::Response &res)
         translate("vc64_audio_samples", "",
                   "gauge", std::to_string(stats.idleSamples),
                   {{"component","audio"},{"type","idle"}});
+        translate("vc64_audio_samples", "",
+                  "gauge", std::to_string(stats.droppedSamples),
+                  {{"component","audio"},{"type","dropped"}});
 
         translate("vc64_audio_fill_level", "",
                   "gauge", std::to_string(stats.fillLevel),
@@ -256,6 +256,17 @@ CommanderConsole::initCommands(RSCommand &root)
         }
     });
 
+    root.add({
+
+        .tokens = { cmd, "rewind" },
+        .chelp  = { "Reverts to a recently emulated frame" },
+        .args   = { { .name = { "frames", "Number of frames to go back" } } },
+        .func   = [this] (std::ostream &os, const Arguments &args, const std::vector<isize> &values) {
+
+            emulator.put(Cmd::REWIND, parseNum(args.at("frames")));
+        }
+    });
+
     root.add({
 
         .tokens = { cmd, "init" },
@@ -751,6 +751,41 @@ Console::parseSeq(const string &argv, const string &fallback) const
     try { return parseSeq(argv); } catch(...) { return fallback; }
 }
 
+peddle::GuardCondition
+Console::parseCondition(const Arguments &argv) const
+{
+    using namespace peddle;
+
+    GuardCondition result;
+
+    // A missing operand removes the condition
+    if (!argv.contains("operand")) return result;
+
+    if (!argv.contains("comparison")) throw RSError(RSError::TOO_FEW_ARGUMENTS, "comparison");
+    if (!argv.contains("value")) throw RSError(RSError::TOO_FEW_ARGUMENTS, "value");
+
+    auto operand = utl::uppercased(argv.at("operand"));
+    auto comparison = utl::uppercased(argv.at("comparison"));
+
+    if (operand == "A") result.operand = GuardOperand::A;
+    else if (operand == "X") result.operand = GuardOperand::X;
+    else if (operand == "Y") result.operand = GuardOperand::Y;
+    else if (operand == "SP") result.operand = GuardOperand::SP;
+    else if (operand == "P") result.operand = GuardOperand::P;
+    else { result.operand = GuardOperand::MEM; result.addr = parseAddr(argv, "operand"); }
+
+    if (comparison == "EQ") result.comparison = GuardComparison::EQ;
+    else if (comparison == "NE") result.comparison = GuardComparison::NE;
+    else if (comparison == "LT") result.comparison = GuardComparison::LT;
+    else if (comparison == "LE") result.comparison = GuardComparison::LE;
+    else if (comparison == "GT") result.comparison = GuardComparison::GT;
+    else if (comparison == "GE") result.comparison = GuardComparison::GE;
+    else throw utl::NewParseError(utl::NewParseError::PARSE_ENUM_ERROR, string("EQ, NE, LT, LE, GT, GE"));
+
+    result.value = u8(parseNum(argv, "value"));
+    return result;
+}
+
 void
 Console::exec(const InputLine& cmd)
 {
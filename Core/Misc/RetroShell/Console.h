@@ -13,6 +13,7 @@
 #pragma once
 
 #include "RetroShellTypes.h"
+#include "PeddleDebuggerTypes.h"
 #include "SubComponent.h"
 #include "RSCommand.h"
 #include "TextStorage.h"
@@ -320,6 +321,8 @@ protected:
     
     string parseSeq(const string &argv) const;
     string parseSeq(const string &argv, const string &fallback) const;
+
+    peddle::GuardCondition parseCondition(const Arguments &argv) const;
     
     template <typename T> long parseEnum(const string &argv) {
         return utl::parseEnum<T>(argv);
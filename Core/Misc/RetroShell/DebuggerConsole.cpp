@@ -193,6 +193,22 @@ DebuggerConsole::initCommands(RSCommand &root)
             }
     });
 
+    root.add({
+
+        .tokens = { "break", "cond" },
+        .chelp  = { "Attach a condition to a breakpoint" },
+        .args   = {
+            { .name = { "nr", "Breakpoint number" } },
+            { .name = { "operand", "A, X, Y, SP, P, or a memory address" }, .flags = rs::opt },
+            { .name = { "comparison", "EQ, NE, LT, LE, GT, GE" }, .flags = rs::opt },
+            { .name = { "value", "Comparison value" }, .flags = rs::opt }
+        },
+        .func   = [this] (std::ostream &os, const Arguments &args, const std::vector<isize> &values) {
+
+            cpu.setBreakpointCondition(parseNum(args, "nr"), parseCondition(args));
+        }
+    });
+
     root.add({
 
         .tokens = { "break", "delete" },
@@ -246,6 +262,22 @@ DebuggerConsole::initCommands(RSCommand &root)
             }
     });
 
+    root.add({
+
+        .tokens = { "watch", "cond" },
+        .chelp  = { "Attach a condition to a watchpoint" },
+        .args   = {
+            { .name = { "nr", "Watchpoint number" } },
+            { .name = { "operand", "A, X, Y, SP, P, or a memory address" }, .flags = rs::opt },
+            { .name = { "comparison", "EQ, NE, LT, LE, GT, GE" }, .flags = rs::opt },
+            { .name = { "value", "Comparison value" }, .flags = rs::opt }
+        },
+        .func   = [this] (std::ostream &os, const Arguments &args, const std::vector<isize> &values) {
+
+            cpu.setWatchpointCondition(parseNum(args, "nr"), parseCondition(args));
+        }
+    });
+
     root.add({
 
         .tokens = { "watch", "delete" },
@@ -599,6 +631,16 @@ DebuggerConsole::initCommands(RSCommand &root)
         }
     });
 
+    root.add({
+
+        .tokens = { "?", "thread", "rewind" },
+        .chelp  = { "Rewind buffer" },
+        .func   = [this] (std::ostream &os, const Arguments &args, const std::vector<isize> &values) {
+
+            dump(os, emulator, Category::Rewind);
+        }
+    });
+
 
     //
     // Peripherals
@@ -0,0 +1,228 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "RewindBuffer.h"
+#include "C64.h"
+#include "utl/abilities/Compressible.h"
+
+namespace vc64 {
+
+void
+RewindBuffer::setBudget(isize bytes)
+{
+    // Terminate the encoder thread if recording is disabled
+    if (bytes == 0) queue.stop(); else queue.flush();
+
+    std::lock_guard<std::mutex> guard(lock);
+
+    budget = bytes;
+
+    if (budget == 0) {
+
+        entries.clear();
+        used = 0;
+        keyState.clear();
+        keyState.shrink_to_fit();
+        recorded = -1;
+
+    } else {
+
+        while (used > budget && entries.front().key != entries.back().key) dropOldest();
+    }
+}
+
+void
+RewindBuffer::clear()
+{
+    queue.flush();
+
+    std::lock_guard<std::mutex> guard(lock);
+
+    entries.clear();
+    used = 0;
+    recorded = -1;
+
+    keyState.clear();
+    keyState.shrink_to_fit();
+}
+
+isize
+RewindBuffer::count() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return isize(entries.size());
+}
+
+isize
+RewindBuffer::bytes() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return used;
+}
+
+i64
+RewindBuffer::oldest() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return entries.empty() ? 0 : entries.front().frame;
+}
+
+i64
+RewindBuffer::latest() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return entries.empty() ? 0 : entries.back().frame;
+}
+
+void
+RewindBuffer::record(C64 &c64)
+{
+    if (!isEnabled()) return;
+
+    auto frame = i64(c64.frame);
+
+    // Start over if the time line has been interrupted (reset, snapshot, ...)
+    if (recorded >= 0 && frame != recorded + 1) clear();
+
+    // Launch the encoder thread on first use
+    if (!queue.isRunning()) queue.start(queueSize, [this](Slot &slot) { encode(slot); });
+
+    // Serialize the current state and hand it over to the encoder thread
+    auto &slot = queue.acquire();
+    slot.frame = frame;
+    slot.state.clear();
+    c64.save(slot.state);
+    queue.commit();
+
+    recorded = frame;
+}
+
+void
+RewindBuffer::encode(Slot &slot)
+{
+    auto &state = slot.state;
+
+    Entry entry = { .frame = slot.frame, .key = slot.frame, .data = { } };
+
+    // The encoder thread is the only one adding entries
+    bool empty; i64 key;
+    {   std::lock_guard<std::mutex> guard(lock);
+        empty = entries.empty();
+        key = empty ? 0 : entries.back().key;
+    }
+
+    if (empty || slot.frame - key >= keyInterval || state.size() != keyState.size()) {
+
+        // Record a keyframe
+        utl::Compressible::lz4(state.data(), isize(state.size()), entry.data);
+        keyState = state;
+
+    } else {
+
+        // Record the difference to the latest keyframe
+        delta.resize(state.size());
+        for (usize i = 0; i < state.size(); i++) delta[i] = state[i] ^ keyState[i];
+
+        utl::Compressible::lz4(delta.data(), isize(delta.size()), entry.data);
+        entry.key = key;
+    }
+
+    entry.data.shrink_to_fit();
+
+    std::lock_guard<std::mutex> guard(lock);
+    push(std::move(entry));
+
+    // Stay within the memory budget
+    while (used > budget && entries.front().key != entries.back().key) dropOldest();
+}
+
+i64
+RewindBuffer::restore(C64 &c64, isize frames)
+{
+    // Wait for the encoder thread to finish all pending frames
+    flush();
+
+    std::lock_guard<std::mutex> guard(lock);
+
+    if (entries.empty()) return -1;
+
+    // Determine the target frame
+    auto first = entries.front().frame;
+    auto target = std::clamp(i64(c64.frame) - i64(frames), first, entries.back().frame);
+
+    // Reconstruct the state of the target frame (O(1) in the distance)
+    decode(isize(target - first));
+
+    // Discard all frames that lie in the future now
+    while (entries.back().frame > target) popBack();
+
+    // Restore the machine state
+    c64.load(state.data(), SerFormat::NATIVE);
+    recorded = target;
+
+    return target;
+}
+
+void
+RewindBuffer::decode(isize index)
+{
+    auto &entry = entries[index];
+    auto &key = entries[index - isize(entry.frame - entry.key)];
+
+    assert(key.isKeyframe());
+
+    // Decompress the keyframe
+    keyState.clear();
+    utl::Compressible::unlz4(key.data.data(), isize(key.data.size()), keyState);
+    state = keyState;
+
+    // Apply the difference
+    if (!entry.isKeyframe()) {
+
+        delta.clear();
+        utl::Compressible::unlz4(entry.data.data(), isize(entry.data.size()), delta, isize(state.size()));
+
+        assert(delta.size() == state.size());
+        for (usize i = 0; i < state.size(); i++) state[i] ^= delta[i];
+    }
+}
+
+void
+RewindBuffer::dropOldest()
+{
+    auto key = entries.front().key;
+    while (!entries.empty() && entries.front().key == key) popFront();
+}
+
+void
+RewindBuffer::push(Entry &&entry)
+{
+    used += isize(entry.data.size());
+    entries.push_back(std::move(entry));
+}
+
+void
+RewindBuffer::popFront()
+{
+    used -= isize(entries.front().data.size());
+    entries.pop_front();
+}
+
+void
+RewindBuffer::popBack()
+{
+    used -= isize(entries.back().data.size());
+    entries.pop_back();
+}
+
+}
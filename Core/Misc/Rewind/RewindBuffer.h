@@ -0,0 +1,149 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "BasicTypes.h"
+#include "utl/concurrency/SlotQueue.h"
+#include <deque>
+#include <mutex>
+
+namespace vc64 {
+
+class C64;
+
+/** Stores the emulator state of past frames for rewinding.
+ *
+ *  The buffer records the complete machine state once per frame. Every
+ *  keyInterval frames, the state is stored as a keyframe. All frames in
+ *  between are stored as the XOR difference to the preceding keyframe. Since
+ *  only a small part of the machine state changes from frame to frame, the
+ *  differences consist of long runs of zeroes and shrink to a fraction of
+ *  their original size when compressed with LZ4.
+ *
+ *  Each frame can be restored by decompressing at most two entries, no matter
+ *  how far back it lies. If the buffer exceeds its memory budget, the oldest
+ *  keyframe is discarded together with all frames referring to it.
+ *
+ *  The emulator thread only serializes the machine state. Computing the
+ *  difference and compressing it is done by a separate encoder thread which
+ *  is fed via a bounded queue.
+ */
+class RewindBuffer {
+
+    struct Entry {
+
+        // Frame number
+        i64 frame;
+
+        // Frame number of the keyframe this entry refers to
+        i64 key;
+
+        // Compressed state (keyframes) or compressed XOR difference
+        std::vector<u8> data;
+
+        bool isKeyframe() const { return frame == key; }
+    };
+
+    // Number of frames between two keyframes
+    static constexpr i64 keyInterval = 50;
+
+    // Recorded frames (consecutive frame numbers)
+    std::deque<Entry> entries;
+
+    // Memory budget in bytes (0 = disabled)
+    isize budget = 0;
+
+    // Number of bytes used by all entries
+    isize used = 0;
+
+    // Guards the entries (they are added by the encoder thread)
+    mutable std::mutex lock;
+
+    // A serialized frame waiting to be encoded
+    struct Slot { i64 frame; std::vector<u8> state; };
+
+    // Number of frames that can be pending
+    static constexpr isize queueSize = 4;
+
+    // Frames waiting to be encoded
+    utl::SlotQueue<Slot> queue;
+
+    // Number of the latest frame handed over to the encoder (-1 = none)
+    i64 recorded = -1;
+
+    // Uncompressed state of the latest keyframe
+    std::vector<u8> keyState;
+
+    // Scratch buffers
+    std::vector<u8> state;
+    std::vector<u8> delta;
+
+
+    //
+    // Methods
+    //
+
+public:
+
+    // Stops the encoder while the members it accesses are still alive
+    ~RewindBuffer() { queue.stop(); }
+
+    // Sets the memory budget in bytes (0 disables recording)
+    void setBudget(isize bytes);
+    isize getBudget() const { return budget; }
+    bool isEnabled() const { return budget > 0; }
+
+    // Deletes all recorded frames
+    void clear();
+
+    // Returns the number of recorded frames
+    isize count() const;
+
+    // Returns the number of used bytes
+    isize bytes() const;
+
+    // Returns the frame numbers of the oldest and the latest recorded frame
+    i64 oldest() const;
+    i64 latest() const;
+
+    // Records the current state of a C64 (encoded in the background)
+    void record(C64 &c64);
+
+    // Waits until all recorded frames are encoded
+    void flush() { queue.flush(); }
+
+    /* Reverts a C64 by the specified number of frames. The target frame is
+     * clamped to the oldest recorded frame. All frames after the target frame
+     * are discarded. The function returns the number of the restored frame
+     * or -1 if no frame has been recorded.
+     */
+    i64 restore(C64 &c64, isize frames);
+
+private:
+
+    // Adds a serialized frame (called by the encoder thread)
+    void encode(Slot &slot);
+
+    // Decompresses the state of a recorded frame into 'state'
+    void decode(isize index);
+
+    // Discards the oldest keyframe and all frames referring to it
+    void dropOldest();
+
+    // Adds or removes an entry
+    void push(Entry &&entry);
+    void popFront();
+    void popBack();
+};
+
+}
@@ -0,0 +1,74 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "SnapshotWorker.h"
+#include "C64.h"
+#include "Emulator.h"
+#include <cstring>
+
+namespace vc64 {
+
+void
+SnapshotWorker::capture(C64 &c64, Compressor compressor)
+{
+    // Launch the worker thread on first use
+    if (!queue.isRunning()) queue.start(capacity, [this](Slot &slot) { finish(slot); });
+
+    // If the queue is full, wait for the worker to catch up
+    auto &slot = queue.acquire();
+
+    // Serialize the machine state
+    slot.state.clear();
+    c64.save(slot.state);
+
+    // Copy the visible texture area
+    slot.width = PAL::VISIBLE_PIXELS;
+    slot.height = std::min(isize(c64.vic.numVisibleLines()), isize(Texture::height - PAL::FIRST_VISIBLE_LINE));
+    slot.screen.resize(slot.width * slot.height);
+
+    c64.emulator.lockTexture();
+    auto *source = c64.videoPort.getTexture().pixels.ptr;
+    source += PAL::FIRST_VISIBLE_LINE * Texture::width + PAL::FIRST_VISIBLE_PIXEL;
+    for (isize y = 0; y < slot.height; y++) {
+        std::memcpy(slot.screen.data() + y * slot.width, source + y * Texture::width, slot.width * sizeof(u32));
+    }
+    c64.emulator.unlockTexture();
+
+    slot.timestamp = time(nullptr);
+    slot.compressor = compressor;
+    slot.msgQueue = &c64.msgQueue;
+
+    // Hand the slot over to the worker thread
+    queue.commit();
+}
+
+void
+SnapshotWorker::finish(Slot &slot)
+{
+    auto *snapshot = new Snapshot(slot.state);
+
+    // Record the thumbnail
+    auto &thumbnail = snapshot->getHeader()->screenshot;
+    thumbnail.take(slot.screen.data(), slot.width, slot.width, slot.height);
+    thumbnail.timestamp = slot.timestamp;
+
+    // Compress the snapshot if requested (keep it uncompressed on failure)
+    try { snapshot->compress(slot.compressor); } catch (std::exception &e) {
+        logwarn("Failed to compress snapshot: %s\n", e.what());
+    }
+
+    // Hand the snapshot over to the GUI
+    slot.msgQueue->put( Message { .type = Msg::SNAPSHOT_TAKEN, .snapshot = { snapshot } } );
+}
+
+}
@@ -0,0 +1,88 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "CoreObject.h"
+#include "Snapshot.h"
+#include "utl/concurrency/SlotQueue.h"
+#include <vector>
+
+namespace vc64 {
+
+class C64;
+class MsgQueue;
+
+/** Finishes snapshots in the background.
+ *
+ *  Taking a snapshot comprises serializing the machine state, recording a
+ *  thumbnail image, and compressing the result. Only the first step needs
+ *  the emulator to stand still. When a snapshot is captured, the emulator
+ *  thread serializes the state and copies the visible texture area into a
+ *  slot of a bounded queue. Everything else is done by a separate worker
+ *  thread which drains the queue and hands the finished snapshot over to the
+ *  GUI via a SNAPSHOT_TAKEN message.
+ *
+ *  If the queue runs full, the emulator thread waits until a slot becomes
+ *  available. Hence, no snapshot is ever dropped.
+ */
+class SnapshotWorker final : CoreObject {
+
+    // A captured snapshot
+    struct Slot {
+
+        // Serialized machine state (native format)
+        std::vector<u8> state;
+
+        // Visible texture area
+        std::vector<u32> screen;
+        isize width = 0;
+        isize height = 0;
+
+        // Creation date and time
+        time_t timestamp = 0;
+
+        // Requested compression method
+        Compressor compressor = Compressor::NONE;
+
+        // Receiver of the finished snapshot
+        MsgQueue *msgQueue = nullptr;
+    };
+
+    // Number of slots in the queue
+    static constexpr isize capacity = 4;
+
+    // The captured snapshots (the worker thread is launched on first use)
+    utl::SlotQueue<Slot> queue;
+
+
+    //
+    // Methods
+    //
+
+public:
+
+    const char *objectName() const override { return "SnapshotWorker"; }
+
+    // Captures the current state (called by the emulator thread)
+    void capture(C64 &c64, Compressor compressor);
+
+    // Waits until all pending snapshots have been handed over
+    void flush() { queue.flush(); }
+
+private:
+
+    // Finishes a single snapshot (called by the worker thread)
+    void finish(Slot &slot);
+};
+
+}
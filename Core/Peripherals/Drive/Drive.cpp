@@ -42,6 +42,7 @@ Drive::_initialize()
 {    
     insertionStatus = InsertionStatus::FULLY_EJECTED;
     if (disk) disk->clearDisk();
+    uncacheHead();
 }
 
 void
@@ -60,7 +61,19 @@ void
 Drive::execute(u64 duration)
 {
     elapsedTime += duration;
-    
+
+    // Postpone execution as long as the CPU is parked in an idle loop
+    if (idleLoopClock == cpu.clock &&
+        pendingCycles() < std::min(via1.wakeUpCycle, via2.wakeUpCycle) - cpu.clock) return;
+
+    catchUp();
+}
+
+template <bool lazy> void
+Drive::catchUp()
+{
+    if (idleLoopClock == cpu.clock) skipIdleLoop();
+
     while (nextClock < (i64)elapsedTime || nextCarry < (i64)elapsedTime) {
 
         if (nextClock <= nextCarry) {
@@ -73,14 +86,88 @@ Drive::execute(u64 duration)
             updateByteReady();
             nextClock += 10000;
 
-        } else {
-            
-            // Execute read/write logic
-            if (spinning) executeUF4();
+        } else if (spinning) {
+
+            if (lazy && postponableCarries) {
+
+                // Fast path: Run the pulse later as part of a batch
+                postponableCarries--;
+                postponedCarries++;
+
+            } else {
+
+                // Execute read/write logic
+                flushCarries();
+                executeUF4();
+
+                if constexpr (lazy) postponableCarries = postponableCarryPulses();
+            }
             nextCarry += delayBetweenTwoCarryPulses[zone];
+
+        } else {
+
+            // Without a rotating disk, carry pulses have no effect
+            auto delay = delayBetweenTwoCarryPulses[zone];
+            auto limit = std::min(nextClock, (i64)elapsedTime);
+            nextCarry += (limit - nextCarry + delay - 1) / delay * delay;
         }
     }
     assert(nextClock >= (i64)elapsedTime && nextCarry >= (i64)elapsedTime);
+
+    // Idle loops are closed by a jump or a branch instruction
+    if (!spinning && cpu.inFetchPhase() && (cpu.reg.ir == 0x4C || (cpu.reg.ir & 0x1F) == 0x10)) {
+        detectIdleLoop();
+    }
+}
+
+template void Drive::catchUp<true>();
+template void Drive::catchUp<false>();
+
+void
+Drive::detectIdleLoop()
+{
+    auto period = hasParCable() ? 0 : cpu.idleLoopCycles();
+
+    // Only proceed if the CPU is at the head of an idle loop
+    if (!period) return;
+
+    /* To park the CPU, it must have run through the loop once, starting at the
+     * loop head. In this case, all internal latches hold the same values as
+     * after any other iteration. If an interrupt had occurred in between, the
+     * CPU would not be back at the loop head after exactly one period.
+     */
+    if (period == idleLoopPeriod && cpu.clock == idleLoopStart + period) {
+        idleLoopClock = cpu.clock;
+    }
+
+    idleLoopPeriod = period;
+    idleLoopStart = cpu.clock;
+}
+
+void
+Drive::skipIdleLoop()
+{
+    // Make sure the loop is still intact
+    if (spinning || hasParCable() || cpu.idleLoopCycles() != idleLoopPeriod) {
+
+        clearIdleLoop();
+        return;
+    }
+
+    // Determine the number of cycles that can be skipped without waking a VIA
+    auto wake = std::min(via1.wakeUpCycle, via2.wakeUpCycle);
+    auto cycles = std::min(pendingCycles(), wake - 1 - cpu.clock);
+    cycles -= cycles % idleLoopPeriod;
+
+    if (cycles > 0) {
+
+        cpu.clock += cycles;
+        via1.idleCounter += cycles;
+        via2.idleCounter += cycles;
+        nextClock += cycles * 10000;
+
+        idleLoopClock = idleLoopStart = cpu.clock;
+    }
 }
 
 void
@@ -97,10 +184,25 @@ Drive::executeUF4()
         // When a bit comes in and ...
         //   ... it's value equals 0, nothing happens.
         //   ... it's value equals 1, counter UF4 is reset.
-        if (readMode() && hasDisk() && readBitFromHead()) {
-            counterUF4 = 0;
+        if (headData) {
+
+            // Fast path: Shift the bit out of the cached GCR byte
+            if (readMode() && (headByte << (offset & 7)) & 0x80) {
+                counterUF4 = 0;
+            }
+            if (++offset >= headLength) offset = 0;
+            if ((offset & 7) == 0) headByte = headData[offset >> 3];
+
+        } else {
+
+            if (readMode() && hasDisk() && readBitFromHead()) {
+                counterUF4 = 0;
+            }
+            rotateDisk();
+
+            // Switch to the fast path if no bits are going to be written
+            if (readMode() && hasDisk()) cacheHead();
         }
-        rotateDisk();
     }
 
     // Update SYNC signal
@@ -177,6 +279,105 @@ Drive::executeUF4()
     }
 }
 
+isize
+Drive::postponableCarryPulses() const
+{
+    /* A carry pulse can be postponed if it has no effect outside the read
+     * logic. This is the case if the drive reads from the cached halftrack,
+     * the byte ready line is high, and the byte ready counter stays below 7.
+     */
+    if (!headData || !readMode() || !byteReady || byteReadyCounter == 7) return 0;
+
+    /* The bit cells need to be aligned with UF4. In this case, each bit is
+     * read when QBQA equals 00, and the byte ready counter advances at most
+     * once per bit cell when QBQA equals 10. Bit cells get aligned with the
+     * first 1 bit being read.
+     */
+    if ((counterUF4 & 3) != (carryCounter & 3)) return 0;
+
+    // Determine the number of pulses until QBQA equals 10 for the first time
+    auto first = ((1 - carryCounter) & 3) + 1;
+
+    // The byte ready counter can't reach 7 before this pulse
+    return first + 4 * (6 - byteReadyCounter) - 1;
+}
+
+void
+Drive::flushCarries()
+{
+    postponableCarries = 0;
+    if (!postponedCarries) return;
+
+    // The head cache is dropped when the drive is cloned
+    if (!headData) cacheHead();
+
+    /* Execute the postponed pulses. They only affect the read logic, because
+     * the fast path ensures that the read mode is selected, the byte ready
+     * counter stays below 7, and the byte ready line remains high.
+     */
+    auto pulse = [&]() {
+
+        counterUF4++;
+
+        // Read a bit every fourth pulse
+        if (++carryCounter % 4 == 0) {
+
+            if ((headByte << (offset & 7)) & 0x80) counterUF4 = 0;
+            if (++offset >= headLength) offset = 0;
+            if ((offset & 7) == 0) headByte = headData[offset >> 3];
+        }
+
+        // Update SYNC signal
+        sync = (readShiftreg & 0x3FF) != 0x3FF;
+        if (!sync) byteReadyCounter = 0;
+
+        // Execute the byte ready counter and both shift registers
+        if ((counterUF4 & 3) == 2) {
+
+            byteReadyCounter = sync ? (byteReadyCounter + 1) & 7 : 0;
+            writeShiftreg <<= 1;
+            readShiftreg = u16(readShiftreg << 1 | ((counterUF4 & 0x0C) == 0));
+        }
+    };
+
+    auto n = postponedCarries;
+
+    // Run single pulses up to the next bit cell
+    for (; n && (carryCounter & 3) != 3; n--) pulse();
+
+    /* Run whole bit cells. The bit is read by the first pulse and shifted
+     * into the read shift register by the third one. Since UF4 is aligned
+     * with the bit cells, QBQA equals 11 at the cell boundaries.
+     */
+    for (; n >= 4; n -= 4) {
+
+        assert((counterUF4 & 3) == 3);
+
+        counterUF4 = ((headByte << (offset & 7)) & 0x80) ? 3 : u8(counterUF4 + 4);
+        if (++offset >= headLength) offset = 0;
+        if ((offset & 7) == 0) headByte = headData[offset >> 3];
+
+        // The shift register is unchanged during the first three pulses
+        bool syncIn = (readShiftreg & 0x3FF) != 0x3FF;
+        byteReadyCounter = syncIn ? (byteReadyCounter + 1) & 7 : 0;
+        writeShiftreg <<= 1;
+        readShiftreg = u16(readShiftreg << 1 | ((counterUF4 & 0x0C) == 0));
+
+        // The fourth pulse updates the SYNC signal
+        sync = (readShiftreg & 0x3FF) != 0x3FF;
+        if (!sync) byteReadyCounter = 0;
+
+        carryCounter += 4;
+    }
+
+    // Run the remaining pulses
+    for (; n; n--) pulse();
+
+    assert(byteReadyCounter != 7);
+
+    postponedCarries = 0;
+}
+
 void
 Drive::updateByteReady()
 {
@@ -234,6 +435,7 @@ void
 Drive::writeBitToHead(u8 bit)
 {
     assert(hasDisk());
+    uncacheHead();
     disk->writeBitToHalftrack(halftrack, offset, bit);
 }
 
@@ -245,6 +447,17 @@ Drive::rotateDisk()
     }
 }
 
+void
+Drive::cacheHead()
+{
+    assert(hasDisk());
+    assert(disk->isValidHeadPos(halftrack, offset));
+
+    headData = disk->data.halftrack[halftrack];
+    headLength = disk->length.halftrack[halftrack];
+    headByte = headData[offset >> 3];
+}
+
 void
 Drive::setRedLED(bool b)
 {
@@ -286,6 +499,9 @@ Drive::moveHeadUp()
 {
     if (halftrack < 84) {
 
+        flushCarries();
+        uncacheHead();
+
         if (hasDisk()) {
 
             assert(disk->lengthOfHalftrack(halftrack) != 0);
@@ -314,6 +530,9 @@ Drive::moveHeadDown()
 {
     if (halftrack > 1) {
         
+        flushCarries();
+        uncacheHead();
+
         if (hasDisk()) {
 
             assert(disk->lengthOfHalftrack(halftrack) != 0);
@@ -528,6 +747,10 @@ Drive::vsyncHandler()
     // Only proceed if the drive is connected and switched on
     if (!config.connected || !config.switchedOn) return;
 
+    // Don't let the drive fall behind by more than a frame
+    catchUp();
+    flushCarries();
+
     // Check if we should enter power-safe mode
     if (!spinning && config.powerSave) {
 
@@ -568,6 +791,9 @@ Drive::scheduleFirstDiskChangeEvent(EventID id)
 void
 Drive::processDiskChangeEvent(EventID id)
 {
+    // The postponed carry pulses belong to the old disk state
+    flushCarries();
+
     auto reschedule = [&](isize delay) {
 
         Cycle cycles = vic.getCyclesPerFrame() * delay;
@@ -593,6 +819,7 @@ Drive::processDiskChangeEvent(EventID id)
 
             // Make sure the drive can no longer read from this disk
             disk->clearDisk();
+            uncacheHead();
 
             // Schedule the next transition
             reschedule(config.ejectDelay);
@@ -635,6 +862,7 @@ Drive::processDiskChangeEvent(EventID id)
             // Fully insert the disk (unblocks the light barrier)
             insertionStatus = InsertionStatus::FULLY_INSERTED;
             disk = std::move(diskToInsert);
+            uncacheHead();
 
             // Inform the GUI
             msgQueue.put(Msg::DISK_INSERT, DriveMsg {
@@ -73,6 +73,7 @@ class Drive final : public SubComponent, public Inspectable<DriveInfo> {
     friend class DriveMemory;
     friend class VIA1;
     friend class VIA2;
+    friend class Benchmarks;
 
     //
     // Constants
@@ -253,6 +254,57 @@ public:
     // Indicates whether execute() should be called inside the run loop
     bool needsEmulation = false;
     
+
+    //
+    // Idle loop detection (cloned, but not serialized)
+    //
+
+    // Number of cycles of the idle loop detected most recently
+    isize idleLoopPeriod = 0;
+
+    // CPU cycle at which the CPU was seen at the head of this loop
+    i64 idleLoopStart = -1;
+
+    /* CPU cycle at which the CPU has been parked. If this value equals the
+     * current CPU cycle, the CPU sits at the head of a verified idle loop and
+     * execution can be postponed or skipped.
+     */
+    i64 idleLoopClock = -1;
+
+
+    //
+    // Read head cache (neither cloned nor serialized)
+    //
+
+    /* Bit data of the current halftrack. If set, the drive head reads the disk
+     * byte by byte and shifts out the bits of the cached GCR byte. The pointer
+     * is cleared whenever the head moves, a bit is written, or the disk is
+     * changed. In this case, the drive falls back to reading single bits.
+     */
+    const u8 *headData = nullptr;
+
+    // Number of bits in the cached halftrack
+    HeadPos headLength = 0;
+
+    // GCR byte under the drive head
+    u8 headByte = 0;
+
+
+    //
+    // Postponed carry pulses (cloned, but not serialized)
+    //
+
+    /* Number of carry pulses that have been postponed. While the head reads
+     * from the cached halftrack and no byte is about to become ready, a carry
+     * pulse only affects the internal state of the read logic. catchUp()
+     * counts these pulses and flushCarries() executes them in a single batch
+     * before the state becomes visible, e.g., when VIA2 is accessed.
+     */
+    isize postponedCarries = 0;
+
+    // Number of upcoming carry pulses that may still be postponed
+    isize postponableCarries = 0;
+
     
     //
     // Methods
@@ -289,6 +341,15 @@ public:
         CLONE(watchdog)
         CLONE(needsEmulation)
 
+        CLONE(idleLoopPeriod)
+        CLONE(idleLoopStart)
+        CLONE(idleLoopClock)
+
+        CLONE(postponedCarries)
+        postponableCarries = 0;
+
+        uncacheHead();
+
         CLONE(insertionStatus)
 
         CLONE(config)
@@ -380,7 +441,10 @@ private:
     void _initialize() override;
     void _run() override;
     void _dump(Category category, std::ostream &os) const override;
+    void _willReset(bool hard) override;
     void _didReset(bool hard) override;
+    void _didLoad() override;
+    void _willSave() override;
 
 
     //
@@ -530,14 +594,45 @@ public:
 public:
     
     /* Executes all pending cycles of the virtual drive. The number of cycles
-     * is determined by the target time which is elapsedTime + duration.
+     * is determined by the target time which is elapsedTime + duration. If the
+     * drive CPU is parked in an idle loop, execution may be postponed until
+     * one of the VIAs wakes up or catchUp() is called.
      */
     void execute(u64 duration);
 
+    // Executes all postponed cycles
+    void catchUp() { catchUp<true>(); }
+
+    // Executes all postponed carry pulses
+    void flushCarries();
+
 private:
+
+    /* Executes all postponed cycles. If lazy is false, carry pulses are never
+     * postponed (the benchmarks use this variant as a reference).
+     */
+    template <bool lazy> void catchUp();
+
+private:
+
+    // Returns the number of CPU cycles that are due, but not yet executed
+    i64 pendingCycles() const {
+        return nextClock < (i64)elapsedTime ? ((i64)elapsedTime - nextClock + 9999) / 10000 : 0; }
+
+    // Checks whether the CPU has entered an idle loop
+    void detectIdleLoop();
+
+    // Skips as many iterations of the current idle loop as possible
+    void skipIdleLoop();
+
+    // Forgets about the most recently detected idle loop
+    void clearIdleLoop() { idleLoopPeriod = 0; idleLoopStart = idleLoopClock = -1; }
     
     // Emulates a trigger event on the carry output pin of UE7.
     void executeUF4();
+
+    // Returns the number of upcoming carry pulses that can be postponed
+    isize postponableCarryPulses() const;
     
 public:
 
@@ -591,6 +686,16 @@ public:
     // Advances drive head position by one bit
     void rotateDisk();
 
+private:
+
+    // Caches the GCR byte under the drive head
+    void cacheHead();
+
+    // Makes the drive head read single bits again
+    void uncacheHead() { headData = nullptr; }
+
+public:
+
     // Performs periodic actions
     void vsyncHandler();
     
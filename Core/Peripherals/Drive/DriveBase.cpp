@@ -140,6 +140,12 @@ Drive::cacheInfo(DriveInfo &result) const
     result.offset = offset;
 }
 
+void
+Drive::_willReset(bool hard)
+{
+    flushCarries();
+}
+
 void
 Drive::_didReset(bool hard)
 {
@@ -147,6 +153,24 @@ Drive::_didReset(bool hard)
     halftrack = 41;
 
     needsEmulation = config.connected && config.switchedOn;
+    clearIdleLoop();
+    uncacheHead();
+}
+
+void
+Drive::_didLoad()
+{
+    clearIdleLoop();
+    uncacheHead();
+    postponedCarries = postponableCarries = 0;
+}
+
+void
+Drive::_willSave()
+{
+    // Make sure that no postponed cycles end up in the snapshot
+    catchUp();
+    flushCarries();
 }
 
 void
@@ -76,6 +76,7 @@ void
 DriveMemory::deleteRom()
 {
     memset(rom, 0, sizeof(rom));
+    romPages.markAll();
 
     // Update the current configuration in auto-config mode
     if (drive.config.autoConfig) drive.autoConfigure();
@@ -112,6 +113,7 @@ DriveMemory::loadRom(const u8 *buf, isize size)
             for (isize i = 0; i < size; i++) rom[0x0000 + i] = buf[i];
             break;
     }
+    romPages.markAll();
     
     // Update the current configuration in auto-config mode
     if (drive.config.autoConfig) drive.autoConfigure();
@@ -132,7 +134,7 @@ DriveMemory::saveRom(const fs::path &path)
 }
 
 u8
-DriveMemory::peek(u16 addr)
+DriveMemory::peekSlow(u16 addr)
 {
     u8 result;
     
@@ -230,18 +232,20 @@ DriveMemory::spypeek(u16 addr) const
 }
 
 void 
-DriveMemory::poke(u16 addr, u8 value)
+DriveMemory::pokeSlow(u16 addr, u8 value)
 {
     switch (usage[addr >> 10]) {
 
         case DrvMemType::RAM:
             
             ram[addr & 0x07FF] = value;
+            ramPages.mark(addr & 0x07FF);
             break;
             
         case DrvMemType::EXP:
             
             ram[addr] = value;
+            ramPages.mark(addr);
             break;
             
         case DrvMemType::VIA1:
@@ -321,6 +325,40 @@ DriveMemory::updateBankMap()
         
         for (isize i = 20; i < 24; i++) usage[i] = DrvMemType::PIA;
     }
+
+    updateDirectAccessTables();
+}
+
+void
+DriveMemory::updateDirectAccessTables()
+{
+    for (isize page = 0; page < 64; page++) {
+
+        auto offset = page << 10;
+
+        switch (usage[page]) {
+
+            case DrvMemType::RAM:
+
+                peekPtr[page] = pokePtr[page] = ram + (offset & 0x07FF);
+                break;
+
+            case DrvMemType::EXP:
+
+                peekPtr[page] = pokePtr[page] = ram + offset;
+                break;
+
+            case DrvMemType::ROM:
+
+                peekPtr[page] = rom + (offset & 0x7FFF);
+                pokePtr[page] = nullptr;
+                break;
+
+            default:
+
+                peekPtr[page] = pokePtr[page] = nullptr;
+        }
+    }
 }
 
 }
@@ -14,6 +14,7 @@
 
 #include "SubComponent.h"
 #include "DriveTypes.h"
+#include "utl/storage/DirtyMap.h"
 
 namespace vc64 {
 
@@ -53,6 +54,20 @@ public:
 
     // Memory usage table (one entry for each KB)
     DrvMemType usage[64];
+
+    /* Direct access tables (one entry for each KB). For RAM and ROM pages,
+     * the entries point to the first byte of the page in the backing array,
+     * which takes care of all mirrors. All other pages store a nullptr.
+     */
+    u8 *peekPtr[64] = { };
+    u8 *pokePtr[64] = { };
+
+    // Dirty page maps (256 byte pages for RAM, 4 KB pages for ROM)
+    mutable utl::DirtyMap<160> ramPages = utl::DirtyMap<160>(8);
+    mutable utl::DirtyMap<8> romPages = utl::DirtyMap<8>(12);
+
+    // Number of bytes copied by the latest assignment
+    isize clonedBytes = 0;
     
     
     //
@@ -65,10 +80,13 @@ public:
 
     DriveMemory& operator= (const DriveMemory& other) {
 
-        CLONE_ARRAY(ram)
-        CLONE_ARRAY(rom)
+        clonedBytes = 0;
+        clonedBytes += ramPages.sync(ram, other.ramPages, other.ram, sizeof(ram));
+        clonedBytes += romPages.sync(rom, other.romPages, other.rom, sizeof(rom));
+
         CLONE_ARRAY(usage)
 
+        updateDirectAccessTables();
         return *this;
     }
 
@@ -84,9 +102,18 @@ public:
     {
         if (isResetter(worker)) return;
 
+        if constexpr (std::is_same_v<T, SerChecker>) {
+
+            // Incorporate the cached page hashes instead of the RAM contents
+            worker << ramPages.fnv64(ram, sizeof(ram));
+
+        } else {
+
+            worker << ram;
+        }
+
         worker
 
-        << ram
         << usage;
     }
 
@@ -155,7 +182,10 @@ public:
 public:
 
     // Reads a value from memory
-    u8 peek(u16 addr);
+    u8 peek(u16 addr) {
+        if (auto *p = peekPtr[addr >> 10]; likely(p)) return p[addr & 0x3FF];
+        return peekSlow(addr);
+    }
     u8 peekZP(u8 addr) { return ram[addr]; }
     u8 peekStack(u8 sp) { return ram[0x100 + sp]; }
     
@@ -168,13 +198,36 @@ public:
     // Reads a value from memory without side effects
     u8 spypeek(u16 addr) const;
 
+    // Checks whether reading from an address affects one of the I/O chips
+    bool hasSideEffects(u16 addr) const {
+        auto type = usage[addr >> 10];
+        return type == DrvMemType::VIA1 || type == DrvMemType::VIA2 || type == DrvMemType::PIA;
+    }
+
     // Writes a value into memory
-    void poke(u16 addr, u8 value);
-    void pokeZP(u8 addr, u8 value) { ram[addr] = value; }
-    void pokeStack(u8 sp, u8 value) { ram[0x100 + sp] = value; }
+    void poke(u16 addr, u8 value) {
+        if (auto *p = pokePtr[addr >> 10]; likely(p)) {
+            p += addr & 0x3FF;
+            *p = value;
+            ramPages.mark(p - ram);
+        } else {
+            pokeSlow(addr, value);
+        }
+    }
+    void pokeZP(u8 addr, u8 value) { ram[addr] = value; ramPages.mark(addr); }
+    void pokeStack(u8 sp, u8 value) { ram[0x100 + sp] = value; ramPages.mark(0x100); }
 
     // Updates the bank map
     void updateBankMap();
+
+private:
+
+    // Serves all accesses that are not covered by the direct access tables
+    u8 peekSlow(u16 addr);
+    void pokeSlow(u16 addr, u8 value);
+
+    // Derives the direct access tables from the bank map
+    void updateDirectAccessTables();
 };
 
 }
@@ -22,6 +22,7 @@ DriveMemory::_didReset(bool hard)
     for (usize i = 0; i < sizeof(ram); i++) {
         ram[i] = (i & 64) ? 0xFF : 0x00;
     }
+    ramPages.markAll();
 }
 
 void
@@ -34,6 +35,8 @@ void
 DriveMemory::operator << (SerReader &worker)
 {
     serialize(worker);
+    updateDirectAccessTables();
+    ramPages.markAll();
 }
 
 void
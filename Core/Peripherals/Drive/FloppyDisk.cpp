@@ -278,6 +278,7 @@ void
 FloppyDisk::init(SerReader &reader)
 {
     serialize(reader);
+    pages.markAll();
 }
 
 void
@@ -338,6 +339,8 @@ FloppyDisk::writeBlock(const u8 *src, isize nr)
     assert(gcr.size() == (*sector).size());
     for (isize i = 0; i < gcr.size(); ++i, ++it)
         bv.set(it.offset(), gcr[i]);
+
+    pages.mark(data.track[tt] - &data.track[0][0], sizeof(data.track[tt]));
 }
 
 void
@@ -474,6 +477,7 @@ FloppyDisk::clearHalftrack(Halftrack ht)
 {
     memset(&data.halftrack[ht], 0x55, sizeof(data.halftrack[ht]));
     length.halftrack[ht] = sizeof(data.halftrack[ht]) * 8;
+    pages.mark(data.halftrack[ht] - &data.track[0][0], sizeof(data.halftrack[ht]));
 }
 
 void
@@ -650,6 +654,7 @@ FloppyDisk::encodeDisk(const FloppyDiskImage &image)
         TrackNr tt = t + 1;
         
         memcpy(data.track[tt], gcr.span().data(), gcr.span().size());
+        pages.mark(data.track[tt] - &data.track[0][0], gcr.span().size());
         length.track[tt][0] = length.track[tt][1] = gcr.size() * 8;
     }
 
@@ -707,6 +712,7 @@ FloppyDisk::encodeG64(const G64File &a)
         length.halftrack[ht] = (u16)(8 * size);
         
         a.copyHalftrack(ht, data.halftrack[ht]);
+        pages.mark(data.halftrack[ht] - &data.track[0][0], size);
     }
 }
 
@@ -18,6 +18,7 @@
 #include "FileSystems/CBM/FSTypes.h"
 #include "FileSystems/CBM/FSObjects.h"
 #include "Images/FloppyDiskImage.h"
+#include "utl/storage/DirtyMap.h"
 
 namespace vc64 {
 
@@ -33,6 +34,8 @@ class DiskAnalyzer;
 class FloppyDisk final : public CoreObject, public TrackDevice {
     
     friend class Drive;
+    friend class Benchmarks;
+    friend class Checks;
     
 public:
     
@@ -89,6 +92,11 @@ public:
     
     // Length information for each halftrack on this disk
     DiskLength length = { };
+
+private:
+
+    // Dirty page map for the disk data (1 KB pages), used for checksumming
+    mutable utl::DirtyMap<1024> pages = utl::DirtyMap<1024>(10);
     
     
     //
@@ -141,6 +149,8 @@ public:
         CLONE(modified)
         CLONE(data)
         CLONE(length)
+
+        pages.markAll();
         
         return *this;
     }
@@ -196,8 +206,20 @@ public:
         worker
         
         << writeProtected
-        << modified
-        << data
+        << modified;
+
+        if constexpr (std::is_same_v<T, SerChecker>) {
+
+            // Incorporate the cached page hashes instead of the disk data
+            worker << pages.fnv64((u8 *)data.track, sizeof(data.track));
+
+        } else {
+
+            worker << data;
+        }
+
+        worker
+
         << length;
     }
     
@@ -280,6 +302,7 @@ public:
     void _writeBitToHalftrack(Halftrack ht, HeadPos pos, bool bit) {
         if (pos >= length.halftrack[ht]) pos -= length.halftrack[ht];
         assert(isValidHeadPos(ht, pos));
+        pages.mark(&data.halftrack[ht][pos >> 3] - &data.track[0][0]);
         if (bit) {
             data.halftrack[ht][pos >> 3] |= (0x0080 >> (pos & 7));
         } else {
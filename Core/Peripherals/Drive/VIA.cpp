@@ -204,6 +204,9 @@ VIA6522::peek(u16 addr)
     assert (addr <= 0xF);
     
     wakeUp();
+
+    // Bring the read logic up to date
+    if (isVia2()) drive.flushCarries();
     
     switch(addr) {
             
@@ -479,6 +482,9 @@ void VIA6522::poke(u16 addr, u8 value)
     assert (addr <= 0x0F);
     
     wakeUp();
+
+    // Bring the read logic up to date
+    if (isVia2()) drive.flushCarries();
     
     switch(addr) {
             
@@ -0,0 +1,602 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "PostProcessor.h"
+#include "VideoKernels.h"
+#include "utl/chrono.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+namespace vc64 {
+
+namespace {
+
+// Maps an option value from [0; 1000] to [min; max] (see RendererSetup.swift)
+double map(isize value, double min, double max)
+{
+    return min + double(std::clamp(value, isize(0), isize(1000))) / 1000.0 * (max - min);
+}
+
+// Converts a floating point weight into a fixed point factor (256 = 1.0)
+u16 fixed(double weight)
+{
+    return u16(std::lround(std::clamp(weight, 0.0, 1.0) * 256.0));
+}
+
+// Computes the weighted luminance of a texel (used by the xBR upscaler)
+float luma(u32 texel)
+{
+    return (14.352f * float(texel & 0xFF) +
+            28.176f * float((texel >> 8) & 0xFF) +
+            5.472f * float((texel >> 16) & 0xFF)) / 255.0f;
+}
+
+}
+
+PostProcessor::PostProcessor(isize threads)
+{
+    auto cores = isize(std::thread::hardware_concurrency());
+    this->threads = threads > 0 ? threads : std::max(cores, isize(1));
+}
+
+const u32 *
+PostProcessor::apply(const Texture &texture, const MonitorConfig &config,
+                     bool pal, isize width, isize height)
+{
+    assert(width > 0 && height > 0);
+    assert(!texture.paletted);
+
+    utl::Clock clock;
+
+    // Determine the visible texture area (see TextureRect.swift)
+    auto area = Texture::visibleArea(pal);
+    double maxW = double(area.x2 - area.x1), maxH = double(area.y2 - area.y1);
+    double w = (1.0 - config.hZoom / 1000.0) * maxW;
+    double h = (1.0 - config.vZoom / 1000.0) * maxH;
+    double x = double(area.x1) + config.hCenter / 1000.0 * (maxW - w);
+    double y = double(area.y1) + config.vCenter / 1000.0 * (maxH - h);
+
+    // Shift of the red channel in texels (blue is shifted in opposite direction)
+    double dx = config.disalignment ? map(config.disalignmentH, -0.004, 0.004) * Texture::width : 0.0;
+    double dy = config.disalignment ? map(config.disalignmentV, -0.004, 0.004) * Texture::height : 0.0;
+    bool misaligned = dx != 0.0 || dy != 0.0;
+
+    // Cut out the visible area plus the texels the shifted channels reach
+    isize x1 = std::clamp(isize(std::floor(x - std::abs(dx))), isize(0), isize(Texture::width - 1));
+    isize y1 = std::clamp(isize(std::floor(y - std::abs(dy))), isize(0), isize(Texture::height - 1));
+    isize x2 = std::clamp(isize(std::ceil(x + w + std::abs(dx))), x1 + 1, isize(Texture::width));
+    isize y2 = std::clamp(isize(std::ceil(y + h + std::abs(dy))), y1 + 1, isize(Texture::height));
+
+    bool blurring = config.blur && config.blurRadius > 0 && level < maxLevel;
+    bool blooming = config.bloom && level < maxLevel;
+
+    /* The Metal renderer blurs a texture which has been upscaled by four. We
+     * do the same at full quality, but skip the extra resolution if the
+     * upscaler does not require it and no blur filter is applied.
+     */
+    isize native = config.upscaler == Upscaler::XBR_4X ? 4 : config.upscaler == Upscaler::EPX_2X ? 2 : 1;
+    isize factor = blurring && level == 0 ? 4 : native;
+
+    upscale(texture, config.upscaler, x1, y1, x2 - x1, y2 - y1, factor);
+    elapsed[UPSCALE] = clock.restart().asSeconds();
+
+    if (blurring) {
+        blur(upscaled, upscaledWidth, upscaledHeight, map(config.blurRadius, 0.0, 5.0) * double(factor) / 4.0);
+    }
+    elapsed[BLUR] = clock.restart().asSeconds();
+
+    if (blooming) {
+        computeBloom(texture, config, x1, y1, x2 - x1, y2 - y1);
+    }
+    elapsed[BLOOM] = clock.restart().asSeconds();
+
+    // Map the frame coordinates to the intermediate buffers
+    frameWidth = width;
+    frameHeight = height;
+    frame.resize(width * height);
+
+    for (isize c = 0; c < 3; c++) {
+
+        auto ox = double(1 - c) * dx;
+        auto oy = double(1 - c) * dy;
+
+        columns[c].resize(width);
+        for (isize i = 0; i < width; i++) {
+
+            auto tx = x + (double(i) + 0.5) * w / double(width) + ox;
+            auto pos = isize(std::floor((tx - double(x1)) * double(factor)));
+            columns[c][i] = i32(std::clamp(pos, isize(0), upscaledWidth - 1));
+        }
+
+        rows[c].resize(height);
+        for (isize i = 0; i < height; i++) {
+
+            auto ty = y + (double(i) + 0.5) * h / double(height) + oy;
+            auto pos = isize(std::floor((ty - double(y1)) * double(factor)));
+            rows[c][i] = i32(std::clamp(pos, isize(0), upscaledHeight - 1));
+        }
+    }
+
+    bloomColumns.clear();
+    bloomRows.clear();
+
+    if (blooming) {
+
+        bloomColumns.resize(width);
+        for (isize i = 0; i < width; i++) {
+
+            auto tx = x + (double(i) + 0.5) * w / double(width);
+            bloomColumns[i] = i32(std::clamp(isize(tx) - x1, isize(0), x2 - x1 - 1));
+        }
+
+        bloomRows.resize(height);
+        for (isize i = 0; i < height; i++) {
+
+            auto ty = y + (double(i) + 0.5) * h / double(height);
+            bloomRows[i] = i32(std::clamp(isize(ty) - y1, isize(0), y2 - y1 - 1));
+        }
+    }
+
+    // Compute the scanline intensities
+    embedded.clear();
+    superimposed.clear();
+
+    if (config.scanlines == Scanlines::EMBEDDED) {
+
+        // Two out of four rows of the upscaled texture are darkened
+        auto dark = fixed(map(config.scanlineBrightness, 0.0, 1.0));
+
+        embedded.resize(height);
+        for (isize i = 0; i < height; i++) {
+
+            auto ty = y + (double(i) + 0.5) * h / double(height);
+            auto row = isize(std::floor(ty * 4.0));
+            embedded[i] = (row + 1) % 4 < 2 ? dark : 256;
+        }
+    }
+
+    if (config.scanlines == Scanlines::SUPERIMPOSE && height / 256 >= 2) {
+
+        auto distance = height / 256;
+        auto weight = map(config.scanlineWeight, 0.0, 1.0);
+        auto brightness = map(config.scanlineBrightness, 0.0, 1.0);
+
+        superimposed.resize(height);
+        for (isize i = 0; i < height; i++) {
+
+            auto d = double(i % distance) / double(distance - 1) - 0.5;
+            superimposed[i] = fixed(std::max(1.0 - d * d * 24.0 * weight, brightness));
+        }
+    }
+
+    computeDotmask(config, width);
+
+    compose(misaligned);
+    elapsed[COMPOSE] = clock.restart().asSeconds();
+
+    adjustLevel();
+    return frame.data();
+}
+
+void
+PostProcessor::parallel(isize count, const std::function<void(isize, isize)> &func)
+{
+    if (threads <= 1 || count < 2) { func(0, count); return; }
+
+    if (!pool) pool = std::make_unique<utl::WorkerPool>(threads - 1);
+
+    // Use more bands than threads to balance the load
+    auto bands = std::min(count, 4 * threads);
+    pool->run(bands, [&](isize i) { func(i * count / bands, (i + 1) * count / bands); });
+}
+
+void
+PostProcessor::upscale(const Texture &texture, Upscaler upscaler,
+                       isize x, isize y, isize w, isize h, isize factor)
+{
+    upscaledWidth = w * factor;
+    upscaledHeight = h * factor;
+    upscaled.resize(upscaledWidth * upscaledHeight);
+
+    // Reads a texel, clamping the coordinates to the texture area
+    auto texel = [&](isize tx, isize ty) {
+
+        tx = std::clamp(tx, isize(0), isize(Texture::width - 1));
+        ty = std::clamp(ty, isize(0), isize(Texture::height - 1));
+        return texture.pixels.ptr[ty * Texture::width + tx];
+    };
+
+    // Fills a square block of the upscaled buffer
+    auto fill = [&](isize bx, isize by, isize size, u32 color) {
+
+        for (isize j = 0; j < size; j++) {
+
+            auto *dst = upscaled.data() + (by + j) * upscaledWidth + bx;
+            for (isize i = 0; i < size; i++) dst[i] = color;
+        }
+    };
+
+    switch (upscaler) {
+
+        case Upscaler::EPX_2X:
+
+            // Eric's Pixel Expansion
+            parallel(h, [&](isize first, isize last) {
+
+                auto size = factor / 2;
+
+                for (isize j = first; j < last; j++) {
+                    for (isize i = 0; i < w; i++) {
+
+                        auto P = texel(x + i, y + j);
+                        auto A = texel(x + i, y + j - 1);
+                        auto B = texel(x + i + 1, y + j);
+                        auto C = texel(x + i - 1, y + j);
+                        auto D = texel(x + i, y + j + 1);
+
+                        auto r1 = C == A && C != D && A != B ? A : P;
+                        auto r2 = A == B && A != C && B != D ? B : P;
+                        auto r3 = D == C && D != B && C != A ? C : P;
+                        auto r4 = B == D && B != A && D != C ? D : P;
+
+                        fill(i * factor, j * factor, size, r1);
+                        fill(i * factor + size, j * factor, size, r2);
+                        fill(i * factor, j * factor + size, size, r3);
+                        fill(i * factor + size, j * factor + size, size, r4);
+                    }
+                }
+            });
+            break;
+
+        case Upscaler::XBR_4X:
+
+            // xBR upscaler (ported from the Metal shader)
+            parallel(h, [&](isize first, isize last) {
+
+                // Coefficients of the straight lines below which interpolation occurs
+                static constexpr float Ao[4] = { 1.0f, -1.0f, -1.0f, 1.0f };
+                static constexpr float Bo[4] = { 1.0f, 1.0f, -1.0f, -1.0f };
+                static constexpr float Co[4] = { 1.5f, 0.5f, -0.5f, 0.5f };
+                static constexpr float Bx[4] = { 0.5f, 2.0f, -0.5f, -2.0f };
+                static constexpr float Cx[4] = { 1.0f, 1.0f, -0.5f, 0.0f };
+                static constexpr float By[4] = { 2.0f, 0.5f, -2.0f, -0.5f };
+                static constexpr float Cy[4] = { 2.0f, 0.0f, -1.0f, 0.5f };
+
+                for (isize j = first; j < last; j++) {
+                    for (isize i = 0; i < w; i++) {
+
+                        auto tx = x + i, ty = y + j;
+
+                        u32 B = texel(tx, ty - 1), D = texel(tx - 1, ty);
+                        u32 F = texel(tx + 1, ty), H = texel(tx, ty + 1);
+                        u32 E = texel(tx, ty);
+
+                        float b[4] = { luma(B), luma(D), luma(H), luma(F) };
+                        float c[4] = {
+                            luma(texel(tx + 1, ty - 1)), luma(texel(tx - 1, ty - 1)),
+                            luma(texel(tx - 1, ty + 1)), luma(texel(tx + 1, ty + 1)) };
+                        float i4[4] = {
+                            luma(texel(tx + 2, ty + 1)), luma(texel(tx + 1, ty - 2)),
+                            luma(texel(tx - 2, ty - 1)), luma(texel(tx - 1, ty + 2)) };
+                        float i5[4] = {
+                            luma(texel(tx + 1, ty + 2)), luma(texel(tx + 2, ty - 1)),
+                            luma(texel(tx - 1, ty - 2)), luma(texel(tx - 2, ty + 1)) };
+                        float h5[4] = {
+                            luma(texel(tx, ty + 2)), luma(texel(tx + 2, ty)),
+                            luma(texel(tx, ty - 2)), luma(texel(tx - 2, ty)) };
+                        float e = luma(E);
+
+                        // Evaluate the edge detection rules for all four directions
+                        bool edr[4], edrLeft[4], edrUp[4], px[4];
+
+                        for (isize k = 0; k < 4; k++) {
+
+                            auto d = b[(k + 1) % 4], f = b[(k + 3) % 4], hh = b[(k + 2) % 4];
+                            auto g = c[(k + 2) % 4], ii = c[(k + 3) % 4], f4 = h5[(k + 1) % 4];
+
+                            auto w1 = std::abs(e - c[k]) + std::abs(e - g) + std::abs(ii - h5[k]) +
+                            std::abs(ii - f4) + 4.0f * std::abs(hh - f);
+                            auto w2 = std::abs(hh - d) + std::abs(hh - i5[k]) + std::abs(f - i4[k]) +
+                            std::abs(f - b[k]) + 4.0f * std::abs(e - ii);
+
+                            auto dfg = std::abs(f - g);
+                            auto dhc = std::abs(hh - c[k]);
+
+                            edr[k] = w1 < w2 && e != f && e != hh;
+                            edrLeft[k] = 2.0f * dfg <= dhc && e != g && d != g;
+                            edrUp[k] = 2.0f * dhc <= dfg && e != c[k] && b[k] != c[k];
+                            px[k] = std::abs(e - f) <= std::abs(e - hh);
+                        }
+
+                        const u32 choice[4] = { px[0] ? F : H, px[1] ? B : F, px[2] ? D : B, px[3] ? H : D };
+
+                        // Interpolate the 16 subpixels
+                        for (isize sy = 0; sy < 4; sy++) {
+
+                            auto *dst = upscaled.data() + (j * 4 + sy) * upscaledWidth + i * 4;
+
+                            for (isize sx = 0; sx < 4; sx++) {
+
+                                auto fx = float(sx) / 4.0f, fy = float(sy) / 4.0f;
+                                auto color = E;
+
+                                for (isize k = 0; k < 4; k++) {
+
+                                    bool fxo = Ao[k] * fy + Bo[k] * fx > Co[k];
+                                    // Ax and Ay of the shader are identical to Ao
+                                    bool fxl = Ao[k] * fy + Bx[k] * fx > Cx[k];
+                                    bool fxu = Ao[k] * fy + By[k] * fx > Cy[k];
+
+                                    if (edr[k] && (fxo || (edrLeft[k] && fxl) || (edrUp[k] && fxu))) {
+
+                                        color = choice[k];
+                                        break;
+                                    }
+                                }
+                                dst[sx] = color | 0xFF000000;
+                            }
+                        }
+                    }
+                }
+            });
+            break;
+
+        default:
+
+            parallel(h, [&](isize first, isize last) {
+
+                for (isize j = first; j < last; j++) {
+
+                    auto *src = texture.pixels.ptr + (y + j) * Texture::width + x;
+                    auto *dst = upscaled.data() + j * factor * upscaledWidth;
+
+                    for (isize i = 0; i < w; i++) {
+                        for (isize k = 0; k < factor; k++) dst[i * factor + k] = src[i];
+                    }
+                    for (isize k = 1; k < factor; k++) {
+                        std::memcpy(dst + k * upscaledWidth, dst, upscaledWidth * sizeof(u32));
+                    }
+                }
+            });
+            break;
+    }
+}
+
+void
+PostProcessor::blur(std::vector<u32> &buffer, isize width, isize height, double sigma)
+{
+    auto radius = isize(std::ceil(3.0 * sigma));
+    if (radius == 0 || sigma < 0.1) return;
+
+    // Compute the filter kernel in fixed point arithmetic
+    std::vector<double> gauss(2 * radius + 1);
+    double sum = 0.0;
+    for (isize k = -radius; k <= radius; k++) {
+        sum += gauss[k + radius] = std::exp(-double(k * k) / (2.0 * sigma * sigma));
+    }
+
+    std::vector<u16> weights(2 * radius + 1);
+    isize total = 0;
+    for (isize k = 0; k < isize(weights.size()); k++) {
+        if (k != radius) total += weights[k] = u16(std::lround(256.0 * gauss[k] / sum));
+    }
+    weights[radius] = u16(std::max(isize(0), 256 - total));
+
+    // Drop the outermost taps if their weights have vanished
+    isize skip = 0;
+    while (skip < radius && weights[skip] == 0) skip++;
+
+    auto taps = isize(weights.size()) - 2 * skip;
+    auto *w = weights.data() + skip;
+    radius -= skip;
+
+    scratch.resize(buffer.size());
+
+    // Horizontal pass
+    parallel(height, [&](isize first, isize last) {
+
+        std::vector<u32> padded(width + 2 * radius);
+        std::vector<const u8 *> src(taps);
+
+        for (isize k = 0; k < taps; k++) src[k] = (const u8 *)(padded.data() + k);
+
+        for (isize y = first; y < last; y++) {
+
+            auto *row = buffer.data() + y * width;
+
+            std::fill(padded.begin(), padded.begin() + radius, row[0]);
+            std::copy(row, row + width, padded.begin() + radius);
+            std::fill(padded.end() - radius, padded.end(), row[width - 1]);
+
+            video::weigh(src.data(), w, taps, 4 * width, (u8 *)(scratch.data() + y * width));
+        }
+    });
+
+    // Vertical pass
+    parallel(height, [&](isize first, isize last) {
+
+        std::vector<const u8 *> src(taps);
+
+        for (isize y = first; y < last; y++) {
+
+            for (isize k = 0; k < taps; k++) {
+
+                auto row = std::clamp(y + k - radius, isize(0), height - 1);
+                src[k] = (const u8 *)(scratch.data() + row * width);
+            }
+            video::weigh(src.data(), w, taps, 4 * width, (u8 *)(buffer.data() + y * width));
+        }
+    });
+}
+
+void
+PostProcessor::computeBloom(const Texture &texture, const MonitorConfig &config,
+                            isize x, isize y, isize w, isize h)
+{
+    bloomWidth = w;
+    bloom.resize(w * h);
+
+    for (isize j = 0; j < h; j++) {
+
+        auto *src = texture.pixels.ptr + (y + j) * Texture::width + x;
+        std::copy(src, src + w, bloom.data() + j * w);
+    }
+
+    // The Metal renderer blurs the texture at its original resolution
+    blur(bloom, w, h, map(config.bloomRadius, 0.0, 5.0));
+
+    // Apply the bloom curve
+    auto weight = map(config.bloomWeight, 0.0, 3.0);
+    auto brightness = map(config.bloomBrightness, 0.0, 2.0);
+
+    u8 curve[256];
+    for (isize i = 0; i < 256; i++) {
+
+        auto value = std::pow(double(i) / 255.0, weight) * brightness;
+        curve[i] = u8(std::lround(std::clamp(value, 0.0, 1.0) * 255.0));
+    }
+
+    parallel(h, [&](isize first, isize last) {
+
+        for (isize i = first * w; i < last * w; i++) {
+
+            auto *p = (u8 *)(bloom.data() + i);
+            p[0] = curve[p[0]];
+            p[1] = curve[p[1]];
+            p[2] = curve[p[2]];
+            p[3] = 0;
+        }
+    });
+}
+
+void
+PostProcessor::computeDotmask(const MonitorConfig &config, isize width)
+{
+    // Dot mask patterns (see RessourceManager.swift)
+    struct Pattern { isize width; isize height; const char *data; };
+
+    static constexpr Pattern patterns[] = {
+
+        { 1, 1, "W" },
+        { 3, 1, "MGN" },
+        { 4, 1, "RGBN" },
+        { 3, 9, "MGNMGNNNNNMGNMGNNNGNMGNMNNN" },
+        { 4, 8, "RGBNRGBNRGBNNNNNBNRGBNRGBNRGNNNN" }
+    };
+
+    dotmask.clear();
+    if (config.dotmask == Dotmask::NONE) return;
+
+    auto &pattern = patterns[isize(config.dotmask)];
+    auto brightness = map(config.dotMaskBrightness, 0.0, 1.0);
+
+    auto max = u8(85 + brightness * 170);
+    auto base = u8((1 - brightness) * 85);
+    auto none = u8(30 + (1 - brightness) * 55);
+
+    // Converts a mask color into a coefficient for the shade kernel
+    auto coefficient = [](u8 value) {
+        return i16(std::lround((1.5 * double(value) / 255.0 - 0.5) * 256.0));
+    };
+
+    dotmask.resize(pattern.height);
+    for (isize j = 0; j < pattern.height; j++) {
+
+        auto &row = dotmask[j];
+        row.resize(4 * width);
+
+        for (isize i = 0; i < width; i++) {
+
+            u8 r = base, g = base, b = base;
+
+            switch (pattern.data[j * pattern.width + i % pattern.width]) {
+
+                case 'R': r = max; break;
+                case 'G': g = max; break;
+                case 'B': b = max; break;
+                case 'M': r = b = max; break;
+                case 'W': r = g = b = max; break;
+                default:  r = g = b = none; break;
+            }
+
+            row[4 * i + 0] = coefficient(r);
+            row[4 * i + 1] = coefficient(g);
+            row[4 * i + 2] = coefficient(b);
+            row[4 * i + 3] = 0;
+        }
+    }
+}
+
+void
+PostProcessor::compose(bool misaligned)
+{
+    parallel(frameHeight, [&](isize first, isize last) {
+
+        std::vector<u32> red(misaligned ? frameWidth : 0);
+        std::vector<u32> blue(misaligned ? frameWidth : 0);
+        std::vector<u32> glow(bloomRows.empty() ? 0 : frameWidth);
+
+        for (isize y = first; y < last; y++) {
+
+            auto *dst = frame.data() + y * frameWidth;
+
+            // Sample the upscaled texture
+            if (misaligned) {
+
+                video::gather(upscaled.data() + rows[0][y] * upscaledWidth, columns[0].data(), frameWidth, red.data());
+                video::gather(upscaled.data() + rows[1][y] * upscaledWidth, columns[1].data(), frameWidth, dst);
+                video::gather(upscaled.data() + rows[2][y] * upscaledWidth, columns[2].data(), frameWidth, blue.data());
+                video::combine(red.data(), dst, blue.data(), frameWidth, dst);
+
+            } else {
+
+                video::gather(upscaled.data() + rows[1][y] * upscaledWidth, columns[1].data(), frameWidth, dst);
+            }
+
+            // Apply the effects in the order of the Metal renderer
+            if (!embedded.empty() && embedded[y] != 256) {
+                video::attenuate(dst, embedded[y], frameWidth);
+            }
+            if (!bloomRows.empty()) {
+
+                video::gather(bloom.data() + bloomRows[y] * bloomWidth, bloomColumns.data(), frameWidth, glow.data());
+                video::brighten((u8 *)dst, (const u8 *)glow.data(), 4 * frameWidth);
+            }
+            if (!superimposed.empty() && superimposed[y] != 256) {
+                video::attenuate(dst, superimposed[y], frameWidth);
+            }
+            if (!dotmask.empty()) {
+                video::shade((u8 *)dst, dotmask[y % dotmask.size()].data(), 4 * frameWidth);
+            }
+        }
+    });
+}
+
+void
+PostProcessor::adjustLevel()
+{
+    if (budget <= 0.0) { level = 0; return; }
+
+    double total = 0.0;
+    for (isize i = 0; i < STAGE_COUNT; i++) total += elapsed[i];
+
+    if (total > budget) {
+        level = std::min(level + 1, maxLevel);
+    } else if (total < 0.5 * budget && level > 0) {
+        level--;
+    }
+}
+
+}
@@ -0,0 +1,142 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "MonitorTypes.h"
+#include "Texture.h"
+#include "utl/concurrency/WorkerPool.h"
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace vc64 {
+
+/* Software implementation of the monitor effects.
+ *
+ * The post processor mimics the Metal renderer of the GUI. It cuts out the
+ * visible area of the emulator texture, upscales and blurs it, and composes
+ * the final frame by adding bloom, scanlines, a dot mask, and a misalignment
+ * of the color channels. The result is an RGBA frame of arbitrary size.
+ *
+ * Each stage processes horizontal bands of its output buffer which are
+ * distributed among a pool of worker threads. If a frame exceeds the time
+ * budget, the quality of the next frame is reduced by blurring at a lower
+ * resolution first and by skipping blur and bloom altogether later.
+ */
+class PostProcessor {
+
+public:
+
+    // Processing stages
+    enum Stage { UPSCALE, BLUR, BLOOM, COMPOSE, STAGE_COUNT };
+
+    // Lowest quality level (skips blur and bloom)
+    static constexpr isize maxLevel = 2;
+
+private:
+
+    // Worker threads (created on first use)
+    std::unique_ptr<utl::WorkerPool> pool;
+
+    // Number of threads (including the calling thread)
+    isize threads;
+
+    // Upscaled (and blurred) cutout of the emulator texture
+    std::vector<u32> upscaled;
+    isize upscaledWidth = 0;
+    isize upscaledHeight = 0;
+
+    // Blurred cutout at the original resolution, used for the bloom effect
+    std::vector<u32> bloom;
+    isize bloomWidth = 0;
+
+    // Intermediate buffer of the separable Gaussian filter
+    std::vector<u32> scratch;
+
+    // The final frame
+    std::vector<u32> frame;
+    isize frameWidth = 0;
+    isize frameHeight = 0;
+
+    // Source positions of each frame column and row (red, green, blue)
+    std::vector<i32> columns[3];
+    std::vector<i32> rows[3];
+
+    // Source positions of each frame column and row in the bloom buffer
+    std::vector<i32> bloomColumns;
+    std::vector<i32> bloomRows;
+
+    // Scanline intensity of each frame row (embedded and superimposed)
+    std::vector<u16> embedded;
+    std::vector<u16> superimposed;
+
+    // Dot mask coefficients, one row of frame width per mask row
+    std::vector<std::vector<i16>> dotmask;
+
+public:
+
+    // Time budget per frame in seconds (0 = unlimited)
+    double budget = 0.0;
+
+    // Current quality level (0 = full quality)
+    isize level = 0;
+
+    // Time spent in each stage during the most recent frame in seconds
+    double elapsed[STAGE_COUNT] = { };
+
+
+    //
+    // Methods
+    //
+
+public:
+
+    explicit PostProcessor(isize threads = 0);
+
+    /* Applies the monitor effects to an emulator texture and returns a frame
+     * with the specified dimensions. The returned buffer is valid until this
+     * function is called again.
+     */
+    const u32 *apply(const Texture &texture, const MonitorConfig &config,
+                     bool pal, isize width, isize height);
+
+    // Returns the number of threads the stages are distributed among
+    isize getThreads() const { return threads; }
+
+private:
+
+    // Runs func(first, last) for multiple bands covering rows [0; count)
+    void parallel(isize count, const std::function<void(isize, isize)> &func);
+
+    // Cuts out a texture area and scales it by the given factor
+    void upscale(const Texture &texture, Upscaler upscaler,
+                 isize x, isize y, isize w, isize h, isize factor);
+
+    // Applies a Gaussian filter to a buffer
+    void blur(std::vector<u32> &buffer, isize width, isize height, double sigma);
+
+    // Computes the bloom buffer
+    void computeBloom(const Texture &texture, const MonitorConfig &config,
+                      isize x, isize y, isize w, isize h);
+
+    // Computes the dot mask coefficients
+    void computeDotmask(const MonitorConfig &config, isize width);
+
+    // Composes the final frame
+    void compose(bool misaligned);
+
+    // Adjusts the quality level to the time spent for the most recent frame
+    void adjustLevel();
+};
+
+}
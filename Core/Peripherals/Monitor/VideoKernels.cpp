@@ -0,0 +1,361 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "VideoKernels.h"
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace vc64::video {
+
+void
+weigh(const u8 *const *src, const u16 *weights, isize taps, isize n, u8 *dst)
+{
+    isize i = 0;
+
+    /* All sums are computed in 16 bit. They cannot overflow, because the
+     * weights add up to 256 and the largest sum is 255 * 256 + 128.
+     */
+
+#if defined(__AVX2__)
+
+    for (; i + 32 <= n; i += 32) {
+
+        auto lo = _mm256_set1_epi16(128);
+        auto hi = _mm256_set1_epi16(128);
+
+        for (isize k = 0; k < taps; k++) {
+
+            auto v = _mm256_loadu_si256((const __m256i *)(src[k] + i));
+            auto w = _mm256_set1_epi16(short(weights[k]));
+
+            lo = _mm256_add_epi16(lo, _mm256_mullo_epi16(_mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)), w));
+            hi = _mm256_add_epi16(hi, _mm256_mullo_epi16(_mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)), w));
+        }
+
+        // The pack instruction operates on each 128-bit lane separately
+        auto v = _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_permute4x64_epi64(v, 0xD8));
+    }
+
+#elif defined(__SSE2__)
+
+    auto zero = _mm_setzero_si128();
+
+    for (; i + 16 <= n; i += 16) {
+
+        auto lo = _mm_set1_epi16(128);
+        auto hi = _mm_set1_epi16(128);
+
+        for (isize k = 0; k < taps; k++) {
+
+            auto v = _mm_loadu_si128((const __m128i *)(src[k] + i));
+            auto w = _mm_set1_epi16(short(weights[k]));
+
+            lo = _mm_add_epi16(lo, _mm_mullo_epi16(_mm_unpacklo_epi8(v, zero), w));
+            hi = _mm_add_epi16(hi, _mm_mullo_epi16(_mm_unpackhi_epi8(v, zero), w));
+        }
+
+        auto v = _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+        _mm_storeu_si128((__m128i *)(dst + i), v);
+    }
+
+#elif defined(__ARM_NEON)
+
+    for (; i + 16 <= n; i += 16) {
+
+        auto lo = vdupq_n_u16(128);
+        auto hi = vdupq_n_u16(128);
+
+        for (isize k = 0; k < taps; k++) {
+
+            auto v = vld1q_u8(src[k] + i);
+
+            lo = vmlaq_n_u16(lo, vmovl_u8(vget_low_u8(v)), weights[k]);
+            hi = vmlaq_n_u16(hi, vmovl_u8(vget_high_u8(v)), weights[k]);
+        }
+
+        vst1q_u8(dst + i, vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8)));
+    }
+
+#endif
+
+    for (; i < n; i++) {
+
+        u32 sum = 128;
+        for (isize k = 0; k < taps; k++) sum += weights[k] * src[k][i];
+        dst[i] = u8(sum >> 8);
+    }
+}
+
+void
+gather(const u32 *src, const i32 *map, isize n, u32 *dst)
+{
+    isize i = 0;
+
+#if defined(__AVX2__)
+
+    for (; i + 8 <= n; i += 8) {
+
+        auto index = _mm256_loadu_si256((const __m256i *)(map + i));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_i32gather_epi32((const int *)src, index, 4));
+    }
+
+#endif
+
+    for (; i < n; i++) dst[i] = src[map[i]];
+}
+
+void
+combine(const u32 *r, const u32 *g, const u32 *b, isize n, u32 *dst)
+{
+    isize i = 0;
+
+#if defined(__AVX2__)
+
+    auto mr = _mm256_set1_epi32(0x000000FF);
+    auto mg = _mm256_set1_epi32(0x0000FF00);
+    auto mb = _mm256_set1_epi32(0x00FF0000);
+    auto ma = _mm256_set1_epi32(int(0xFF000000));
+
+    for (; i + 8 <= n; i += 8) {
+
+        auto vr = _mm256_and_si256(_mm256_loadu_si256((const __m256i *)(r + i)), mr);
+        auto vg = _mm256_and_si256(_mm256_loadu_si256((const __m256i *)(g + i)), mg);
+        auto vb = _mm256_and_si256(_mm256_loadu_si256((const __m256i *)(b + i)), mb);
+
+        auto v = _mm256_or_si256(_mm256_or_si256(vr, vg), _mm256_or_si256(vb, ma));
+        _mm256_storeu_si256((__m256i *)(dst + i), v);
+    }
+
+#elif defined(__SSE2__)
+
+    auto mr = _mm_set1_epi32(0x000000FF);
+    auto mg = _mm_set1_epi32(0x0000FF00);
+    auto mb = _mm_set1_epi32(0x00FF0000);
+    auto ma = _mm_set1_epi32(int(0xFF000000));
+
+    for (; i + 4 <= n; i += 4) {
+
+        auto vr = _mm_and_si128(_mm_loadu_si128((const __m128i *)(r + i)), mr);
+        auto vg = _mm_and_si128(_mm_loadu_si128((const __m128i *)(g + i)), mg);
+        auto vb = _mm_and_si128(_mm_loadu_si128((const __m128i *)(b + i)), mb);
+
+        auto v = _mm_or_si128(_mm_or_si128(vr, vg), _mm_or_si128(vb, ma));
+        _mm_storeu_si128((__m128i *)(dst + i), v);
+    }
+
+#elif defined(__ARM_NEON)
+
+    auto mr = vdupq_n_u32(0x000000FF);
+    auto mg = vdupq_n_u32(0x0000FF00);
+    auto mb = vdupq_n_u32(0x00FF0000);
+    auto ma = vdupq_n_u32(0xFF000000);
+
+    for (; i + 4 <= n; i += 4) {
+
+        auto vr = vandq_u32(vld1q_u32(r + i), mr);
+        auto vg = vandq_u32(vld1q_u32(g + i), mg);
+        auto vb = vandq_u32(vld1q_u32(b + i), mb);
+
+        vst1q_u32(dst + i, vorrq_u32(vorrq_u32(vr, vg), vorrq_u32(vb, ma)));
+    }
+
+#endif
+
+    for (; i < n; i++) {
+        dst[i] = (r[i] & 0x000000FF) | (g[i] & 0x0000FF00) | (b[i] & 0x00FF0000) | 0xFF000000;
+    }
+}
+
+void
+attenuate(u32 *texels, u16 factor, isize n)
+{
+    isize i = 0;
+    auto *bytes = (u8 *)texels;
+    auto f = short(factor);
+
+    // The alpha channel is multiplied by 256 / 256
+
+#if defined(__AVX2__)
+
+    auto w = _mm256_set_epi16(256, f, f, f, 256, f, f, f, 256, f, f, f, 256, f, f, f);
+
+    for (; i + 8 <= n; i += 8) {
+
+        auto v = _mm256_loadu_si256((const __m256i *)(bytes + 4 * i));
+        auto lo = _mm256_mullo_epi16(_mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)), w);
+        auto hi = _mm256_mullo_epi16(_mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)), w);
+
+        v = _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+        _mm256_storeu_si256((__m256i *)(bytes + 4 * i), _mm256_permute4x64_epi64(v, 0xD8));
+    }
+
+#elif defined(__SSE2__)
+
+    auto zero = _mm_setzero_si128();
+    auto w = _mm_set_epi16(256, f, f, f, 256, f, f, f);
+
+    for (; i + 4 <= n; i += 4) {
+
+        auto v = _mm_loadu_si128((const __m128i *)(bytes + 4 * i));
+        auto lo = _mm_mullo_epi16(_mm_unpacklo_epi8(v, zero), w);
+        auto hi = _mm_mullo_epi16(_mm_unpackhi_epi8(v, zero), w);
+
+        v = _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+        _mm_storeu_si128((__m128i *)(bytes + 4 * i), v);
+    }
+
+#elif defined(__ARM_NEON)
+
+    const u16 pattern[8] = { factor, factor, factor, 256, factor, factor, factor, 256 };
+    auto w = vld1q_u16(pattern);
+
+    for (; i + 4 <= n; i += 4) {
+
+        auto v = vld1q_u8(bytes + 4 * i);
+        auto lo = vmulq_u16(vmovl_u8(vget_low_u8(v)), w);
+        auto hi = vmulq_u16(vmovl_u8(vget_high_u8(v)), w);
+
+        vst1q_u8(bytes + 4 * i, vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8)));
+    }
+
+#endif
+
+    for (; i < n; i++) {
+
+        auto *p = bytes + 4 * i;
+        for (isize c = 0; c < 3; c++) p[c] = u8((p[c] * factor) >> 8);
+    }
+}
+
+void
+brighten(u8 *dst, const u8 *src, isize n)
+{
+    isize i = 0;
+
+#if defined(__AVX2__)
+
+    for (; i + 32 <= n; i += 32) {
+
+        auto a = _mm256_loadu_si256((const __m256i *)(dst + i));
+        auto b = _mm256_loadu_si256((const __m256i *)(src + i));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_adds_epu8(a, b));
+    }
+
+#elif defined(__SSE2__)
+
+    for (; i + 16 <= n; i += 16) {
+
+        auto a = _mm_loadu_si128((const __m128i *)(dst + i));
+        auto b = _mm_loadu_si128((const __m128i *)(src + i));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_adds_epu8(a, b));
+    }
+
+#elif defined(__ARM_NEON)
+
+    for (; i + 16 <= n; i += 16) {
+        vst1q_u8(dst + i, vqaddq_u8(vld1q_u8(dst + i), vld1q_u8(src + i)));
+    }
+
+#endif
+
+    for (; i < n; i++) dst[i] = u8(std::min(dst[i] + src[i], 255));
+}
+
+void
+shade(u8 *dst, const i16 *coefficients, isize n)
+{
+    isize i = 0;
+
+    /* The products fit into 16 bit, because m is at most 127 and all
+     * coefficients are within [-256; 256].
+     */
+
+#if defined(__AVX2__)
+
+    auto max = _mm256_set1_epi16(255);
+
+    for (; i + 32 <= n; i += 32) {
+
+        auto v = _mm256_loadu_si256((const __m256i *)(dst + i));
+        auto lo = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v));
+        auto hi = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1));
+        auto klo = _mm256_loadu_si256((const __m256i *)(coefficients + i));
+        auto khi = _mm256_loadu_si256((const __m256i *)(coefficients + i + 16));
+        auto mlo = _mm256_min_epi16(lo, _mm256_sub_epi16(max, lo));
+        auto mhi = _mm256_min_epi16(hi, _mm256_sub_epi16(max, hi));
+
+        lo = _mm256_add_epi16(lo, _mm256_srai_epi16(_mm256_mullo_epi16(mlo, klo), 8));
+        hi = _mm256_add_epi16(hi, _mm256_srai_epi16(_mm256_mullo_epi16(mhi, khi), 8));
+
+        v = _mm256_packus_epi16(lo, hi);
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_permute4x64_epi64(v, 0xD8));
+    }
+
+#elif defined(__SSE2__)
+
+    auto zero = _mm_setzero_si128();
+    auto max = _mm_set1_epi16(255);
+
+    for (; i + 16 <= n; i += 16) {
+
+        auto v = _mm_loadu_si128((const __m128i *)(dst + i));
+        auto lo = _mm_unpacklo_epi8(v, zero);
+        auto hi = _mm_unpackhi_epi8(v, zero);
+        auto klo = _mm_loadu_si128((const __m128i *)(coefficients + i));
+        auto khi = _mm_loadu_si128((const __m128i *)(coefficients + i + 8));
+        auto mlo = _mm_min_epi16(lo, _mm_sub_epi16(max, lo));
+        auto mhi = _mm_min_epi16(hi, _mm_sub_epi16(max, hi));
+
+        lo = _mm_add_epi16(lo, _mm_srai_epi16(_mm_mullo_epi16(mlo, klo), 8));
+        hi = _mm_add_epi16(hi, _mm_srai_epi16(_mm_mullo_epi16(mhi, khi), 8));
+
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(lo, hi));
+    }
+
+#elif defined(__ARM_NEON)
+
+    auto max = vdupq_n_s16(255);
+
+    for (; i + 16 <= n; i += 16) {
+
+        auto v = vld1q_u8(dst + i);
+        auto lo = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(v)));
+        auto hi = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(v)));
+        auto mlo = vminq_s16(lo, vsubq_s16(max, lo));
+        auto mhi = vminq_s16(hi, vsubq_s16(max, hi));
+
+        lo = vaddq_s16(lo, vshrq_n_s16(vmulq_s16(mlo, vld1q_s16(coefficients + i)), 8));
+        hi = vaddq_s16(hi, vshrq_n_s16(vmulq_s16(mhi, vld1q_s16(coefficients + i + 8)), 8));
+
+        vst1q_u8(dst + i, vcombine_u8(vqmovun_s16(lo), vqmovun_s16(hi)));
+    }
+
+#endif
+
+    for (; i < n; i++) {
+
+        int c = dst[i];
+        int m = std::min(c, 255 - c);
+        dst[i] = u8(std::clamp(c + ((m * coefficients[i]) >> 8), 0, 255));
+    }
+}
+
+}
@@ -0,0 +1,52 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "BasicTypes.h"
+
+namespace vc64::video {
+
+/* Row-based kernels of the post-processing pipeline.
+ *
+ * The kernels operate on rows of RGBA texels stored as four consecutive bytes
+ * (red, green, blue, alpha) and are vectorized with AVX2, SSE2, or NEON,
+ * depending on the instruction sets enabled at compile time. On all other
+ * platforms, a scalar implementation is used. All computations are carried
+ * out in fixed-point arithmetic, so all implementations produce identical
+ * results.
+ */
+
+/* Computes the weighted sum of n bytes taken from multiple source rows. The
+ * weights are given in units of 1/256 and must add up to 256.
+ */
+void weigh(const u8 *const *src, const u16 *weights, isize taps, isize n, u8 *dst);
+
+// Copies n texels picked from the positions stored in map
+void gather(const u32 *src, const i32 *map, isize n, u32 *dst);
+
+// Composes n texels from the red, green, and blue channel of three rows
+void combine(const u32 *r, const u32 *g, const u32 *b, isize n, u32 *dst);
+
+// Scales the color channels of n texels by factor / 256 (factor <= 256)
+void attenuate(u32 *texels, u16 factor, isize n);
+
+// Adds n bytes with saturation
+void brighten(u8 *dst, const u8 *src, isize n);
+
+/* Moves n bytes towards the nearest extreme value by coefficient / 256. With
+ * m = min(c, 255 - c), each byte c is replaced by c + (m * coefficient) / 256.
+ * Coefficients must be within [-256; 256].
+ */
+void shade(u8 *dst, const i16 *coefficients, isize n);
+
+}
@@ -12,6 +12,7 @@
 
 #include "config.h"
 #include "SIDBridge.h"
+#include "AudioKernels.h"
 #include "Emulator.h"
 
 namespace vc64 {
@@ -57,22 +58,43 @@ AudioPort::generateSamples()
     // Check for a buffer overflow
     if (stream.free() < numSamples) handleBufferOverflow();
 
-    // Generate the samples
-    bool fading = volL.isFading() || volR.isFading();
+    // Drop the oldest samples if they still don't fit
+    if (auto dropped = numSamples - stream.free(); dropped > 0) {
 
-    if (sid1.isEnabled() || sid2.isEnabled() || sid3.isEnabled()) {
-        fading ? mixMultiSID<true>(numSamples) : mixMultiSID<false>(numSamples);
-    } else {
-        fading ? mixSingleSID<true>(numSamples) : mixSingleSID<false>(numSamples);
+        for (isize i = 0; i < 4; i++) {
+            sidBridge.sid[i].stream.skip(std::min(dropped, sidBridge.sid[i].stream.count()));
+        }
+        stats.droppedSamples += dropped;
+        numSamples -= dropped;
     }
+    assert(numSamples <= stream.free());
+
+    // Remember where the new samples go
+    latestBegin = stream.end();
+    latestCount = numSamples;
+
+    // Generate the samples
+    bool fading = volL.isFading() || volR.isFading();
+    fading ? mix<true>(numSamples) : mix<false>(numSamples);
 
     stream.mutex.unlock();
 }
 
+void
+AudioPort::copyLatest(std::vector<SamplePair> &samples) const
+{
+    samples.resize(latestCount);
+
+    for (isize i = 0, j = latestBegin; i < latestCount; i++, j = stream.next(j)) {
+        samples[i] = stream.elements[j];
+    }
+}
+
 void
 AudioPort::updateSampleRateCorrection()
 {
-    if (config.asr) {
+    // Recordings are made at a constant sample rate
+    if (config.asr && !emulator.isRecording()) {
 
         // Compute the difference between the ideal and the current fill level
         auto error = (0.5 - stream.fillLevel());
@@ -128,104 +150,108 @@ AudioPort::fadeOut()
 */
 
 template <bool fading> void
-AudioPort::mixSingleSID(isize numSamples)
+AudioPort::mix(isize numSamples)
 {
-    auto vol0 = vol[0];
-    auto pan0 = pan[0];
-    auto curL = volL.current;
-    auto curR = volR.current;
+    static constexpr isize blockSize = 256;
+
+    SampleStream *source[4];
+    float gainL[4], gainR[4];
+    isize channels = 0;
+
+    auto curL = float(volL.current);
+    auto curR = float(volR.current);
 
     // Print some debug info
-    loginfo(SID_EXEC, "volL: %f volR: %f vol0: %f pan0: %f\n", curL, curR, vol0, pan0);
+    loginfo(SID_EXEC, "volL: %f volR: %f\n", curL, curR);
+    loginfo(SID_EXEC, "vol0: %f vol1: %f vol2: %f vol3: %f\n", vol[0], vol[1], vol[2], vol[3]);
 
-    if (wasMuted) {
+    // Collect the contributing SIDs and their channel gains
+    bool multi = sid1.isEnabled() || sid2.isEnabled() || sid3.isEnabled();
 
-        // Fast path: All samples are zero
-        for (isize i = 0; i < numSamples; i++) (void)sid0.stream.read();
-        for (isize i = 0; i < numSamples; i++) stream.write(SamplePair { 0, 0 } );
+    for (isize i = 0; i < 4; i++) {
 
-    } else {
+        auto &sid = sidBridge.sid[i];
+
+        // SIDs that haven't produced any samples contribute silence
+        if (i > 0 && (!multi || sid.stream.isEmpty())) continue;
 
-        // Slow path: There is something to hear
-        for (isize i = 0; i < numSamples; i++) {
+        source[channels] = &sid.stream;
+        gainL[channels] = vol[i] * (1 - pan[i]);
+        gainR[channels] = vol[i] * pan[i];
 
-            // Read SID sample from ring buffer
-            float ch0 = (float)sidBridge.sid0.stream.read() * vol0;
+        // If the master volume is constant, it is applied together with the channel gain
+        if constexpr (!fading) { gainL[channels] *= curL; gainR[channels] *= curR; }
+
+        channels++;
+    }
 
-            // Compute left and right channel output
-            double l = ch0 * (1 - pan0);
-            double r = ch0 * pan0;
+    if (wasMuted) {
 
-            // Modulate the master volume
-            if constexpr (fading) { volL.shift(); curL = volL.current; }
-            if constexpr (fading) { volR.shift(); curR = volR.current; }
+        // Fast path: All samples are zero
+        for (isize c = 0; c < channels; c++) source[c]->skip(numSamples);
 
-            // Apply master volume
-            l *= curL;
-            r *= curR;
+        for (isize i = 0; i < numSamples; ) {
 
-            // Prevent hearing loss
-            assert(std::abs(l) < 1.0);
-            assert(std::abs(r) < 1.0);
+            auto out = stream.writeSpan();
+            auto n = std::min(numSamples - i, isize(out.size()));
 
-            stream.write(SamplePair { float(l), float(r) } );
+            std::fill_n(out.begin(), n, SamplePair { 0, 0 });
+            stream.commit(n);
+            i += n;
         }
+        return;
     }
-}
 
-template <bool fading> void
-AudioPort::mixMultiSID(isize numSamples)
-{
-    auto vol0 = vol[0]; auto pan0 = pan[0];
-    auto vol1 = vol[1]; auto pan1 = pan[1];
-    auto vol2 = vol[2]; auto pan2 = pan[2];
-    auto vol3 = vol[3]; auto pan3 = pan[3];
-    auto curL = volL.current;
-    auto curR = volR.current;
+    // Slow path: There is something to hear
+    float l[blockSize], r[blockSize];
+    [[maybe_unused]] float fadeL[blockSize], fadeR[blockSize];
 
-    // Print some debug info
-    loginfo(SID_EXEC, "volL: %f volR: %f\n", curL, curR);
-    loginfo(SID_EXEC, "vol0: %f vol1: %f vol2: %f vol3: %f\n", vol0, vol1, vol2, vol3);
+    for (isize i = 0; i < numSamples; ) {
 
-    if (wasMuted) {
+        // The block must fit into the free space of the output stream
+        auto out = stream.writeSpan();
+        auto n = std::min({ numSamples - i, blockSize, isize(out.size()) });
+        assert(n > 0);
 
-        // Fast path: All samples are zero
-        for (isize i = 0; i < numSamples; i++) (void)sid0.stream.read();
-        for (isize i = 0; i < numSamples; i++) (void)sid1.stream.read(0);
-        for (isize i = 0; i < numSamples; i++) (void)sid2.stream.read(0);
-        for (isize i = 0; i < numSamples; i++) (void)sid3.stream.read(0);
-        for (isize i = 0; i < numSamples; i++) stream.write(SamplePair { 0, 0 } );
+        // Mix all SIDs (the SID streams may wrap around inside the block)
+        std::fill_n(l, n, 0.0f);
+        std::fill_n(r, n, 0.0f);
 
-    } else {
+        for (isize c = 0; c < channels; c++) {
 
-        // Slow path: There is something to hear
-        for (isize i = 0; i < numSamples; i++) {
+            for (isize j = 0; j < n; ) {
 
-            double ch0, ch1, ch2, ch3, l, r;
+                auto in = source[c]->readSpan();
+                auto cnt = std::min(n - j, isize(in.size()));
 
-            ch0 = (float)sid0.stream.read()  * vol0;
-            ch1 = (float)sid1.stream.read(0) * vol1;
-            ch2 = (float)sid2.stream.read(0) * vol2;
-            ch3 = (float)sid3.stream.read(0) * vol3;
+                audio::accumulate(in.data(), cnt, gainL[c], gainR[c], l + j, r + j);
+                source[c]->skip(cnt);
+                j += cnt;
+            }
+        }
 
-            // Compute left and right channel output
-            l = ch0 * (1 - pan0) + ch1 * (1 - pan1) + ch2 * (1 - pan2) + ch3 * (1 - pan3);
-            r = ch0 * pan0 + ch1 * pan1 + ch2 * pan2 + ch3 * pan3;
+        // Modulate the master volume
+        if constexpr (fading) {
 
-            // Modulate the master volume
-            if constexpr (fading) { volL.shift(); curL = volL.current; }
-            if constexpr (fading) { volR.shift(); curR = volR.current; }
+            for (isize j = 0; j < n; j++) {
 
-            // Apply master volume
-            l *= curL;
-            r *= curR;
+                volL.shift(); fadeL[j] = float(volL.current);
+                volR.shift(); fadeR[j] = float(volR.current);
+            }
+            audio::modulate(l, fadeL, n);
+            audio::modulate(r, fadeR, n);
+        }
 
-            // Prevent hearing loss
-            assert(abs(l) < 1.0);
-            assert(abs(r) < 1.0);
+        // Prevent hearing loss
+        for (isize j = 0; j < n; j++) {
 
-            stream.write(SamplePair { float(l), float(r) } );
+            assert(std::abs(l[j]) < 1.0);
+            assert(std::abs(r[j]) < 1.0);
         }
+
+        audio::interleave(l, r, n, &out[0].l);
+        stream.commit(n);
+        i += n;
     }
 }
 
@@ -241,7 +267,7 @@ AudioPort::handleBufferUnderflow()
     lastAlignment = utl::Time::now();
 
     // Adjust the sample rate if the emulator runs under normal conditions
-    if (emulator.isRunning() && !emulator.isWarping()) {
+    if (emulator.isRunning() && !emulator.isWarping() && !emulator.isRecording()) {
 
         stats.bufferUnderflows++;
         loginfo(AUDBUF_DEBUG, "Audio buffer underflow after %f seconds\n", elapsedTime.asSeconds());
@@ -263,7 +289,7 @@ AudioPort::handleBufferOverflow()
     lastAlignment = utl::Time::now();
 
     // Adjust the sample rate if the emulator runs under normal conditions
-    if (emulator.isRunning() && !emulator.isWarping()) {
+    if (emulator.isRunning() && !emulator.isWarping() && !emulator.isRecording()) {
 
         stats.bufferOverflows++;
         loginfo(AUDBUF_DEBUG, "Audio buffer overflow after %f seconds\n", elapsedTime.asSeconds());
@@ -324,4 +350,17 @@ AudioPort::copyInterleaved(float *buffer, isize n)
     return cnt;
 }
 
+isize
+AudioPort::consume(isize n, const std::function<void(const float *, isize)> &consumer)
+{
+    // Hand over sound samples
+    auto cnt = stream.consume(n, consumer);
+    stats.consumedSamples += cnt;
+
+    // Check for a buffer underflow
+    if (cnt < n) handleBufferUnderflow();
+
+    return cnt;
+}
+
 }
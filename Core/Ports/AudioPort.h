@@ -49,6 +49,7 @@ class AudioPort final : public SubComponent, public Inspectable<AudioPortInfo, A
         Opt::AUD_VOL_R,
         Opt::AUD_BUFFER_SIZE,
         Opt::AUD_ASR,
+        Opt::AUD_PARALLEL,
     };
 
     // Current configuration
@@ -77,6 +78,10 @@ class AudioPort final : public SubComponent, public Inspectable<AudioPortInfo, A
     // Used to determine if Msg::MUTE should be send
     bool wasMuted = false;
 
+    // Samples generated by the latest call to generateSamples()
+    isize latestBegin = 0;
+    isize latestCount = 0;
+
 
     //
     // Subcomponents
@@ -170,6 +175,7 @@ public:
     void setOption(Opt opt, i64 value) override;
 
     void setSampleRate(double hz);
+    double getSampleRate() const { return sampleRate; }
 
 
     //
@@ -204,16 +210,16 @@ public:
     // Returns the sample rate adjustment
     double getSampleRateCorrection() { return sampleRateCorrection; }
 
+    // Copies the samples generated by the latest call to generateSamples()
+    void copyLatest(std::vector<SamplePair> &samples) const;
+
 private:
 
     // Runs the ASR algorithms (adaptive sample rate)
     void updateSampleRateCorrection();
 
-    // Generates samples from the audio source with a single active SID
-    template <bool fading> void mixSingleSID(isize numSamples);
-
-    // Generates samples from the audio source with multiple active SIDs
-    template <bool fading> void mixMultiSID(isize numSamples);
+    // Mixes the samples of all active SIDs block by block
+    template <bool fading> void mix(isize numSamples);
 
     // Handles a buffer underflow or overflow condition
     void handleBufferUnderflow();
@@ -250,6 +256,9 @@ public:
     isize copyMono(float *buffer, isize n);
     isize copyStereo(float *left, float *right, isize n);
     isize copyInterleaved(float *buffer, isize n);
+
+    // Hands audio samples over without copying them (see AudioStream::consume)
+    isize consume(isize n, const std::function<void(const float *, isize)> &consumer);
 };
 
 }
@@ -107,7 +107,7 @@ AudioPort::_powerOn()
 void
 AudioPort::_run()
 {
-    if (!emulator.isWarping()) unmute(10000);
+    if (!emulator.isWarping() || emulator.isRecording()) unmute(10000);
 }
 
 void
@@ -120,6 +120,9 @@ AudioPort::_pause()
 void
 AudioPort::_warpOn()
 {
+    // Recordings are not muted in warp mode
+    if (emulator.isRecording()) return;
+
     eliminateCracks();
     mute();
 }
@@ -139,7 +142,7 @@ AudioPort::_focus()
 void
 AudioPort::_unfocus()
 {
-    mute(100000);
+    if (!emulator.isRecording()) mute(100000);
 }
 
 i64
@@ -159,6 +162,7 @@ AudioPort::getOption(Opt option) const
         case Opt::AUD_VOL_R:        return config.volR;
         case Opt::AUD_BUFFER_SIZE:  return (i64)config.bufferSize;
         case Opt::AUD_ASR:          return (i64)config.asr;
+        case Opt::AUD_PARALLEL:     return (i64)config.parallel;
 
         default:
             fatalError;
@@ -197,6 +201,7 @@ AudioPort::checkOption(Opt opt, i64 value)
             return;
 
         case Opt::AUD_ASR:
+        case Opt::AUD_PARALLEL:
 
             return;
 
@@ -256,6 +261,11 @@ AudioPort::setOption(Opt opt, i64 value)
             config.asr = (bool)value;
             return;
 
+        case Opt::AUD_PARALLEL:
+
+            config.parallel = (bool)value;
+            return;
+
         default:
             fatalError;
     }
@@ -38,6 +38,9 @@ typedef struct
 
     // Adaptive Sample Rate enable switch
     bool asr;
+
+    // Synthesizes the samples of multiple SIDs on worker threads
+    bool parallel;
 }
 
 AudioPortConfig;
@@ -67,6 +70,9 @@ typedef struct
 
     // Total number of sampels grabbed by the audio backend
     i64 consumedSamples;
+
+    // Total number of samples discarded due to a full buffer
+    i64 droppedSamples;
 }
 AudioPortStats;
 
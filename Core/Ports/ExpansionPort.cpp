@@ -95,6 +95,7 @@ ExpansionPort::poke(u16 addr, u8 value)
         cartridge->poke(addr, value);
     } else if (!c64.getUltimax()) {
         mem.ram[addr] = value;
+        mem.ramPages.mark(addr);
     }
 }
 
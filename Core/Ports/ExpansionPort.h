@@ -73,6 +73,9 @@ public:
     ExpansionPort(C64 &ref) : SubComponent(ref) { };
     ExpansionPort& operator= (const ExpansionPort& other);
 
+    // Returns the number of cartridge bytes copied by the latest assignment
+    isize clonedBytes() const { return cartridge ? cartridge->clonedBytes : 0; }
+
 
     //
     // Methods from Serializable
@@ -94,6 +94,10 @@ SerialPort::updateIecLines()
     if (signalsChanged) {
         
         cia2.updatePA();
+
+        // Run postponed drive cycles before the drives see the new signals
+        drive8.catchUp();
+        drive9.catchUp();
         
         // Wake up drives
         drive8.wakeUp();
@@ -13,6 +13,7 @@
 #include "config.h"
 #include "VideoPort.h"
 #include "VICII.h"
+#include "C64.h"
 
 namespace vc64 {
 
@@ -63,6 +64,7 @@ VideoPort::getOption(Opt option) const
     switch (option) {
 
         case Opt::VID_WHITE_NOISE:   return config.whiteNoise;
+        case Opt::VID_PALETTED:      return config.paletted;
 
         default:
             fatalError;
@@ -75,6 +77,7 @@ VideoPort::checkOption(Opt opt, i64 value)
     switch (opt) {
 
         case Opt::VID_WHITE_NOISE:
+        case Opt::VID_PALETTED:
 
             return;
 
@@ -95,6 +98,11 @@ VideoPort::setOption(Opt opt, i64 value)
             config.whiteNoise = (bool)value;
             return;
 
+        case Opt::VID_PALETTED:
+
+            config.paletted = (bool)value;
+            return;
+
         default:
             fatalError;
     }
@@ -107,7 +115,7 @@ VideoPort::getTexture(isize offset) const
 
         auto &result = vic.getStableBuffer(offset);
         info.latestGrabbedFrame = result.nr;
-        return result;
+        return result.paletted ? convert(result, offset) : result;
     }
     if (config.whiteNoise) {
 
@@ -206,6 +214,71 @@ VideoPort::findInnerAreaNormalized(double &x1, double &x2, double &y1, double &y
     y2 = double(iy2) / (Tex::height - 1);
 }
 
+Texture::Rows
+VideoPort::getChangedRows(i64 frame, isize offset) const
+{
+    Texture::Rows result;
+
+    // Keep recording the changed rows
+    latestRowQuery = c64.frame;
+
+    if (isPoweredOn()) {
+
+        // Only look at stable textures (offset 1 refers to the working buffer)
+        offset = std::clamp(offset, isize(2 - VICII::NUM_TEXTURES), isize(0));
+
+        // Collect the changes of all frames drawn after the requested one
+        for (isize i = 0; i < VICII::NUM_TEXTURES - 1 + offset; i++) {
+
+            auto &texture = vic.getStableBuffer(offset - i);
+
+            if (texture.nr == frame) return result;
+            result |= texture.changed;
+        }
+    }
+
+    return result.set();
+}
+
+bool
+VideoPort::tracksChangedRows() const
+{
+    auto age = c64.frame - latestRowQuery;
+    return age >= 0 && age < VICII::NUM_TEXTURES;
+}
+
+const class Texture &
+VideoPort::convert(const class Texture &texture, isize offset) const
+{
+    auto *palette = vic.getPalette();
+
+    if (std::memcmp(palette, convertedPalette, sizeof(convertedPalette)) != 0) {
+
+        // Convert the whole texture if the palette has changed
+        Texture::colorize(texture.indices.ptr, Texture::texels, palette, converted.pixels.ptr);
+        std::memcpy(convertedPalette, palette, sizeof(convertedPalette));
+
+    } else if (&texture != convertedSource || texture.nr != convertedNr) {
+
+        // Only convert the rows that differ from the previously converted frame
+        auto rows = getChangedRows(convertedNr, offset);
+
+        for (isize row = 0; row < Texture::height; row++) {
+
+            if (!rows[row]) continue;
+
+            auto first = row * Texture::width;
+            Texture::colorize(texture.indices.ptr + first, Texture::width, palette, converted.pixels.ptr + first);
+        }
+    }
+
+    convertedSource = &texture;
+    convertedNr = texture.nr;
+    converted.nr = texture.nr;
+    converted.changed = texture.changed;
+    return converted;
+}
+
 u32 *
 VideoPort::getNoiseTexture() const
 {
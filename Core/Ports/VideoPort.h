@@ -15,6 +15,7 @@
 #include "VideoPortTypes.h"
 #include "SubComponent.h"
 #include "Texture.h"
+#include <atomic>
 
 namespace vc64 {
 
@@ -30,7 +31,8 @@ class VideoPort final : public SubComponent, public Inspectable<VideoPortInfo, V
 
     Options options = {
 
-        Opt::VID_WHITE_NOISE
+        Opt::VID_WHITE_NOISE,
+        Opt::VID_PALETTED
     };
 
     // Current configuration
@@ -43,6 +45,20 @@ class VideoPort final : public SubComponent, public Inspectable<VideoPortInfo, V
     //  White noise data
     utl::Buffer <Texel> noise;
 
+    /* RGBA version of the most recently requested paletted texture. The
+     * texture is shared by all consumers and therefore only accessed while
+     * the texture lock is held.
+     */
+    mutable Texture converted;
+
+    // Source frame and palette of the converted texture
+    mutable const Texture *convertedSource = nullptr;
+    mutable i64 convertedNr = -1;
+    mutable Texel convertedPalette[Texture::colors] = { };
+
+    // Frame in which the changed rows have been queried the last time
+    mutable std::atomic<i64> latestRowQuery = 0;
+
     //
     // Methods
     //
@@ -108,12 +124,25 @@ public:
 
 public:
 
-    // Returns a pointer to the emulator texture
+    /* Returns a pointer to the emulator texture. The caller has to hold the
+     * texture lock as long as the texture is in use.
+     */
     const class Texture &getTexture(isize offset = 0) const;
 
     // Returns a pointer to the bus debugger texture
     const class Texture &getDmaTexture(isize offset = 0) const;
 
+    /* Returns the rows of the emulator texture that differ from the texture
+     * of the specified frame. If the frame is no longer available, all rows
+     * are reported as changed.
+     */
+    Texture::Rows getChangedRows(i64 frame, isize offset = 0) const;
+
+    /* Indicates if the changed rows need to be recorded. This is the case as
+     * long as a consumer has queried them in one of the buffered frames.
+     */
+    bool tracksChangedRows() const;
+
     // Informs the video port about a buffer swap
     void buffersWillSwap();
 
@@ -123,6 +152,9 @@ public:
 
 private:
 
+    // Converts a paletted texture to RGBA format
+    const class Texture &convert(const class Texture &texture, isize offset) const;
+
     // Returns a pointer to a white-noise texture
     u32 *getNoiseTexture() const;
 
@@ -23,6 +23,7 @@ namespace vc64 {
 typedef struct
 {
     bool whiteNoise;
+    bool paletted;
 }
 
 VideoPortConfig;
@@ -151,6 +151,9 @@ VirtualC64::VirtualC64() {
     drive9.drive = &emu->main.drive9;
     drive9.disk.drive = &emu->main.drive9;
 
+    recorder.emu = emu;
+    recorder.recorder = &emu->recorder;
+
     remoteManager.emu = emu;
     remoteManager.remoteManager = &emu->main.remoteManager;
 
@@ -571,6 +574,13 @@ C64API::saveSnapshot(const fs::path &path, Compressor compressor) const
 
 }
 
+void
+C64API::rewind(isize frames)
+{
+    VC64_PUBLIC
+    emu->put(Cmd::REWIND, frames);
+}
+
 void
 C64API::loadRom(const fs::path &path)
 {
@@ -880,6 +890,12 @@ AudioPortAPI::copyInterleaved(float *buffer, isize n)
     return audioPort->copyInterleaved(buffer, n);
 }
 
+isize
+AudioPortAPI::consume(isize n, const std::function<void(const float *, isize)> &consumer)
+{
+    return audioPort->consume(n, consumer);
+}
+
 
 //
 // Video port
@@ -953,6 +969,23 @@ VideoPortAPI::getDmaTexture(isize *nr, isize *width, isize *height) const
     return (u32 *)texture.pixels.ptr;
 }
 
+isize
+VideoPortAPI::getChangedRows(i64 frame, bool *rows) const
+{
+    VC64_PUBLIC
+    auto changed = emu->getChangedRows(frame);
+
+    for (isize i = 0; i < Texture::height; i++) rows[i] = changed[i];
+    return isize(changed.count());
+}
+
+const u32 *
+VideoPortAPI::getFrame(isize width, isize height)
+{
+    VC64_PUBLIC
+    return emu->getFrame(width, height);
+}
+
 void
 VideoPortAPI::findInnerArea(isize &x1, isize &x2, isize &y1, isize &y2) const
 {
@@ -1245,6 +1278,37 @@ MouseAPI::detectShakeDxDy(double dx, double dy)
 }
 
 
+//
+// Recorder
+//
+
+void
+RecorderAPI::start(const RecorderConfig &config)
+{
+    VC64_PUBLIC_SUSPEND
+    emu->startRecording(config);
+}
+
+void
+RecorderAPI::stop()
+{
+    VC64_PUBLIC_SUSPEND
+    emu->stopRecording();
+}
+
+bool
+RecorderAPI::isRecording() const
+{
+    return recorder->isRecording();
+}
+
+RecorderStats
+RecorderAPI::getStats() const
+{
+    return recorder->getStats();
+}
+
+
 //
 // RemoteManager
 //
@@ -266,6 +266,18 @@ struct AudioPortAPI : public API {
      */
     isize copyInterleaved(float *buffer, isize n);
 
+    /** @brief  Hands a number of stereo samples over without copying them.
+     *  The consumer receives a pointer into the audio buffer together with
+     *  the number of available sample pairs. The samples are interleaved as
+     *  in copyInterleaved(). If the requested samples wrap around the end
+     *  of the internal ring buffer, the consumer is called twice. The
+     *  pointer must not be used after the consumer has returned.
+     *  @param  n         Number of sound samples to hand over.
+     *  @param  consumer  Function processing the sound samples.
+     *  @return           Number of actually consumed sound samples.
+     */
+    isize consume(isize n, const std::function<void(const float *, isize)> &consumer);
+
     /// @}
     /// @name Visualizing waveforms
     /// @{
@@ -316,6 +328,30 @@ struct VideoPortAPI : public API {
     const u32 *getDmaTexture() const;
     const u32 *getDmaTexture(isize *nr, isize *width, isize *height) const;
 
+    /** @brief  Determines the texture rows that changed since a certain frame
+     *
+     * The function compares the texture returned by getTexture() with the
+     * texture of the specified frame. Each element of the provided array,
+     * which must hold vc64::Texture::height elements, is set to true if the
+     * corresponding row differs. If the requested frame is no longer
+     * available, all rows are reported as changed. Like getTexture(), this
+     * function should be called while the texture is locked.
+     *
+     * @return  The number of changed rows
+     */
+    isize getChangedRows(i64 frame, bool *rows) const;
+
+    /** @brief  Applies the monitor effects to the most recent stable texture
+     *
+     * The function renders the visible texture area with all effects that
+     * are enabled in the monitor configuration (upscaler, blur, bloom, dot
+     * mask, scanlines, and misalignment) on the CPU. The result is an RGBA
+     * frame with the specified dimensions which stays valid until the next
+     * call. Like getTexture(), this function should be called while the
+     * texture is locked.
+     */
+    const u32 *getFrame(isize width, isize height);
+
     /** @brief Analyzes the current texture and determines coordinates for border cropping
      */
     void findInnerArea(isize &x1, isize &x2, isize &y1, isize &y2) const;
@@ -714,6 +750,45 @@ struct DriveAPI : public API {
 };
 
 
+/** Recorder Public API
+ */
+struct RecorderAPI : public API {
+
+    class Recorder *recorder = nullptr;
+
+    /// @name Recording video and audio
+    /// @{
+
+    /** @brief  Starts a recording
+     *
+     * From now on, each frame computed by the emulator is written to the
+     * video file and the audio samples of the same frame are written to the
+     * WAV file. Encoding and disk accesses are carried out by a separate
+     * thread. If this thread falls behind, the emulator waits instead of
+     * dropping frames.
+     *
+     * @throw   IOError if one of the output files cannot be created
+     */
+    void start(const RecorderConfig &config);
+
+    /** @brief  Stops the recording
+     *
+     * The function blocks until all pending frames have been written.
+     */
+    void stop();
+
+    /** @brief  Returns true if a recording is in progress.
+     */
+    bool isRecording() const;
+
+    /** @brief  Returns statistical information about the recording.
+     */
+    RecorderStats getStats() const;
+
+    /// @}
+};
+
+
 /** RemoteManager Public API
  */
 struct RemoteManagerAPI : public API {
@@ -1123,6 +1198,16 @@ struct C64API : public API {
      */
     void saveSnapshot(const std::filesystem::path &path, Compressor compressor) const;
 
+    /** @brief  Reverts to a recently emulated frame
+     *
+     *  @param  frames  Number of frames to go back in time
+     *
+     *  @note   Frames are only recorded if a rewind buffer has been set up
+     *          via option C64_REWIND. If the requested frame is no longer
+     *          available, the oldest recorded frame is restored.
+     */
+    void rewind(isize frames);
+
 
     /// @}
     /// @name Handling ROMs
@@ -1208,6 +1293,7 @@ struct VirtualC64 : public API {
 
     // Misc
     DmaDebuggerAPI dmaDebugger;
+    RecorderAPI recorder;
     RemoteManagerAPI remoteManager;
     RetroShellAPI retroShell;
 
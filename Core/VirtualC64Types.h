@@ -55,6 +55,7 @@
 #include "Media/Cartridges/CartridgeTypes.h"
 
 // Miscellaneous
+#include "Misc/Recorder/RecorderTypes.h"
 #include "Misc/RemoteServers/RemoteManagerTypes.h"
 #include "Misc/RemoteServers/RemoteServerTypes.h"
 #include "Misc/RetroShell/RetroShellTypes.h"
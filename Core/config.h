@@ -27,7 +27,7 @@ static constexpr int VER_BETA       = 2;
 // Snapshot version number
 static constexpr int SNP_MAJOR      = 6;
 static constexpr int SNP_MINOR      = 0;
-static constexpr int SNP_SUBMINOR   = 0;
+static constexpr int SNP_SUBMINOR   = 1;
 static constexpr int SNP_BETA       = 2;
 
 
@@ -19,23 +19,27 @@ enum class Compressor : long
     GZIP,
     LZ4,
     RLE2,
-    RLE3
+    RLE3,
+    ZSTD,
+    CHUNKED
 };
 
 struct CompressorEnum : Reflectable<CompressorEnum, Compressor>
 {
     static constexpr long minVal = 0;
-    static constexpr long maxVal = long(Compressor::RLE3);
+    static constexpr long maxVal = long(Compressor::CHUNKED);
 
     static const char *_key(Compressor value)
     {
         switch (value) {
 
-            case Compressor::NONE:  return "NONE";
-            case Compressor::GZIP:  return "GZIP";
-            case Compressor::RLE2:  return "RLE2";
-            case Compressor::RLE3:  return "RLE3";
-            case Compressor::LZ4:   return "LZ4";
+            case Compressor::NONE:    return "NONE";
+            case Compressor::GZIP:    return "GZIP";
+            case Compressor::RLE2:    return "RLE2";
+            case Compressor::RLE3:    return "RLE3";
+            case Compressor::LZ4:     return "LZ4";
+            case Compressor::ZSTD:    return "ZSTD";
+            case Compressor::CHUNKED: return "CHUNKED";
         }
         return "???";
     }
@@ -43,19 +47,39 @@ struct CompressorEnum : Reflectable<CompressorEnum, Compressor>
     {
         switch (value) {
 
-            case Compressor::NONE:  return "No compression";
-            case Compressor::GZIP:  return "Gzip compression";
-            case Compressor::RLE2:  return "Run-length encoding (2)";
-            case Compressor::RLE3:  return "Run-length encoding (3)";
-            case Compressor::LZ4:   return "LZ4 compression";
+            case Compressor::NONE:    return "No compression";
+            case Compressor::GZIP:    return "Gzip compression";
+            case Compressor::RLE2:    return "Run-length encoding (2)";
+            case Compressor::RLE3:    return "Run-length encoding (3)";
+            case Compressor::LZ4:     return "LZ4 compression";
+            case Compressor::ZSTD:    return "Zstandard compression";
+            case Compressor::CHUNKED: return "Chunked compression (parallel)";
         }
         return "???";
     }
 };
 
+/* The chunked container format splits the data into chunks of equal size
+ * which are compressed independently and in parallel. Each chunk is
+ * compressed with Zstandard if available and with LZ4 otherwise. Chunks that
+ * don't shrink are stored raw. Because no chunk depends on another one, each
+ * chunk can be uncompressed on its own.
+ *
+ *     Header:  u32 uncompressed size, u32 chunk size, u32 chunk count
+ *     Table:   u32 compressed size, u8 compressor (one entry per chunk)
+ *     Payload: All compressed chunks in order
+ *
+ * All integers are stored in big endian format.
+ */
 class Compressible {
 
 public:
+
+    // Size of a chunk in the chunked container format
+    static constexpr isize chunkSize = 256 * 1024;
+
+    // Checks whether a compressor is supported in this build
+    static bool isSupported(Compressor compressor);
     
     static void gzip(u8 *buffer, isize len, std::vector<u8> &result);
     static void gunzip(u8 *buffer, isize len, std::vector<u8> &result, isize sizeEstimate = 0);
@@ -71,6 +95,18 @@ public:
 
     static void rle(isize n, u8 *buffer, isize len, std::vector<u8> &result, isize sizeEstimate = 0);
     static void unrle(isize n, u8 *buffer, isize len, std::vector<u8> &result, isize sizeEstimate = 0);
+
+    static void zstd(u8 *buffer, isize len, std::vector<u8> &result);
+    static void unzstd(u8 *buffer, isize len, std::vector<u8> &result, isize sizeEstimate = 0);
+
+    static void chunk(u8 *buffer, isize len, std::vector<u8> &result);
+    static void unchunk(u8 *buffer, isize len, std::vector<u8> &result, isize sizeEstimate = 0);
+
+    // Returns the number of chunks in a chunked container
+    static isize chunkCount(const u8 *buffer, isize len);
+
+    // Uncompresses a single chunk of a chunked container
+    static void extractChunk(const u8 *buffer, isize len, isize nr, std::vector<u8> &result);
 };
 
 }
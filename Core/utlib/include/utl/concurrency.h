@@ -9,5 +9,7 @@
 
 #include "concurrency/ReentrantMutex.h"
 #include "concurrency/AutoMutex.h"
+#include "concurrency/WorkerPool.h"
+#include "concurrency/SlotQueue.h"
 #include "abilities/Synchronizable.h"
 #include "abilities/Wakeable.h"
@@ -0,0 +1,145 @@
+// -----------------------------------------------------------------------------
+// This file is part of utlib - A lightweight utility library
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "utl/types/Integers.h"
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace utl {
+
+/* A bounded queue of reusable slots which is drained by a consumer thread.
+ *
+ * The producer fills the slot returned by acquire() and hands it over by
+ * calling commit(). The consumer thread calls the consume function for each
+ * committed slot in order. If all slots are in use, acquire() blocks until
+ * the consumer has caught up. Hence, no slot is ever dropped. The slots are
+ * kept alive between two uses, which allows to recycle their buffers.
+ *
+ * There must be a single producer thread. The consume function must not
+ * throw.
+ */
+template <class T> class SlotQueue
+{
+    std::vector<T> slots;
+
+    // Read and write position and number of committed slots
+    isize r = 0, w = 0, count = 0;
+
+    std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+
+    // The consumer thread and its work function
+    std::thread consumer;
+    std::function<void(T &)> consume;
+
+    // Set by stop() to terminate the consumer thread
+    bool stopping = false;
+
+public:
+
+    SlotQueue() { }
+    ~SlotQueue() { stop(); }
+
+    SlotQueue(const SlotQueue &) = delete;
+    SlotQueue &operator=(const SlotQueue &) = delete;
+
+    // Checks if the consumer thread is running
+    bool isRunning() const { return consumer.joinable(); }
+
+    // Allocates the slots and launches the consumer thread
+    void start(isize capacity, std::function<void(T &)> func)
+    {
+        stop();
+
+        slots = std::vector<T>(std::max(capacity, isize(1)));
+        r = w = count = 0;
+        stopping = false;
+        consume = std::move(func);
+
+        consumer = std::thread(&SlotQueue::run, this);
+    }
+
+    // Drains the queue, terminates the consumer thread, and frees the slots
+    void stop()
+    {
+        if (!consumer.joinable()) return;
+
+        {   std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        notEmpty.notify_one();
+        consumer.join();
+        slots.clear();
+    }
+
+    // Checks if all slots are in use, i.e., if acquire() would block
+    bool isFull()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return count == isize(slots.size());
+    }
+
+    // Returns the slot to fill next (blocks while the queue is full)
+    T &acquire()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        notFull.wait(lock, [this] { return count < isize(slots.size()); });
+
+        // The slot at the write position is owned by the producer now
+        return slots[w];
+    }
+
+    // Hands the acquired slot over to the consumer thread
+    void commit()
+    {
+        {   std::lock_guard<std::mutex> lock(mutex);
+            w = (w + 1) % isize(slots.size());
+            count++;
+        }
+        notEmpty.notify_one();
+    }
+
+    // Waits until all committed slots are consumed
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        notFull.wait(lock, [this] { return count == 0; });
+    }
+
+private:
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        while (true) {
+
+            notEmpty.wait(lock, [this] { return count > 0 || stopping; });
+            if (count == 0) break;
+
+            // The slot at the read position is owned by the consumer now
+            lock.unlock();
+            consume(slots[r]);
+            lock.lock();
+
+            r = (r + 1) % isize(slots.size());
+            count--;
+            notFull.notify_all();
+        }
+    }
+};
+
+}
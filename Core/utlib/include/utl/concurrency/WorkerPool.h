@@ -0,0 +1,64 @@
+// -----------------------------------------------------------------------------
+// This file is part of utlib - A lightweight utility library
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "utl/types/Integers.h"
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace utl {
+
+/* A fixed set of worker threads for fork-join style parallelism. The threads
+ * are started once and sleep between two calls to run(). Tasks must not throw.
+ */
+class WorkerPool
+{
+    std::vector<std::thread> threads;
+
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::condition_variable done;
+
+    // The current job
+    const std::function<void(isize)> *job = nullptr;
+
+    // Number of tasks, next task to hand out, and number of unfinished tasks
+    isize count = 0;
+    isize next = 0;
+    isize pending = 0;
+
+    // Set in the destructor to terminate all workers
+    bool quit = false;
+
+public:
+
+    explicit WorkerPool(isize workers);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    // Returns the number of worker threads
+    isize size() const { return isize(threads.size()); }
+
+    /* Calls func(0) ... func(n - 1) and returns when all calls have finished.
+     * The calling thread processes tasks, too.
+     */
+    void run(isize n, const std::function<void(isize)> &func);
+
+private:
+
+    void work();
+};
+
+}
@@ -10,3 +10,5 @@
 #include "storage/Buffer.h"
 #include "storage/RingBuffer.h"
 #include "storage/Mailbox.h"
+#include "storage/MpscQueue.h"
+#include "storage/DirtyMap.h"
@@ -23,9 +23,17 @@ template <class T> struct Allocator : public Hashable, public Dumpable {
 
     static constexpr isize maxCapacity = 512 * 1024 * 1024;
 
+    /* Files of at least this size are memory-mapped by map(). Reading smaller
+     * files is cheaper than setting up a mapping.
+     */
+    static constexpr isize mapThreshold = 64 * 1024;
+
     T *&ptr;
     isize size;
 
+    // Size of the memory mapping in bytes (0 if the buffer is heap-allocated)
+    isize mapping = 0;
+
     Allocator(T *&ptr) : ptr(ptr), size(0) { ptr = nullptr; }
     Allocator(const Allocator&);
     Allocator& operator= (const Allocator&);
@@ -57,6 +65,7 @@ template <class T> struct Allocator : public Hashable, public Dumpable {
     // Queries the buffer state
     isize bytesize() const { return size * sizeof(T); }
     bool empty() const { return size == 0; }
+    bool isMapped() const { return mapping != 0; }
     explicit operator bool() const { return !empty(); }
     ByteView byteView() const { return ByteView(ptr, size); }
 
@@ -72,6 +81,21 @@ template <class T> struct Allocator : public Hashable, public Dumpable {
     void init(const fs::path &path);
     void init(const fs::path &path, const string &name);
 
+    /* Initializes the buffer with the contents of a file. Large files are
+     * mapped into memory instead of being read. The mapping is private, i.e.,
+     * the pages are shared with the file system cache until they are written
+     * to, and modifications never reach the file. Returns false if the file
+     * cannot be read. On Windows, the file is always read.
+     *
+     * Pages that have not been written to are still backed by the file. If
+     * the file is truncated while it is mapped, accessing these pages raises
+     * SIGBUS. Hence, call unmap() before writing to the file.
+     */
+    bool map(const fs::path &path);
+
+    // Replaces a memory-mapped buffer by a heap-allocated copy
+    void unmap();
+
     // Resizes an existing buffer
     void resize(isize elements);
     void resize(isize elements, T pad);
@@ -116,6 +140,18 @@ template <class T> struct Allocator : public Hashable, public Dumpable {
     void unrle3(isize offset = 0, isize sizeEstimate = 0) {
         uncompress(Compressible::unrle3, offset, sizeEstimate);
     }
+    void zstd(isize offset = 0) {
+        compress(Compressible::zstd, offset);
+    }
+    void unzstd(isize offset = 0, isize sizeEstimate = 0) {
+        uncompress(Compressible::unzstd, offset, sizeEstimate);
+    }
+    void chunk(isize offset = 0) {
+        compress(Compressible::chunk, offset);
+    }
+    void unchunk(isize offset = 0, isize sizeEstimate = 0) {
+        uncompress(Compressible::unchunk, offset, sizeEstimate);
+    }
 
 private:
 
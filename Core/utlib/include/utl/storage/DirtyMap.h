@@ -0,0 +1,179 @@
+// -----------------------------------------------------------------------------
+// This file is part of utlib - A lightweight utility library
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "utl/common.h"
+#include "utl/abilities/Hashable.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace utl {
+
+/* A DirtyMap keeps track of modified pages inside a memory block. The block
+ * is split into (at most) N pages of equal size. Each write access marks the
+ * corresponding page as dirty. When two copies of the same memory block are
+ * synchronized, only those pages are copied that have been modified in either
+ * copy since the last synchronization.
+ *
+ * The page size is a power of two and can be adjusted at runtime, which
+ * allows blocks of variable size (e.g., cartridge RAM) to be tracked with a
+ * fixed number of pages. A newly created map marks all pages as dirty.
+ *
+ * In addition, the map caches a hash value for each page, which allows to
+ * compute a checksum of the memory block in O(modified pages). Both consumers
+ * of the dirty bits, synchronization and hashing, see all modifications since
+ * their last run, while marking a page remains a single bit operation.
+ */
+template <isize N> class DirtyMap {
+
+    static constexpr isize words = (N + 63) / 64;
+
+    // Pages modified since the last synchronization or hash computation
+    u64 map[words];
+
+    // Pages modified since the last synchronization, but before the last hash
+    u64 unsynced[words];
+
+    // Pages modified since the last hash, but before the last synchronization
+    u64 unhashed[words];
+
+    // Hash value of each page (valid for all pages that are not marked)
+    u64 hashes[N];
+
+    // Page size (as a power of two)
+    isize shift = 0;
+
+public:
+
+    DirtyMap() { init(); }
+    DirtyMap(isize shift) : shift(shift) { init(); }
+
+    // Marks all pages as dirty and not yet hashed
+    void init()
+    {
+        markAll();
+        std::memset(unsynced, 0, sizeof(unsynced));
+        std::memset(unhashed, 0xFF, sizeof(unhashed));
+    }
+
+    // Adjusts the page size such that 'size' bytes are covered
+    void cover(isize size)
+    {
+        shift = 0;
+        while ((N << shift) < size) shift++;
+        markAll();
+    }
+
+    isize pageSize() const { return isize(1) << shift; }
+
+    // Marks a single byte, a range of bytes, or all pages as dirty
+    void mark(isize offset)
+    {
+        auto page = offset >> shift;
+        map[page >> 6] |= u64(1) << (page & 63);
+    }
+    void mark(isize offset, isize count)
+    {
+        if (count <= 0) return;
+        for (auto p = offset >> shift; p <= (offset + count - 1) >> shift; p++) {
+            map[p >> 6] |= u64(1) << (p & 63);
+        }
+    }
+    void markAll() { std::memset(map, 0xFF, sizeof(map)); }
+
+    // Marks all pages as synchronized
+    void clear()
+    {
+        for (isize w = 0; w < words; w++) unhashed[w] |= map[w];
+        std::memset(map, 0, sizeof(map));
+        std::memset(unsynced, 0, sizeof(unsynced));
+    }
+
+    // Checks if a page has been modified since the last synchronization
+    bool isDirty(isize page) const
+    {
+        return ((map[page >> 6] | unsynced[page >> 6]) >> (page & 63)) & 1;
+    }
+
+    /* Synchronizes a memory block with its source. This map tracks dst and
+     * srcMap tracks src. All pages that are marked dirty in one of the two
+     * maps are copied from src to dst. Afterwards, both maps are clean. The
+     * function returns the number of copied bytes.
+     */
+    isize sync(u8 *dst, DirtyMap &srcMap, const u8 *src, isize size)
+    {
+        assert(shift == srcMap.shift);
+
+        isize result = 0;
+
+        for (isize w = 0; w < words; w++) {
+
+            auto bits = map[w] | unsynced[w] | srcMap.map[w] | srcMap.unsynced[w];
+
+            // All copied pages need to be rehashed
+            unhashed[w] |= bits;
+
+            while (bits) {
+
+                auto page = w * 64 + std::countr_zero(bits);
+                auto offset = page << srcMap.shift;
+                bits &= bits - 1;
+
+                if (offset >= size) break;
+                auto count = std::min(srcMap.pageSize(), size - offset);
+
+                std::memcpy(dst + offset, src + offset, count);
+                result += count;
+            }
+        }
+
+        clear();
+        srcMap.clear();
+
+        return result;
+    }
+
+    /* Computes a FNV-64 checksum of a memory block. Only pages that have been
+     * modified since the last call are rehashed. The checksum is a function
+     * of the block contents alone. It does not depend on the access history.
+     */
+    u64 fnv64(const u8 *block, isize size)
+    {
+        auto pages = std::min((size + pageSize() - 1) >> shift, N);
+
+        for (isize w = 0; w < words; w++) {
+
+            auto bits = map[w] | unhashed[w];
+
+            while (bits) {
+
+                auto page = w * 64 + std::countr_zero(bits);
+                auto offset = page << shift;
+                bits &= bits - 1;
+
+                if (page >= pages) break;
+                hashes[page] = Hashable::fnv64(block + offset, std::min(pageSize(), size - offset));
+            }
+
+            // Hand the modifications over to the next synchronization
+            unsynced[w] |= map[w];
+            map[w] = 0;
+            unhashed[w] = 0;
+        }
+
+        u64 result = Hashable::fnvInit64();
+        for (isize page = 0; page < pages; page++) result = Hashable::fnvIt64(result, hashes[page]);
+
+        return result;
+    }
+};
+
+}
@@ -0,0 +1,149 @@
+// -----------------------------------------------------------------------------
+// This file is part of utlib - A lightweight utility library
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "utl/common.h"
+#include <algorithm>
+#include <atomic>
+
+namespace utl {
+
+/* A MpscQueue is a bounded, lock-free queue with multiple producers and a
+ * single consumer. Each slot carries a sequence number telling whether the
+ * slot is free for the producer of a certain round or holds an element for
+ * the consumer. Producers claim slots by advancing the write index with a
+ * CAS operation, the consumer advances the read index without contention.
+ * Both indices reside in separate cache lines to avoid false sharing.
+ *
+ * If the queue is full, put() fails immediately and the element is counted
+ * as dropped. Neither put() nor poll() ever blocks.
+ */
+template <class T, isize capacity> class MpscQueue {
+
+    static_assert(capacity > 0 && (capacity & (capacity - 1)) == 0,
+                  "Capacity must be a power of two");
+
+    static constexpr isize lineSize = 64;
+    static constexpr usize mask = usize(capacity - 1);
+
+    struct Slot {
+
+        std::atomic<usize> seq;
+        T element;
+    };
+
+    // Element storage
+    Slot *slots = new Slot[capacity];
+
+    // Write index (shared by all producers)
+    alignas(lineSize) std::atomic<usize> w = 0;
+
+    // Read index (owned by the consumer)
+    alignas(lineSize) std::atomic<usize> r = 0;
+
+    // Number of elements that were rejected because the queue was full
+    alignas(lineSize) std::atomic<i64> drops = 0;
+
+public:
+
+    MpscQueue() { for (isize i = 0; i < capacity; i++) slots[i].seq = usize(i); }
+    ~MpscQueue() { delete[] slots; }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator= (const MpscQueue&) = delete;
+
+
+    //
+    // Querying the fill status
+    //
+
+    isize cap() const { return capacity; }
+
+    isize count() const
+    {
+        auto n = isize(w.load(std::memory_order_relaxed) - r.load(std::memory_order_relaxed));
+        return std::clamp(n, isize(0), capacity);
+    }
+
+    bool isEmpty() const
+    {
+        auto pos = r.load(std::memory_order_relaxed);
+        return slots[pos & mask].seq.load(std::memory_order_acquire) != pos + 1;
+    }
+
+    // Returns the number of elements lost due to an overflow
+    i64 dropped() const { return drops.load(std::memory_order_relaxed); }
+
+
+    //
+    // Writing elements (any thread)
+    //
+
+    bool put(const T &element)
+    {
+        auto pos = w.load(std::memory_order_relaxed);
+
+        while (true) {
+
+            auto &slot = slots[pos & mask];
+            auto diff = isize(slot.seq.load(std::memory_order_acquire) - pos);
+
+            if (diff == 0) {
+
+                // The slot is free. Try to claim it.
+                if (w.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+
+                    slot.element = element;
+                    slot.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+
+            } else if (diff < 0) {
+
+                // The slot still holds an element from the previous round
+                drops.fetch_add(1, std::memory_order_relaxed);
+                return false;
+
+            } else {
+
+                // Another producer has claimed the slot
+                pos = w.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+
+    //
+    // Reading elements (consumer thread only)
+    //
+
+    bool poll(T &element)
+    {
+        auto pos = r.load(std::memory_order_relaxed);
+        auto &slot = slots[pos & mask];
+
+        if (slot.seq.load(std::memory_order_acquire) != pos + 1) return false;
+
+        element = slot.element;
+        slot.seq.store(pos + capacity, std::memory_order_release);
+        r.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Reads up to 'count' elements in a single batch
+    isize poll(T *buffer, isize count)
+    {
+        isize n = 0;
+        while (n < count && poll(buffer[n])) n++;
+        return n;
+    }
+};
+
+}
@@ -293,6 +293,31 @@ template <class T> struct ResizableRingBuffer
         }
         return result;
     }
+
+
+    //
+    // Accessing contiguous regions
+    //
+
+    // Returns the elements that can be read without wrapping around
+    std::span<T> readSpan()
+    {
+        return { elements + r, usize(r > w ? capacity - r : w - r) };
+    }
+
+    // Returns the free elements that can be written without wrapping around
+    std::span<T> writeSpan()
+    {
+        auto end = r > w ? r - 1 : r == 0 ? capacity - 1 : capacity;
+        return { elements + w, usize(end - w) };
+    }
+
+    // Marks n elements as written (after they have been stored via writeSpan)
+    void commit(isize n)
+    {
+        assert(n <= free());
+        w = (w + n) % capacity;
+    }
 };
 
 //
@@ -421,6 +446,31 @@ template <class T, isize capacity> struct RingBuffer
         }
         return result;
     }
+
+
+    //
+    // Accessing contiguous regions
+    //
+
+    // Returns the elements that can be read without wrapping around
+    std::span<T> readSpan()
+    {
+        return { elements + r, usize(r > w ? capacity - r : w - r) };
+    }
+
+    // Returns the free elements that can be written without wrapping around
+    std::span<T> writeSpan()
+    {
+        auto end = r > w ? r - 1 : r == 0 ? capacity - 1 : capacity;
+        return { elements + w, usize(end - w) };
+    }
+
+    // Marks n elements as written (after they have been stored via writeSpan)
+    void commit(isize n)
+    {
+        assert(n <= free());
+        w = (w + n) % capacity;
+    }
 };
 
 template <class T, isize capacity>
@@ -10,14 +10,38 @@
 #include "utl/abilities/Compressible.h"
 #include "utl/support/Bits.h"
 #include "utl/io/IOError.h"
+#include "utl/concurrency/WorkerPool.h"
 #include "lz4.h"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
 
 #ifdef USE_ZLIB
 #include <zlib.h>
 #endif
 
+#ifdef USE_ZSTD
+#include <zstd.h>
+#endif
+
 namespace utl {
 
+bool
+Compressible::isSupported(Compressor compressor)
+{
+    switch (compressor) {
+
+#ifndef USE_ZLIB
+        case Compressor::GZIP:  return false;
+#endif
+#ifndef USE_ZSTD
+        case Compressor::ZSTD:  return false;
+#endif
+        default:                return true;
+    }
+}
+
 #ifdef USE_ZLIB
 
 void
@@ -301,7 +325,7 @@ Compressible::unrle2(u8 *buffer, isize len, std::vector<u8> &result, isize sizeE
 
 void
 Compressible::rle3(u8 *buffer, isize len, std::vector<u8> &result) {
-    unrle(3, buffer, len, result);
+    rle(3, buffer, len, result);
 }
 
 void
@@ -309,4 +333,296 @@ Compressible::unrle3(u8 *buffer, isize len, std::vector<u8> &result, isize sizeE
     unrle(3, buffer, len, result);
 }
 
+#ifdef USE_ZSTD
+
+void
+Compressible::zstd(u8 *buffer, isize len, std::vector<u8> &result)
+{
+    // Only proceed if there is anything to compress
+    if (len == 0) return;
+
+    // Remember the initial length of the result vector
+    auto initialLen = result.size();
+
+    // Resize the target buffer
+    auto maxSize = ZSTD_compressBound(len);
+    result.resize(initialLen + maxSize);
+
+    // Run the Zstandard encoder
+    auto size = ZSTD_compress(result.data() + initialLen, maxSize, buffer, len, ZSTD_CLEVEL_DEFAULT);
+    if (ZSTD_isError(size)) {
+        throw std::runtime_error(std::string("Zstd error: ") + ZSTD_getErrorName(size));
+    }
+
+    // Reduce the target buffer to the correct size
+    result.resize(initialLen + size);
+}
+
+void
+Compressible::unzstd(u8 *buffer, isize len, std::vector<u8> &result, isize sizeEstimate)
+{
+    // Only proceed if there is anything to uncompress
+    if (len == 0) return;
+
+    // Remember the initial length of the result vector
+    auto initialLen = result.size();
+
+    // The uncompressed size is stored in the frame header
+    auto expected = ZSTD_getFrameContentSize(buffer, len);
+    if (expected == ZSTD_CONTENTSIZE_ERROR || expected == ZSTD_CONTENTSIZE_UNKNOWN) {
+        throw std::runtime_error("Zstd error: unknown content size");
+    }
+    result.resize(initialLen + expected);
+
+    // Run the Zstandard decoder
+    auto size = ZSTD_decompress(result.data() + initialLen, expected, buffer, len);
+    if (ZSTD_isError(size)) {
+        throw std::runtime_error(std::string("Zstd error: ") + ZSTD_getErrorName(size));
+    }
+    if (size != expected) {
+        throw std::runtime_error("Zstd error: inconsistent lengths");
+    }
+}
+
+#else
+
+void
+Compressible::zstd(u8 *buffer, isize len, std::vector<u8> &result) {
+    throw std::runtime_error("No zstd support.");
+}
+void
+Compressible::unzstd(u8 *buffer, isize len, std::vector<u8> &result, isize sizeEstimate) {
+    throw std::runtime_error("No zstd support.");
+}
+
+#endif
+
+namespace {
+
+// Size of the container header and of a single table entry
+constexpr isize headerSize = 12;
+constexpr isize entrySize = 5;
+
+// Compresses a single chunk into a buffer of at least chunkBound(len) bytes
+isize
+compressChunk(const u8 *src, isize len, u8 *dst, Compressor &method)
+{
+#ifdef USE_ZSTD
+
+    method = Compressor::ZSTD;
+    auto size = ZSTD_compress(dst, ZSTD_compressBound(len), src, len, ZSTD_CLEVEL_DEFAULT);
+    if (ZSTD_isError(size)) size = len;
+
+#else
+
+    method = Compressor::LZ4;
+    auto size = isize(LZ4_compress_default((const char *)src, (char *)dst, int(len), LZ4_compressBound(int(len))));
+    if (size <= 0) size = len;
+
+#endif
+
+    // Store the chunk raw if it doesn't shrink
+    if (isize(size) >= len) {
+
+        method = Compressor::NONE;
+        std::memcpy(dst, src, len);
+        return len;
+    }
+    return isize(size);
+}
+
+// Returns the size of a buffer that can hold any compressed chunk
+isize
+chunkBound(isize len)
+{
+#ifdef USE_ZSTD
+    return isize(ZSTD_compressBound(len));
+#else
+    return isize(LZ4_compressBound(int(len)));
+#endif
+}
+
+// Uncompresses a single chunk into a buffer of the uncompressed size
+void
+uncompressChunk(const u8 *src, isize len, u8 *dst, isize size, Compressor method)
+{
+    switch (method) {
+
+        case Compressor::NONE:
+
+            if (len != size) throw std::runtime_error("Chunk error: inconsistent lengths");
+            std::memcpy(dst, src, len);
+            break;
+
+        case Compressor::LZ4:
+
+            if (LZ4_decompress_safe((const char *)src, (char *)dst, int(len), int(size)) != size) {
+                throw std::runtime_error("Chunk error: LZ4 decompression failure");
+            }
+            break;
+
+#ifdef USE_ZSTD
+        case Compressor::ZSTD:
+
+            if (ZSTD_decompress(dst, size, src, len) != usize(size)) {
+                throw std::runtime_error("Chunk error: Zstd decompression failure");
+            }
+            break;
+#endif
+
+        default:
+            throw std::runtime_error("Chunk error: unsupported compressor");
+    }
+}
+
+/* Distributes func(0) ... func(n - 1) among a shared pool of worker threads.
+ * If the pool is occupied by another thread, the calls are executed by the
+ * calling thread. Exceptions are forwarded to the caller.
+ */
+void
+parallel(isize n, const std::function<void(isize)> &func)
+{
+    static std::mutex mutex;
+    static std::unique_ptr<WorkerPool> pool;
+
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    auto task = [&](isize i) {
+
+        try { func(i); } catch (...) {
+
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) error = std::current_exception();
+        }
+    };
+
+    if (std::unique_lock<std::mutex> lock(mutex, std::try_to_lock); n > 1 && lock) {
+
+        if (!pool) {
+
+            auto cores = isize(std::thread::hardware_concurrency());
+            pool = std::make_unique<WorkerPool>(std::clamp(cores - 1, isize(0), isize(7)));
+        }
+        pool->run(n, task);
+
+    } else {
+
+        for (isize i = 0; i < n; i++) task(i);
+    }
+
+    if (error) std::rethrow_exception(error);
+}
+
+// Checks the container header and returns the offset of each chunk
+std::vector<isize>
+parseContainer(const u8 *buffer, isize len, isize &total, isize &size)
+{
+    if (len < headerSize) throw std::runtime_error("Chunk error: impossible length");
+
+    total = R32BE(buffer);
+    size = R32BE(buffer + 4);
+    auto count = isize(R32BE(buffer + 8));
+
+    if (size <= 0 || count != (total + size - 1) / size || len < headerSize + count * entrySize) {
+        throw std::runtime_error("Chunk error: corrupted header");
+    }
+
+    std::vector<isize> offsets(count + 1);
+    offsets[0] = headerSize + count * entrySize;
+    for (isize i = 0; i < count; i++) {
+        offsets[i + 1] = offsets[i] + R32BE(buffer + headerSize + i * entrySize);
+    }
+    if (offsets[count] > len) throw std::runtime_error("Chunk error: truncated data");
+
+    return offsets;
+}
+
+}
+
+void
+Compressible::chunk(u8 *buffer, isize len, std::vector<u8> &result)
+{
+    // Only proceed if there is anything to compress
+    if (len == 0) return;
+
+    auto count = (len + chunkSize - 1) / chunkSize;
+    auto bound = chunkBound(chunkSize);
+
+    // Compress all chunks into separate areas of a scratch buffer
+    std::vector<u8> scratch(count * bound);
+    std::vector<isize> sizes(count);
+    std::vector<Compressor> methods(count);
+
+    parallel(count, [&](isize i) {
+
+        auto size = std::min(chunkSize, len - i * chunkSize);
+        sizes[i] = compressChunk(buffer + i * chunkSize, size, scratch.data() + i * bound, methods[i]);
+    });
+
+    // Write the header and the chunk table
+    auto initialLen = result.size();
+    result.resize(initialLen + headerSize + count * entrySize);
+
+    auto *p = result.data() + initialLen;
+    W32BE(p, u32(len));
+    W32BE(p + 4, u32(chunkSize));
+    W32BE(p + 8, u32(count));
+    for (isize i = 0; i < count; i++) {
+
+        W32BE(p + headerSize + i * entrySize, u32(sizes[i]));
+        p[headerSize + i * entrySize + 4] = u8(methods[i]);
+    }
+
+    // Append the compressed chunks
+    for (isize i = 0; i < count; i++) {
+
+        auto *chunk = scratch.data() + i * bound;
+        result.insert(result.end(), chunk, chunk + sizes[i]);
+    }
+}
+
+void
+Compressible::unchunk(u8 *buffer, isize len, std::vector<u8> &result, isize sizeEstimate)
+{
+    // Only proceed if there is anything to uncompress
+    if (len == 0) return;
+
+    isize total, size;
+    auto offsets = parseContainer(buffer, len, total, size);
+    auto count = isize(offsets.size()) - 1;
+
+    // Uncompress all chunks in parallel into their final position
+    auto initialLen = result.size();
+    result.resize(initialLen + total);
+
+    parallel(count, [&](isize i) {
+
+        auto method = Compressor(buffer[headerSize + i * entrySize + 4]);
+        uncompressChunk(buffer + offsets[i], offsets[i + 1] - offsets[i],
+                        result.data() + initialLen + i * size,
+                        std::min(size, total - i * size), method);
+    });
+}
+
+isize
+Compressible::chunkCount(const u8 *buffer, isize len)
+{
+    if (len < headerSize) throw std::runtime_error("Chunk error: impossible length");
+    return isize(R32BE(buffer + 8));
+}
+
+void
+Compressible::extractChunk(const u8 *buffer, isize len, isize nr, std::vector<u8> &result)
+{
+    isize total, size;
+    auto offsets = parseContainer(buffer, len, total, size);
+
+    if (nr < 0 || nr >= isize(offsets.size()) - 1) throw std::runtime_error("Chunk error: invalid chunk");
+
+    auto method = Compressor(buffer[headerSize + nr * entrySize + 4]);
+    result.resize(std::min(size, total - nr * size));
+    uncompressChunk(buffer + offsets[nr], offsets[nr + 1] - offsets[nr], result.data(), isize(result.size()), method);
+}
+
 }
@@ -0,0 +1,82 @@
+// -----------------------------------------------------------------------------
+// This file is part of utlib - A lightweight utility library
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#include "utl/concurrency/WorkerPool.h"
+
+namespace utl {
+
+WorkerPool::WorkerPool(isize workers)
+{
+    for (isize i = 0; i < workers; i++) threads.emplace_back(&WorkerPool::work, this);
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        quit = true;
+    }
+    wakeUp.notify_all();
+
+    for (auto &thread : threads) thread.join();
+}
+
+void
+WorkerPool::run(isize n, const std::function<void(isize)> &func)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    job = &func;
+    count = n;
+    next = 0;
+    pending = n;
+
+    lock.unlock();
+    wakeUp.notify_all();
+    lock.lock();
+
+    // Lend a hand
+    while (next < count) {
+
+        auto task = next++;
+
+        lock.unlock();
+        func(task);
+        lock.lock();
+
+        pending--;
+    }
+
+    // Wait for the workers to finish
+    done.wait(lock, [this]{ return pending == 0; });
+    job = nullptr;
+}
+
+void
+WorkerPool::work()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+
+        wakeUp.wait(lock, [this]{ return quit || (job && next < count); });
+        if (quit) return;
+
+        auto task = next++;
+        auto func = job;
+
+        lock.unlock();
+        (*func)(task);
+        lock.lock();
+
+        if (--pending == 0) done.notify_one();
+    }
+}
+
+}
@@ -15,6 +15,15 @@
 #include <fstream>
 #include <sstream>
 
+#ifndef _WIN32
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#endif
+
 namespace utl {
 
 template <class T>
@@ -72,7 +81,17 @@ Allocator<T>::dealloc()
 
     if (ptr) {
 
-        delete [] ptr;
+        if (mapping) {
+
+#ifndef _WIN32
+            munmap((void *)ptr, mapping);
+#endif
+            mapping = 0;
+
+        } else {
+
+            delete [] ptr;
+        }
         ptr = nullptr;
         size = 0;
     }
@@ -136,12 +155,74 @@ Allocator<T>::init(const fs::path &path)
     // Return an empty buffer if the stream could not be opened
     if (!stream) { dealloc(); return; }
 
-    // Read file contents into a string stream
-    std::ostringstream sstr(std::ios::binary);
-    sstr << stream.rdbuf();
+    // Determine the file size
+    stream.seekg(0, std::ios::end);
+    auto bytes = isize(stream.tellg());
+    stream.seekg(0, std::ios::beg);
+
+    // Return an empty buffer if the size could not be determined
+    if (!stream || bytes < 0) { dealloc(); return; }
+
+    // Read the file contents directly into the buffer
+    alloc(bytes / isize(sizeof(T)));
+    if (ptr && !stream.read((char *)ptr, bytesize())) dealloc();
+}
+
+template <class T> bool
+Allocator<T>::map(const fs::path &path)
+{
+#ifdef _WIN32
+
+    // Read the file (memory-mapping is only supported on POSIX systems)
+    std::error_code ec;
+    auto bytes = fs::file_size(path, ec);
+    if (ec) return false;
+
+    init(path);
+    return !empty() || bytes == 0;
+
+#else
+
+    auto fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    auto bytes = fstat(fd, &info) == 0 ? isize(info.st_size) : 0;
+    auto elements = bytes / isize(sizeof(T));
+
+    // Read the file instead if it is small or cannot be mapped
+    auto fallback = [&]() { close(fd); init(path); return !empty() || bytes == 0; };
+
+    if (bytes < mapThreshold || usize(elements) > maxCapacity || !S_ISREG(info.st_mode)) {
+        return fallback();
+    }
+
+    auto *addr = mmap(nullptr, size_t(bytes), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) return fallback();
+    close(fd);
+
+    dealloc();
+    ptr = (T *)addr;
+    size = elements;
+    mapping = bytes;
+
+    return true;
+
+#endif
+}
+
+template <class T> void
+Allocator<T>::unmap()
+{
+    if (!mapping) return;
+
+    auto *newPtr = new T[size];
+    copy(newPtr, 0, size);
 
-    // Call the proper init delegate
-    init(sstr.str());
+    auto elements = size;
+    dealloc();
+    ptr = newPtr;
+    size = elements;
 }
 
 template <class T> void
@@ -319,6 +400,8 @@ template void Allocator<T>::init(const T *buf, isize len); \
 template void Allocator<T>::init(const Allocator<T> &other); \
 template void Allocator<T>::init(const fs::path &path); \
 template void Allocator<T>::init(const fs::path &path, const string &name); \
+template bool Allocator<T>::map(const fs::path &path); \
+template void Allocator<T>::unmap(); \
 template void Allocator<T>::resize(isize elements); \
 template void Allocator<T>::resize(isize elements, T value); \
 template void Allocator<T>::strip(isize elements); \